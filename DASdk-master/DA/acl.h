@@ -203,6 +203,13 @@ class DA_SDK_PUBLIC acl_mgr : public base_mgr<acl_handler> {
     */
    virtual void acl_rule_set(acl_key_t const &, uint32_t,
                              acl_rule_ip_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed rule.
+   void acl_rule_set(acl_key_t const & key, uint32_t seq,
+                     acl_rule_ip_t && rule) {
+      acl_rule_set_moved(key, seq, rule);
+   }
+#endif
 
    /**
     * Adds an Ethernet (MAC) ACL rule to an ACL.
@@ -218,6 +225,13 @@ class DA_SDK_PUBLIC acl_mgr : public base_mgr<acl_handler> {
     */
    virtual void acl_rule_set(acl_key_t const &, uint32_t,
                              acl_rule_eth_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed rule.
+   void acl_rule_set(acl_key_t const & key, uint32_t seq,
+                     acl_rule_eth_t && rule) {
+      acl_rule_set_moved(key, seq, rule);
+   }
+#endif
 
    /**
     * Removes a rule from an ACL.
@@ -315,6 +329,14 @@ class DA_SDK_PUBLIC acl_mgr : public base_mgr<acl_handler> {
 
  protected:
    acl_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs acl_rule_set(acl_rule_ip_t &&), copies the rule by default.
+   virtual void acl_rule_set_moved(acl_key_t const & key, uint32_t seq,
+                                   acl_rule_ip_t & rule);
+   /// Backs acl_rule_set(acl_rule_eth_t &&), copies the rule by default.
+   virtual void acl_rule_set_moved(acl_key_t const & key, uint32_t seq,
+                                   acl_rule_eth_t & rule);
+#endif
    friend class acl_handler;
 
  private:
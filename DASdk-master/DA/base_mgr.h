@@ -6,10 +6,139 @@
 
 #include <DA/base.h>
 
-#include <map>
+#include <cstddef>  // for size_t
+#include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace DA {
 
+/*
+ * This class is not part of the public API of the SDK. You should NOT use it
+ * directly. It is used by base_mgr to store its handlers.
+ *
+ * A set of handlers kept in a contiguous vector, so that notifying them all
+ * is a linear scan, with a hash index to add and remove handlers in O(1).
+ * Removed handlers leave a tombstone behind, so that the positions of the
+ * other handlers don't change while we iterate over them, and tombstones
+ * get compacted away once nobody iterates anymore.
+ */
+template <typename T>
+class DA_SDK_PRIVATE handler_list {
+ public:
+   handler_list() : tombstones_(0) {
+   }
+
+   /// Adds a handler, or revives it if it was removed.  O(1)
+   void add(T * handler) {
+      auto it = index_.find(handler);
+      if (it != index_.end()) {
+         entry & e = entries_[it->second];
+         if (!e.active) {
+            e.active = true;
+            tombstones_--;
+         }
+         return;
+      }
+      index_.insert(std::make_pair(handler, entries_.size()));
+      entries_.push_back(entry(handler));
+   }
+
+   /// Removes a handler, leaving a tombstone in its place.  O(1)
+   void remove(T * handler) {
+      auto it = index_.find(handler);
+      if (it != index_.end()) {
+         entry & e = entries_[it->second];
+         if (e.active) {
+            e.active = false;
+            tombstones_++;
+         }
+      }
+   }
+
+   /// Returns true if the handler is in the list and wasn't removed.
+   bool contains(T * handler) const {
+      auto it = index_.find(handler);
+      return it != index_.end() && entries_[it->second].active;
+   }
+
+   /// Number of slots, including tombstones.  Use with active() and at().
+   size_t slots() const {
+      return entries_.size();
+   }
+   bool active(size_t slot) const {
+      return entries_[slot].active;
+   }
+   T * at(size_t slot) const {
+      return entries_[slot].handler;
+   }
+
+   /// Returns true if there is no handler left, tombstones aside.
+   bool empty() const {
+      return entries_.size() == tombstones_;
+   }
+   bool has_tombstones() const {
+      return tombstones_ != 0;
+   }
+   /// Returns true if tombstones make up most of the list.
+   bool mostly_tombstones() const {
+      return tombstones_ > entries_.size() / 2;
+   }
+
+   /// Gets rid of the tombstones.  Must not be called while iterating.  O(n)
+   void compact() {
+      size_t kept = 0;
+      for (size_t i = 0; i < entries_.size(); ++i) {
+         if (entries_[i].active) {
+            if (kept != i) {
+               entries_[kept] = entries_[i];
+               index_[entries_[kept].handler] = kept;
+            }
+            ++kept;
+         } else {
+            index_.erase(entries_[i].handler);
+         }
+      }
+      entries_.erase(entries_.begin() + kept, entries_.end());
+      tombstones_ = 0;
+   }
+
+ private:
+   struct entry {
+      explicit entry(T * handler) : handler(handler), active(true) {
+      }
+      T * handler;
+      bool active;
+   };
+
+   std::vector<entry> entries_;
+   // Maps a handler to its position in `entries_'.
+   std::unordered_map<T *, size_t> index_;
+   size_t tombstones_;
+};
+
+/*
+ * This class is not part of the public API of the SDK. You should NOT use it
+ * directly. Hashes the keys of key-specific handlers: keys that have a hash()
+ * method (the SDK's value types) use it, the others use std::hash.
+ */
+template <typename Key>
+struct DA_SDK_PRIVATE handler_key_hash {
+   size_t operator()(Key const & key) const {
+      return hash(key, 0);
+   }
+
+ private:
+   template <typename K>
+   static auto hash(K const & key, int) -> decltype(size_t(key.hash())) {
+      return key.hash();
+   }
+   template <typename K>
+   static size_t hash(K const & key, long) {
+      return std::hash<K>()(key);
+   }
+};
+
 /*
  * This class is not part of the public API of the SDK. You should NOT use it
  * directly. It is subclassed by the different managers that have handlers.
@@ -23,6 +152,10 @@ namespace DA {
  * It is not possible for a handler to be in both modes. The "watch all" mode is
  * always favored over "key specific". Thus you have to manually deactivate the
  * "watch all" mode to enter the "key specific" mode.
+ *
+ * Handlers are kept in handler_lists, and key-specific handlers are indexed
+ * by a hash of their key, so that notifying N handlers is a scan of N
+ * contiguous pointers, and (un)registering a handler is O(1).
  */
 template <typename T, typename Key=int> // `int' is an arbitrary default for classes
 class DA_SDK_PRIVATE base_mgr {        // that don't use key-specific notifications
@@ -31,25 +164,29 @@ class DA_SDK_PRIVATE base_mgr {        // that don't use key-specific notificati
    }
 
    virtual ~base_mgr() {
-      for (auto it = watchAllHandlers_.begin(); it != watchAllHandlers_.end();
-            ++it) {
-         if (it->second) {
+      // Keeps remove_handler() from compacting the lists under our feet.
+      inForeach_ = true;
+      for (size_t i = 0; i < watchAllHandlers_.slots(); ++i) {
+         if (watchAllHandlers_.active(i)) {
+            T * handler = watchAllHandlers_.at(i);
             // mgr may want to do so specific work in the remove_handler function.
             // We need to call it there so that handlers that did not unsubscribe
             // are still correctly cleaned.
-            remove_handler(it->first);
-            it->first->unregister_mgr();
+            remove_handler(handler);
+            handler->unregister_mgr();
          }
       }
       for (auto map = keySpecificHandlers_.begin();
             map != keySpecificHandlers_.end(); ++map) {
-         for (auto it = map->second.begin(); it != map->second.end(); ++it) {
-            if (it->second) {
+         handler_list<T> & handlers = map->second;
+         for (size_t i = 0; i < handlers.slots(); ++i) {
+            if (handlers.active(i)) {
+               T * handler = handlers.at(i);
                // mgr may want to do so specific work in the remove_handler
                // function. We need to call it there so that handlers that did not
                // unsubscribe are still correctly cleaned.
-               remove_handler(map->first, it->first);
-               it->first->unregister_mgr();
+               remove_handler(map->first, handler);
+               handler->unregister_mgr();
             }
          }
       }
@@ -57,63 +194,87 @@ class DA_SDK_PRIVATE base_mgr {        // that don't use key-specific notificati
 
    virtual void add_handler(T *handler) {
       // no specific ordering
-      watchAllHandlers_.insert(std::make_pair(handler, true));
+      watchAllHandlers_.add(handler);
 
       // The handler is now registered in the "watchAll" set. The key-specific
       // registration needs to be cleaned to avoid calling the handler twice.
-      for (auto it = keySpecificHandlers_.begin(); it != keySpecificHandlers_.end();
-            ++it) {
-         auto element = it->second.find(handler);
-         if (element != it->second.end()) {
-            element->second = false;
+      auto keys = handlerKeys_.find(handler);
+      if (keys != handlerKeys_.end()) {
+         for (auto key = keys->second.begin(); key != keys->second.end(); ++key) {
+            auto entry = keySpecificHandlers_.find(*key);
+            if (entry != keySpecificHandlers_.end()) {
+               entry->second.remove(handler);
+            }
          }
+         handlerKeys_.erase(keys);
       }
    }
 
    // We don't allow a handler to be registered both as generic and key-specific.
    // We always favor generic over key-specific.
    virtual void add_handler(Key const & key, T *handler) {
-      auto element = watchAllHandlers_.find(handler);
-      if (element != watchAllHandlers_.end()) {
-         if (element->second == true) {
-            return;
-         }
+      if (watchAllHandlers_.contains(handler)) {
+         return;
+      }
+      handler_list<T> & handlers = keySpecificHandlers_[key];
+      if (!handlers.contains(handler)) {
+         handlers.add(handler);
+         handlerKeys_[handler].push_back(key);
       }
-      keySpecificHandlers_[key].insert(std::make_pair(handler, true));
    }
 
    virtual void remove_handler(T *handler) {
-      auto element = watchAllHandlers_.find(handler);
-      if (element != watchAllHandlers_.end()) {
-         element->second = false;
+      watchAllHandlers_.remove(handler);
+      // Handlers come and go without notifications in between, so don't
+      // wait for the next handler_foreach() to clean up.
+      if (!inForeach_ && watchAllHandlers_.mostly_tombstones()) {
+         watchAllHandlers_.compact();
       }
    }
 
    virtual void remove_handler(Key const & key, T *handler) {
       auto entry = keySpecificHandlers_.find(key);
       if (entry != keySpecificHandlers_.end()) {
-         auto element = entry->second.find(handler);
-         if (element != entry->second.end()) {
-            element->second = false;
+         entry->second.remove(handler);
+         auto keys = handlerKeys_.find(handler);
+         if (keys != handlerKeys_.end()) {
+            std::vector<Key> & handler_keys = keys->second;
+            for (size_t i = 0; i < handler_keys.size(); ++i) {
+               if (handler_keys[i] == key) {
+                  handler_keys[i] = handler_keys.back();
+                  handler_keys.pop_back();
+                  break;
+               }
+            }
+            if (handler_keys.empty()) {
+               handlerKeys_.erase(keys);
+            }
+         }
+         if (!inForeach_) {
+            if (entry->second.empty()) {
+               keySpecificHandlers_.erase(entry);
+            } else if (entry->second.mostly_tombstones()) {
+               entry->second.compact();
+            }
          }
       }
    }
 
+   /// Returns true if the handler watches all the keys.
+   bool watching_all(T * handler) const {
+      return watchAllHandlers_.contains(handler);
+   }
+
    // Run the function f for each registered handler, with no specific ordering
    template <typename Func> void handler_foreach(Func f) {
       bool wasInForeach = inForeach_;
       inForeach_ = true;
 
-      auto currentIt = watchAllHandlers_.begin();
-      for (auto it = currentIt; it != watchAllHandlers_.end();) {
-         currentIt = it++;
-         if (currentIt->second) {
-            f(currentIt->first);
-         } else if (!wasInForeach) {
-            // If we are not in a nested foreach, we can clean up the lazy work left
-            // to us
-            watchAllHandlers_.erase(currentIt);
-         }
+      foreach_in(watchAllHandlers_, f);
+      if (!wasInForeach && watchAllHandlers_.has_tombstones()) {
+         // If we are not in a nested foreach, we can clean up the lazy work left
+         // to us
+         watchAllHandlers_.compact();
       }
 
       inForeach_ = wasInForeach;
@@ -125,36 +286,28 @@ class DA_SDK_PRIVATE base_mgr {        // that don't use key-specific notificati
       bool wasInForeach = inForeach_;
       inForeach_ = true;
 
-      auto currentIt = watchAllHandlers_.begin();
-      for (auto it = currentIt; it != watchAllHandlers_.end();) {
-         currentIt = it++;
-         if (currentIt->second) {
-            f(currentIt->first);
-         } else if (!wasInForeach) {
-            // If we are not in a nested foreach, we can clean up the lazy work left
-            // to us
-            watchAllHandlers_.erase(currentIt);
-         }
+      foreach_in(watchAllHandlers_, f);
+      if (!wasInForeach && watchAllHandlers_.has_tombstones()) {
+         // If we are not in a nested foreach, we can clean up the lazy work left
+         // to us
+         watchAllHandlers_.compact();
       }
 
       // Since we don't allow a handler to be both key-specific and generic, we
       // don't have to check if F was already executed for a given handler.
+      // Handlers run by `f' may register new keys, which can rehash the
+      // index, so look the key up again after running them.
       auto entry = keySpecificHandlers_.find(key);
       if (entry != keySpecificHandlers_.end()) {
-         auto currentIt= entry->second.begin();
-         for (auto it = currentIt; it != entry->second.end();) {
-            currentIt = it++;
-            if (currentIt->second) {
-               f(currentIt->first);
-            } else if (!wasInForeach) {
-               // If we are not in a nested foreach, we can clean up the lazy work
-               // left to us
-               entry->second.erase(currentIt);
+         foreach_in(entry->second, f);
+         entry = keySpecificHandlers_.find(key);
+         if (!wasInForeach && entry != keySpecificHandlers_.end()) {
+            if (entry->second.empty()) {
+               keySpecificHandlers_.erase(entry);
+            } else if (entry->second.has_tombstones()) {
+               entry->second.compact();
             }
          }
-         if (entry->second.empty()) {
-            keySpecificHandlers_.erase(entry);
-         }
       }
 
       inForeach_ = wasInForeach;
@@ -163,9 +316,25 @@ class DA_SDK_PRIVATE base_mgr {        // that don't use key-specific notificati
  private:
    template <typename U, typename V> friend class base_handler;
 
+   // Runs `f' on the handlers of the list that are active when we get to
+   // them.  Handlers added while we iterate are not notified this time.
+   // Indices are used since `f' may add handlers, and thus grow the vector.
+   template <typename Func> static void foreach_in(handler_list<T> & handlers,
+                                                   Func & f) {
+      size_t slots = handlers.slots();
+      for (size_t i = 0; i < slots; ++i) {
+         if (handlers.active(i)) {
+            f(handlers.at(i));
+         }
+      }
+   }
+
    bool inForeach_;
-   std::map<T *, bool> watchAllHandlers_;
-   std::map<Key, std::map<T *, bool> > keySpecificHandlers_;
+   handler_list<T> watchAllHandlers_;
+   std::unordered_map<Key, handler_list<T>, handler_key_hash<Key> >
+      keySpecificHandlers_;
+   // The keys each key-specific handler is registered to.
+   std::unordered_map<T *, std::vector<Key> > handlerKeys_;
 };
 
 }
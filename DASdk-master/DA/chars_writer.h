@@ -0,0 +1,96 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef DA_SDK_CHARS_WRITER
+#define DA_SDK_CHARS_WRITER
+
+#include <stddef.h>
+
+#include <string>
+#include <type_traits>
+
+#include <DA/base.h>
+
+namespace DA {
+
+/**
+ * This is a helper class to format values into a caller-provided buffer,
+ * without allocating memory.  It's needed by the to_chars() methods of the
+ * SDK's types.
+ *
+ * Values are appended with operator<<, which formats them the way an
+ * std::ostream would, except that 8-bit integers are written as numbers
+ * rather than characters.  Once a value doesn't fit, nothing more is
+ * written and end() returns null.
+ */
+class DA_SDK_PUBLIC chars_writer {
+ public:
+   /// Writes into the buffer [first, last).
+   chars_writer(char * first, char * last);
+
+   /**
+    * Returns the end of the characters written so far, or null if they
+    * didn't all fit.  No terminating null character is written.
+    */
+   char * end() const;
+
+   void write(char const * str, size_t len);
+   chars_writer & operator<<(char c);
+   chars_writer & operator<<(char const * str);
+   chars_writer & operator<<(std::string const & str);
+   /// Writes `value' in decimal.
+   void write_decimal(uint64_t value);
+   /// Writes `value' in lower case hexadecimal, without leading zeros.
+   void write_hex(uint64_t value);
+
+#ifndef SWIG
+
+   /**
+    * Writes a value: integers and floating point numbers as an std::ostream
+    * would, enums by name, and other types with their to_chars() method.
+    * Character arrays are written as strings, by the overload above.
+    */
+   template <typename T>
+   typename std::enable_if<!std::is_array<T>::value, chars_writer &>::type
+   operator<<(T const & value);
+
+   /**
+    * Formats `value' into an std::string with its to_chars() method.  This
+    * only allocates the string itself.
+    */
+   template <typename T>
+   static std::string to_string(T const & value);
+
+ private:
+   template <typename T>
+   typename std::enable_if<std::is_integral<T>::value &&
+                           std::is_unsigned<T>::value>::type
+   write_value(T value, int);
+   template <typename T>
+   typename std::enable_if<std::is_integral<T>::value &&
+                           std::is_signed<T>::value>::type
+   write_value(T value, int);
+   template <typename T>
+   typename std::enable_if<std::is_floating_point<T>::value>::type
+   write_value(T value, int);
+   template <typename T>
+   typename std::enable_if<std::is_enum<T>::value>::type
+   write_value(T value, int);
+   template <typename T>
+   auto write_value(T const & value, long)
+      -> decltype(value.to_chars((char *)0, (char *)0), void());
+#endif
+
+ private:
+   void write_double(double value);
+
+   // The next character to write, null once out of room.
+   char * pos_;
+   char * last_;
+};
+
+}
+
+#include <DA/inline/chars_writer.h>
+
+#endif
@@ -78,6 +78,12 @@ class DA_SDK_PUBLIC class_map_mgr {
 
    /// Sets a class map and commits its configuration
    virtual void class_map_is(class_map_t const & class_map) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed class map.
+   void class_map_is(class_map_t && class_map) {
+      class_map_is_moved(class_map);
+   }
+#endif
 
    /// Provides iteration over the configured class maps for a feature
    virtual class_map_iter_t class_map_iter(policy_feature_t) const = 0;
@@ -87,6 +93,10 @@ class DA_SDK_PUBLIC class_map_mgr {
 
  protected:
    class_map_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs class_map_is(class_map_t &&), copies the class map by default.
+   virtual void class_map_is_moved(class_map_t & class_map);
+#endif
  private:
    DA_SDK_DISALLOW_COPY_CTOR(class_map_mgr);
 };
@@ -0,0 +1,212 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef DA_COROUTINE_H
+#define DA_COROUTINE_H
+
+/**
+ * @file
+ * C++20 coroutine support.
+ *
+ * Logic that waits on several events in a row, such as reading a message
+ * off a socket or waiting for a route before programming the next one,
+ * can be written as a coroutine instead of a handler that keeps track of
+ * where it is in between callbacks:
+ *
+ * @code
+ *    DA::task echo(int fd) {
+ *       char buf[512];
+ *       for (;;) {
+ *          co_await DA::readable(fd);
+ *          ssize_t n = read(fd, buf, sizeof(buf));
+ *          if (n <= 0) {
+ *             break;
+ *          }
+ *          write(fd, buf, n);
+ *       }
+ *       close(fd);
+ *    }
+ * @endcode
+ *
+ * A task starts running as soon as it's called, up to its first
+ * `co_await', and is then resumed straight from the event loop, by the
+ * shard of the thread that called it.  Awaiting doesn't allocate memory:
+ * the state of the wait lives in the coroutine frame, which is allocated
+ * once when the task is called and freed once it returns.
+ *
+ * Nothing resumes a task whose event never comes, so a task that must
+ * give up after a while needs a separate timer to wake it up.
+ *
+ * This header requires a compiler in C++20 mode, the rest of the SDK
+ * doesn't.
+ */
+
+#if !defined(__cpp_impl_coroutine) || __cpp_impl_coroutine < 201902L
+#error "DA/coroutine.h requires C++20 coroutines, e.g. -std=c++20"
+#endif
+
+#include <coroutine>
+#include <exception>
+
+#include <DA/base.h>
+#include <DA/fd.h>
+#include <DA/fib.h>
+#include <DA/timer.h>
+
+namespace DA {
+
+/**
+ * A coroutine run by the event loop.
+ *
+ * Tasks are detached: they run until they return, and the caller doesn't
+ * wait for them.  Their frame is freed as soon as they return.  An
+ * exception escaping a task calls std::terminate(), like one escaping a
+ * thread would, so tasks must catch what they can handle.
+ */
+class DA_SDK_PUBLIC task {
+ public:
+   struct promise_type {
+      task get_return_object() noexcept {
+         return task();
+      }
+      std::suspend_never initial_suspend() noexcept {
+         return {};
+      }
+      std::suspend_never final_suspend() noexcept {
+         return {};
+      }
+      void return_void() noexcept {
+      }
+      void unhandled_exception() noexcept {
+         // Rethrowing from here would leave the frame suspended for good,
+         // and nobody holds a handle to destroy it.
+         std::terminate();
+      }
+   };
+};
+
+/// Awaitable returned by readable() and writable().
+class DA_SDK_PUBLIC fd_awaiter : private fd_waiter {
+ public:
+   fd_awaiter(int fd, bool writable) : watched_fd_(fd), writable_(writable) {
+   }
+
+   bool await_ready() const noexcept {
+      return false;
+   }
+   void await_suspend(std::coroutine_handle<> handle) {
+      handle_ = handle;
+      if (writable_) {
+         wait_writable(watched_fd_);
+      } else {
+         wait_readable(watched_fd_);
+      }
+   }
+   void await_resume() const noexcept {
+   }
+
+ private:
+   void on_ready(int) override {
+      // This resumes the coroutine, which destroys us: don't touch `this'
+      // past this point.
+      handle_.resume();
+   }
+
+   std::coroutine_handle<> handle_;
+   int watched_fd_;
+   bool writable_;
+};
+
+/// Suspends the calling task until the passed file descriptor is readable.
+inline fd_awaiter readable(int fd) {
+   return fd_awaiter(fd, false);
+}
+
+/// Suspends the calling task until the passed file descriptor is writable.
+inline fd_awaiter writable(int fd) {
+   return fd_awaiter(fd, true);
+}
+
+/// Awaitable returned by sleep_until() and sleep_for().
+class DA_SDK_PUBLIC sleep_awaiter {
+ public:
+   sleep_awaiter(timeout_mgr * mgr, seconds_t deadline)
+      : mgr_(mgr), deadline_(deadline) {
+   }
+
+   bool await_ready() const {
+      return deadline_ <= now();
+   }
+   void await_suspend(std::coroutine_handle<> handle) {
+      // The handle fits in the callback's inline storage, so the timer
+      // doesn't allocate anything.
+      mgr_->timer_once(deadline_, [handle]() { handle.resume(); });
+   }
+   void await_resume() const noexcept {
+   }
+
+ private:
+   timeout_mgr * mgr_;
+   seconds_t deadline_;
+};
+
+/**
+ * Suspends the calling task until the absolute time `deadline', see now().
+ * Doesn't suspend at all if the deadline has already passed.
+ */
+inline sleep_awaiter sleep_until(timeout_mgr * mgr, seconds_t deadline) {
+   return sleep_awaiter(mgr, deadline);
+}
+
+/// Suspends the calling task for `delay' seconds.
+inline sleep_awaiter sleep_for(timeout_mgr * mgr, seconds_t delay) {
+   return sleep_awaiter(mgr, now() + delay);
+}
+
+/**
+ * Awaitable returned by fib_route_seen().  It only registers with the
+ * manager if the route isn't there yet, in the manager's index of waiters
+ * by route, so a route being set only resumes the tasks waiting on it.
+ * A manager being deleted disarms it, and the task is never resumed.
+ */
+class DA_SDK_PUBLIC fib_route_awaiter : private fib_route_waiter {
+ public:
+   fib_route_awaiter(fib_mgr * mgr, fib_route_key_t const & key)
+      : mgr_(mgr), key_(key) {
+   }
+
+   bool await_ready() const {
+      return mgr_->fib_route_exists(key_);
+   }
+   void await_suspend(std::coroutine_handle<> handle) {
+      handle_ = handle;
+      wait_route(mgr_, key_);
+   }
+   void await_resume() const noexcept {
+   }
+
+ private:
+   void on_route_set(fib_route_t const &) override {
+      // This resumes the coroutine, which destroys us: don't touch `this'
+      // past this point.
+      handle_.resume();
+   }
+
+   fib_mgr * mgr_;
+   fib_route_key_t key_;
+   std::coroutine_handle<> handle_;
+};
+
+/**
+ * Suspends the calling task until the route with the given key exists in
+ * the FIB.  Doesn't suspend at all if it already exists.  The fib_mgr must
+ * be in a notifying mode, and only the main loop can wait on routes.
+ */
+inline fib_route_awaiter fib_route_seen(fib_mgr * mgr,
+                                        fib_route_key_t const & key) {
+   return fib_route_awaiter(mgr, key);
+}
+
+}
+
+#endif // DA_COROUTINE_H
@@ -98,6 +98,12 @@ class DA_SDK_PUBLIC decap_group_mgr {
     * Either creates or updates a decap group (keyed by the group name).
     */
    virtual void decap_group_set(decap_group_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed decap group.
+   void decap_group_set(decap_group_t && group) {
+      decap_group_set_moved(group);
+   }
+#endif
 
    /**
     * Removes the named decap group from the configuration.
@@ -107,6 +113,10 @@ class DA_SDK_PUBLIC decap_group_mgr {
    virtual void decap_group_del(std::string const & decap_group_name) = 0;
  protected:
    decap_group_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs decap_group_set(decap_group_t &&), copies the decap group by default.
+   virtual void decap_group_set_moved(decap_group_t & group);
+#endif
  private:
    DA_SDK_DISALLOW_COPY_CTOR(decap_group_mgr);
 };
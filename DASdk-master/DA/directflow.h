@@ -91,6 +91,12 @@ class DA_SDK_PUBLIC directflow_mgr : public base_mgr<flow_handler, std::string>
 
    /// Insert or update a flow
    virtual void flow_entry_set(flow_entry_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed flow.
+   void flow_entry_set(flow_entry_t && flow) {
+      flow_entry_set_moved(flow);
+   }
+#endif
    /// Delete a flow
    virtual void flow_entry_del(std::string const &) = 0;
 
@@ -107,6 +113,10 @@ class DA_SDK_PUBLIC directflow_mgr : public base_mgr<flow_handler, std::string>
 
  protected:
    directflow_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs flow_entry_set(flow_entry_t &&), copies the flow by default.
+   virtual void flow_entry_set_moved(flow_entry_t & flow);
+#endif
    friend class flow_handler;
 
  private:
@@ -4,10 +4,25 @@
 #ifndef DA_ETH_H
 #define DA_ETH_H
 
+#include <functional>
+
 #include <DA/types/eth.h>
 
 namespace DA {
 
 }
 
+// Provide the hash functor for eth_addr_t, so that it can be used as the key
+// of unordered containers without explicitly supplying the functor.
+namespace std {
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::eth_addr_t> {
+   size_t operator() (DA::eth_addr_t const & addr) const {
+      return addr.hash();
+   }
+};
+
+}
+
 #endif // DA_ETH_H
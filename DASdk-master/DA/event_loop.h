@@ -27,6 +27,15 @@
  * `event_loop_handler` that your program should subclass. For an
  * example, see examples/Thrift[Client|Server].cpp's interaction with
  * the `libevent_loop` defined in `libevent.h`.
+ *
+ * Finally, the event loop can be split into several shards, each running
+ * its own loop, file descriptors and timers on a dedicated thread, so that
+ * independent work (per-VRF route processing, per-interface counter
+ * polling, etc.) can be spread across cores.  See event_loop::shards_is().
+ *
+ * To track down what stalls the loop, its instrumentation can be turned on
+ * with event_loop::stats_enabled_is().  It records how late timers fire and
+ * how long each handler callback takes, see loop_stat_t.
  */
 
 #ifndef DA_EVENT_LOOP_H
@@ -34,6 +43,10 @@
 
 #include <sys/time.h>
 
+#include <functional>
+#include <map>
+#include <string>
+
 #include <DA/base.h>
 
 namespace DA {
@@ -88,6 +101,72 @@ class DA_SDK_PUBLIC event_loop_handler {
 
 class mount_mgr;
 
+/// Callback posted to an event loop shard with event_loop::post().
+typedef std::function<void()> shard_callback_t;
+
+/// The measurements made by the event loop instrumentation.
+enum loop_stat_t {
+   /** How late timers fire compared to their deadline. */
+   LOOP_STAT_TIMER_LATENESS,
+   /** Time spent handling the events of one loop iteration. */
+   LOOP_STAT_ITERATION,
+   /** Duration of fd_handler (and fd_waiter) callbacks. */
+   LOOP_STAT_FD_HANDLER,
+   /** Duration of timeout_handler::on_timeout(). */
+   LOOP_STAT_TIMEOUT_HANDLER,
+   /** Duration of the callbacks of the timers of the timeout_mgr. */
+   LOOP_STAT_TIMER_CALLBACK,
+   /** Duration of the callbacks passed to event_loop::post(). */
+   LOOP_STAT_POSTED_CALLBACK,
+   /** Duration of the notifications managers deliver to their handlers. */
+   LOOP_STAT_MGR_HANDLER,
+};
+
+/**
+ * Histogram of durations, with log-linear buckets.
+ *
+ * Each power of two of nanoseconds is split into 8 linear buckets, so that
+ * values are kept with a relative error below 12.5% across the whole range,
+ * in a fixed amount of memory, and recording a value is O(1).
+ */
+class DA_SDK_PUBLIC loop_histogram_t {
+ public:
+   loop_histogram_t();
+
+   /// Records a duration, in seconds.
+   void record(seconds_t value);
+   /// Forgets all the recorded durations.
+   void reset();
+
+   /// Returns the number of recorded durations.
+   uint64_t count() const;
+   /// Returns the sum of the recorded durations.
+   seconds_t total() const;
+   /// Returns the longest recorded duration.
+   seconds_t max() const;
+   /**
+    * Returns the duration that `percentile' percent of the recorded ones
+    * don't exceed, e.g. percentile(99) for the p99.  This is the upper bound
+    * of the bucket the percentile falls in.  Returns 0 if nothing was
+    * recorded.
+    */
+   seconds_t percentile(double percentile) const;
+
+   /// Returns a one-line summary: count, p50, p90, p99, p99.9 and max.
+   std::string to_string() const;
+
+ private:
+   static const int linear_bits = 3;
+   static const int num_buckets = (64 - linear_bits + 1) << linear_bits;
+   static int bucket(uint64_t nanoseconds);
+   static uint64_t bucket_upper_bound(int bucket);
+
+   uint64_t buckets_[num_buckets];
+   uint64_t count_;
+   uint64_t total_ns_;
+   uint64_t max_ns_;
+};
+
 /**
  * The DA event loop.
  *
@@ -142,6 +221,70 @@ class DA_SDK_PUBLIC event_loop {
     */
    void external_loop_is(event_loop_handler * loop);
 
+   /**
+    * Starts additional event loop shards so that there are `count' shards
+    * in total.  Shard 0 is the main event loop and always exists, the
+    * other shards each run their own loop, with their own file descriptors
+    * and timers, on a dedicated thread.  Shards can't be removed once
+    * started; they are stopped when the program exits.
+    *
+    * An fd_handler or timeout_handler is pinned to the shard of the thread
+    * that created it, and so are the timers created through the
+    * timeout_mgr: their callbacks always run on that shard's thread, and
+    * they must only be used and destroyed from there.  To move work to a
+    * shard, post() a callback that creates the handlers on that shard.
+    *
+    * The other managers are not thread safe: only the main loop may use
+    * them, so shards must post() their results back to shard 0.
+    *
+    * This method must be called from the main loop's thread.
+    */
+   void shards_is(uint32_t count);
+
+   /// Returns the number of event loop shards, including the main loop.
+   uint32_t shards() const;
+
+   /// Returns the shard run by the calling thread, 0 being the main loop.
+   uint32_t current_shard() const;
+
+   /**
+    * Runs `callback' on the thread of the given shard, during its next
+    * loop iteration.  This can be called from any thread, including from
+    * another shard.  Callbacks posted from one thread to one shard run in
+    * the order in which they were posted.
+    */
+   void post(uint32_t shard, shard_callback_t const & callback);
+
+   /**
+    * Turns the instrumentation of the calling thread's shard on or off.  It
+    * is off by default, and then costs a branch per callback.  Turning it
+    * on resets all the histograms.
+    */
+   void stats_enabled_is(bool enabled);
+
+   /// Returns true if the instrumentation of the calling shard is on.
+   bool stats_enabled() const;
+
+   /// Returns the histogram of the given measurement for the calling shard.
+   loop_histogram_t stats(loop_stat_t stat) const;
+
+   /**
+    * Returns the durations of the callbacks of the calling shard, per class
+    * of handler (e.g. the name of your fd_handler subclass).  The callbacks
+    * of timers and posted callbacks are only counted in stats().
+    */
+   std::map<std::string, loop_histogram_t> handler_stats() const;
+
+   /**
+    * Publishes a summary of the main loop's histograms as agent status
+    * every `interval' seconds, see agent_mgr::status_set(), under the
+    * `loop.' prefix (e.g. `loop.timer_lateness', or `loop.handler.' followed
+    * by the class name of a handler).  An interval of 0 stops publishing.
+    * The instrumentation must be on for there to be anything to publish.
+    * This method must be called from the main loop's thread.
+    */
+   void stats_status_interval_is(seconds_t interval);
+
  private:
    friend class sdk;
    explicit event_loop(mount_mgr *) DA_SDK_PRIVATE;
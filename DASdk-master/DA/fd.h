@@ -20,6 +20,7 @@
 namespace DA {
 
 class fd_internal;
+class Impl;
 
 /**
  * This class manages file descriptors within the event loop context.
@@ -67,6 +68,49 @@ class DA_SDK_PUBLIC fd_handler {
    fd_internal * fd_;
 };
 
+/**
+ * Waits, once, for a file descriptor to become ready.
+ *
+ * This is a lighter alternative to fd_handler for code that waits on one
+ * FD at a time, such as the coroutines of DA/coroutine.h.  Arming a waiter
+ * doesn't allocate memory, and the waiter is disarmed right before
+ * on_ready() gets called, so it must be re-armed to be notified again.
+ * Any number of waiters and fd_handlers can watch the same FD.
+ *
+ * Like fd_handler, a waiter belongs to the event loop shard of the thread
+ * that created it.
+ */
+class DA_SDK_PUBLIC fd_waiter {
+ public:
+   fd_waiter();
+   /// Disarms the waiter if it's still waiting.
+   virtual ~fd_waiter();
+
+   /// Called once, when the FD we were waiting on is ready.
+   virtual void on_ready(int fd) = 0;
+
+   /// Waits for the passed file descriptor to be readable.
+   void wait_readable(int fd);
+   /// Waits for the passed file descriptor to be writable.
+   void wait_writable(int fd);
+   /// Stops waiting, if we were.
+   void cancel();
+   /// Returns true if we're waiting on a file descriptor.
+   bool waiting() const;
+
+ private:
+   friend class Impl;
+   Impl * impl_;
+   // Other waiters on the same FD.
+   fd_waiter * prev_;
+   fd_waiter * next_;
+   // Sequence number we were armed with.
+   uint64_t seq_;
+   int fd_;
+   uint8_t interest_;
+   DA_SDK_DISALLOW_COPY_CTOR(fd_waiter);
+};
+
 }
 
 #endif // DA_FILE_H
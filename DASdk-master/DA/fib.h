@@ -18,6 +18,7 @@
 #define DA_FIB_H
 
 #include <forward_list>
+#include <vector>
 #include <DA/types/sdk.h>
 #include <DA/intf.h>
 #include <DA/ip.h>
@@ -66,7 +67,82 @@ class DA_SDK_PUBLIC fib_handler : public base_handler<fib_mgr, fib_handler> {
    virtual void on_fec_set(fib_fec_t const&);
    /// Handler called when a FEC gets deleted.
    virtual void on_fec_del(fib_fec_key_t const&);
+
+#ifndef SWIG
+   /**
+    * Sets whether route changes are delivered to this handler in batches,
+    * through on_route_set_batch() and on_route_del_batch(), instead of one
+    * at a time.  The batches are delivered once per event loop iteration,
+    * after the handlers of that iteration ran.  Turned on or off while
+    * changes are held back, it takes effect once they are delivered, so no
+    * change is lost or seen twice.  Off by default.
+    */
+   void route_batches_is(bool);
+   bool route_batches() const;
+
+   /**
+    * Handler called with the routes added or updated in a row, if
+    * route_batches() is on.  Calls on_route_set() for each one by default.
+    */
+   virtual void on_route_set_batch(fib_route_t const * routes, size_t count);
+   /**
+    * Handler called with the routes deleted in a row, if route_batches() is
+    * on.  Calls on_route_del() for each one by default.
+    */
+   virtual void on_route_del_batch(fib_route_key_t const * route_keys,
+                                   size_t count);
+
+   /**
+    * Sets whether this handler only gets the latest change of each route.
+    * The changes are then delivered once per event loop iteration through
+    * the batch handlers, as with route_batches_is(), except that a route
+    * changed several times shows up once, in the state the iteration left
+    * it in: a route set then deleted is only seen deleted.  Off by default.
+    */
+   void route_conflation_is(bool);
+   bool route_conflation() const;
+   /// Returns how many route changes route_conflation() spared this handler.
+   uint64_t route_changes_conflated() const;
+#endif
+};
+
+#ifndef SWIG
+/**
+ * Waits, once, for a route to be set, without being a fib_handler.
+ *
+ * The manager indexes its waiters by route key, so that setting a route
+ * only looks at the waiters of that route.  A waiter is disarmed before on_route_set() is
+ * called, and when the manager is deleted, without being called.  Like
+ * fib_handler, waiters are for the main loop.
+ */
+class DA_SDK_PUBLIC fib_route_waiter {
+ public:
+   fib_route_waiter();
+   /// Disarms the waiter if it's still waiting.
+   virtual ~fib_route_waiter();
+
+   /// Called once, when the route we were waiting for is set.
+   virtual void on_route_set(fib_route_t const & route) = 0;
+
+   /// Waits for the route with the passed key to be set in `mgr'.
+   void wait_route(fib_mgr * mgr, fib_route_key_t const & route_key);
+   /// Stops waiting, if we were.
+   void cancel();
+   /// Returns true if we're waiting for a route.
+   bool waiting() const;
+
+ private:
+   friend class fib_mgr_impl;
+   fib_mgr * mgr_;
+   fib_route_key_t route_key_;
+   // Other waiters on the same route.
+   fib_route_waiter * prev_;
+   fib_route_waiter * next_;
+   // Sequence number we were armed with.
+   uint64_t seq_;
+   DA_SDK_DISALLOW_COPY_CTOR(fib_route_waiter);
 };
+#endif
 
 /// The FIB Manager
 class DA_SDK_PUBLIC fib_mgr : public base_mgr<fib_handler> {
@@ -79,12 +155,24 @@ class DA_SDK_PUBLIC fib_mgr : public base_mgr<fib_handler> {
 
    // FEC management
    virtual bool fib_fec_set(fib_fec_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed FEC.
+   bool fib_fec_set(fib_fec_t && fec) {
+      return fib_fec_set_moved(fec);
+   }
+#endif
    virtual void fib_fec_del(fib_fec_key_t const &) = 0;
    virtual bool fib_fec_exists(fib_fec_key_t const &) = 0;
    virtual fib_fec_t fib_fec(fib_fec_key_t const &) = 0;
 
    // Route Management
    virtual bool fib_route_set(fib_route_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed route.
+   bool fib_route_set(fib_route_t && route) {
+      return fib_route_set_moved(route);
+   }
+#endif
    virtual void fib_route_del(fib_route_key_t const &) = 0;
    virtual bool fib_route_exists(fib_route_key_t const &) = 0;
    virtual fib_route_t fib_route(fib_route_key_t const &) = 0;
@@ -101,9 +189,45 @@ class DA_SDK_PUBLIC fib_mgr : public base_mgr<fib_handler> {
     */
    virtual mgr_mode_type_t mode_type() = 0;
 
+#ifndef SWIG
+   /**
+    * Splits the routes into at most `count' iterators over disjoint slices
+    * of them, which together visit each route once.  The slices are of one
+    * snapshot of the FIB, whatever changes it later, and each can be
+    * walked on its own thread, e.g. to rebuild state derived from the FIB
+    * in parallel.  Returns a single iterator by default.
+    */
+   virtual std::vector<fib_route_iter_t> fib_route_iters(size_t count) const;
+#endif
+
  protected:
    fib_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs fib_fec_set(fib_fec_t &&), copies the FEC by default.
+   virtual bool fib_fec_set_moved(fib_fec_t & fec);
+   /// Backs fib_route_set(fib_route_t &&), copies the route by default.
+   virtual bool fib_route_set_moved(fib_route_t & route);
+   /**
+    * Back fib_route_waiter::wait_route() and cancel().  Managers that
+    * don't index waiters call panic() with an unsupported_error.
+    */
+   virtual void route_waiter_add(fib_route_waiter * waiter);
+   virtual void route_waiter_del(fib_route_waiter * waiter);
+   /**
+    * Back fib_handler::route_batches_is(), route_conflation_is() and their
+    * getters: the manager keeps how each handler gets the route changes,
+    * and how many of them conflation spared it.
+    * Managers that don't hold changes back deliver them one at a time.
+    */
+   virtual void route_batches_is(fib_handler * handler, bool batches);
+   virtual bool route_batches(fib_handler const * handler) const;
+   virtual void route_conflation_is(fib_handler * handler, bool conflation);
+   virtual bool route_conflation(fib_handler const * handler) const;
+   virtual uint64_t route_changes_conflated(
+         fib_handler const * handler) const;
+#endif
    friend class fib_handler;
+   friend class fib_route_waiter;
  private:
    DA_SDK_DISALLOW_COPY_CTOR(fib_mgr);
 };
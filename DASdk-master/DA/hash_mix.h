@@ -4,6 +4,10 @@
 #ifndef DA_SDK_HASH_MIX
 #define DA_SDK_HASH_MIX
 
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include <DA/base.h>
 
 namespace DA {
@@ -11,12 +15,68 @@ namespace DA {
 /**
  * This is a helper class for incrementally-computed implementation of Bob
  * Jenkins' one-at-a-time hash, in C++.  It's needed in hash function.
+ *
+ * mix() and final_mix() go a byte at a time.  Keys that are made of a few
+ * words, such as addresses, are better hashed with mix_word(), which mixes
+ * 64 bits per step, followed by final_mix_word().  The hash() methods of
+ * the SDK's types use fields(), which does so for each of their fields.
  */
 
 class DA_SDK_PUBLIC hash_mix {
  public:
    static uint32_t mix( uint8_t * key, int len, uint32_t seed );
    static uint32_t final_mix( uint32_t seed );
+
+   /// Mixes a 64-bit word into the running hash `seed'.
+   static uint64_t mix_word( uint64_t word, uint64_t seed );
+   /// Finishes a hash computed with mix_word(), and folds it to 32 bits.
+   static uint32_t final_mix_word( uint64_t seed );
+
+#ifndef SWIG
+   /**
+    * Hashes the passed fields in order, and finishes the hash.
+    *
+    * Fields are hashed by value rather than as raw memory, so that padding
+    * and unused bytes don't make equal values hash differently:
+    * - integers, enums and floating point numbers are mixed as one word,
+    * - types that have a hash() method, such as the SDK's, through it,
+    * - strings eight bytes at a time,
+    * - containers element by element, in order, except for unordered ones
+    *   whose elements are combined regardless of their order.
+    */
+   template <typename... Fields>
+   static uint32_t fields( Fields const &... values );
+
+   /// Mixes a single field into `seed', the way fields() does.
+   template <typename T>
+   static uint64_t mix_field( T const & value, uint64_t seed );
+
+ private:
+   // The `int' overloads are preferred over the `long' ones, which only
+   // catch containers.
+   static uint64_t mix_value( std::string const & value, uint64_t seed, int );
+   template <typename A, typename B>
+   static uint64_t mix_value( std::pair<A, B> const & value, uint64_t seed, int );
+   template <typename T>
+   static auto mix_value( T const & value, uint64_t seed, int )
+      -> decltype(uint64_t(value.hash()));
+   template <typename T>
+   static typename std::enable_if<std::is_integral<T>::value ||
+                                  std::is_enum<T>::value, uint64_t>::type
+   mix_value( T value, uint64_t seed, int );
+   template <typename T>
+   static typename std::enable_if<std::is_floating_point<T>::value,
+                                  uint64_t>::type
+   mix_value( T value, uint64_t seed, int );
+   template <typename T>
+   static auto mix_value( T const & values, uint64_t seed, long )
+      -> decltype(uint64_t(values.begin() != values.end()));
+   template <typename T>
+   static auto mix_elements( T const & values, uint64_t seed, int )
+      -> decltype(typename T::hasher(), uint64_t());
+   template <typename T>
+   static uint64_t mix_elements( T const & values, uint64_t seed, long );
+#endif
 };
 
 }
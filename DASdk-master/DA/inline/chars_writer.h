@@ -0,0 +1,158 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef INLINE_CHARS_WRITER_H
+#define INLINE_CHARS_WRITER_H
+
+#include <stdio.h>
+#include <string.h>
+
+namespace DA {
+
+inline chars_writer::chars_writer(char * first, char * last)
+      : pos_(first), last_(last) {
+}
+
+inline char * chars_writer::end() const {
+   return pos_;
+}
+
+inline void chars_writer::write(char const * str, size_t len) {
+   if (!pos_ || size_t(last_ - pos_) < len) {
+      pos_ = 0;
+      return;
+   }
+   memcpy(pos_, str, len);
+   pos_ += len;
+}
+
+inline chars_writer & chars_writer::operator<<(char c) {
+   if (!pos_ || pos_ == last_) {
+      pos_ = 0;
+   } else {
+      *pos_++ = c;
+   }
+   return *this;
+}
+
+inline chars_writer & chars_writer::operator<<(char const * str) {
+   write(str, strlen(str));
+   return *this;
+}
+
+inline chars_writer & chars_writer::operator<<(std::string const & str) {
+   write(str.data(), str.size());
+   return *this;
+}
+
+inline void chars_writer::write_decimal(uint64_t value) {
+   static char const digit_pairs[] =
+      "00010203040506070809101112131415161718192021222324252627282930313233343536"
+      "37383940414243444546474849505152535455565758596061626364656667686970717273"
+      "7475767778798081828384858687888990919293949596979899";
+   char buf[20];
+   char * p = buf + sizeof(buf);
+   // Two digits at a time, from the end.
+   while (value >= 100) {
+      p -= 2;
+      memcpy(p, digit_pairs + 2 * (value % 100), 2);
+      value /= 100;
+   }
+   if (value >= 10) {
+      p -= 2;
+      memcpy(p, digit_pairs + 2 * value, 2);
+   } else {
+      *--p = '0' + value;
+   }
+   write(p, buf + sizeof(buf) - p);
+}
+
+inline void chars_writer::write_hex(uint64_t value) {
+   char buf[16];
+   char * p = buf + sizeof(buf);
+   do {
+      *--p = "0123456789abcdef"[value & 0xf];
+      value >>= 4;
+   } while (value);
+   write(p, buf + sizeof(buf) - p);
+}
+
+inline void chars_writer::write_double(double value) {
+   // An std::ostream's default format.  snprintf() into a local buffer
+   // doesn't allocate.
+   char buf[32];
+   int len = snprintf(buf, sizeof(buf), "%g", value);
+   write(buf, len);
+}
+
+#ifndef SWIG
+
+template <typename T>
+inline typename std::enable_if<!std::is_array<T>::value, chars_writer &>::type
+chars_writer::operator<<(T const & value) {
+   write_value(value, 0);
+   return *this;
+}
+
+template <typename T>
+inline std::string chars_writer::to_string(T const & value) {
+   // Most values fit on the stack, and the others are formatted again
+   // into a big enough string.
+   char buf[256];
+   char * end = value.to_chars(buf, buf + sizeof(buf));
+   if (end) {
+      return std::string(buf, end);
+   }
+   std::string str(2 * sizeof(buf), '\0');
+   while (!(end = value.to_chars(&str[0], &str[0] + str.size()))) {
+      str.resize(2 * str.size());
+   }
+   str.resize(end - &str[0]);
+   return str;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value &&
+                               std::is_unsigned<T>::value>::type
+chars_writer::write_value(T value, int) {
+   write_decimal(value);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value &&
+                               std::is_signed<T>::value>::type
+chars_writer::write_value(T value, int) {
+   if (value < 0) {
+      *this << '-';
+      // Negate as unsigned, which works for the most negative value too.
+      write_decimal(0 - static_cast<uint64_t>(value));
+   } else {
+      write_decimal(value);
+   }
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+chars_writer::write_value(T value, int) {
+   write_double(value);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_enum<T>::value>::type
+chars_writer::write_value(T value, int) {
+   *this << enum_name(value);
+}
+
+template <typename T>
+inline auto chars_writer::write_value(T const & value, long)
+      -> decltype(value.to_chars((char *)0, (char *)0), void()) {
+   if (pos_) {
+      pos_ = value.to_chars(pos_, last_);
+   }
+}
+
+#endif // SWIG
+
+}
+
+#endif // INLINE_CHARS_WRITER_H
@@ -9,6 +9,45 @@ namespace DA {
 inline event_loop_handler::~event_loop_handler() {
 }
 
+inline int
+loop_histogram_t::bucket(uint64_t nanoseconds) {
+   if(nanoseconds < (1 << linear_bits)) {
+      return int(nanoseconds);
+   }
+   // The position of the highest bit picks the group, the next
+   // `linear_bits' bits the bucket within that group.
+   int log2 = 63 - __builtin_clzll(nanoseconds);
+   int shift = log2 - linear_bits;
+   int sub_bucket = int(nanoseconds >> shift) & ((1 << linear_bits) - 1);
+   return ((shift + 1) << linear_bits) + sub_bucket;
+}
+
+inline void
+loop_histogram_t::record(seconds_t value) {
+   uint64_t nanoseconds = value > 0 ? uint64_t(value * 1e9) : 0;
+   buckets_[bucket(nanoseconds)]++;
+   count_++;
+   total_ns_ += nanoseconds;
+   if(nanoseconds > max_ns_) {
+      max_ns_ = nanoseconds;
+   }
+}
+
+inline uint64_t
+loop_histogram_t::count() const {
+   return count_;
+}
+
+inline seconds_t
+loop_histogram_t::total() const {
+   return total_ns_ / 1e9;
+}
+
+inline seconds_t
+loop_histogram_t::max() const {
+   return max_ns_ / 1e9;
+}
+
 }
 
 #endif // DA_INLINE_EVENT_LOOP_H
@@ -8,5 +8,29 @@ inline fib_mgr * fib_handler::get_fib_mgr() const {
    return mgr_;
 }
 
+inline void fib_handler::route_batches_is(bool batches) {
+   if (mgr_) {
+      mgr_->route_batches_is(this, batches);
+   }
+}
+
+inline bool fib_handler::route_batches() const {
+   return mgr_ && mgr_->route_batches(this);
+}
+
+inline void fib_handler::route_conflation_is(bool conflation) {
+   if (mgr_) {
+      mgr_->route_conflation_is(this, conflation);
+   }
+}
+
+inline bool fib_handler::route_conflation() const {
+   return mgr_ && mgr_->route_conflation(this);
+}
+
+inline uint64_t fib_handler::route_changes_conflated() const {
+   return mgr_ ? mgr_->route_changes_conflated(this) : 0;
+}
+
 #endif // INLINE_FIB_H
 
@@ -4,6 +4,8 @@
 #ifndef INLINE_HASH_MIX_H
 #define INLINE_HASH_MIX_H
 
+#include <string.h>
+
 namespace DA {
 
 inline uint32_t hash_mix::mix( uint8_t * key, int len, uint32_t seed ) {
@@ -24,6 +26,124 @@ inline uint32_t hash_mix::final_mix( uint32_t seed ) {
    return seed;
 }
 
+inline uint64_t hash_mix::mix_word( uint64_t word, uint64_t seed ) {
+   // One round of xxHash64: multiply, rotate, multiply.
+   seed += word * 0xc2b2ae3d27d4eb4fULL;
+   seed = (seed << 31) | (seed >> 33);
+   seed *= 0x9e3779b185ebca87ULL;
+   return seed;
+}
+
+inline uint32_t hash_mix::final_mix_word( uint64_t seed ) {
+   // MurmurHash3's 64-bit finalizer, so that every input bit affects the
+   // low bits that hash tables use to pick a bucket.
+   seed ^= seed >> 33;
+   seed *= 0xff51afd7ed558ccdULL;
+   seed ^= seed >> 33;
+   seed *= 0xc4ceb9fe1a85ec53ULL;
+   seed ^= seed >> 33;
+   return uint32_t(seed);
+}
+
+#ifndef SWIG
+
+template <typename... Fields>
+inline uint32_t hash_mix::fields( Fields const &... values ) {
+   uint64_t seed = 0;
+   // Braced initializers are evaluated in order, which mixes the fields in
+   // the order they were passed.
+   int expand[] = { 0, (seed = mix_field(values, seed), 0)... };
+   (void)expand;
+   return final_mix_word(seed);
+}
+
+template <typename T>
+inline uint64_t hash_mix::mix_field( T const & value, uint64_t seed ) {
+   return mix_value(value, seed, 0);
+}
+
+inline uint64_t hash_mix::mix_value( std::string const & value, uint64_t seed,
+                                     int ) {
+   char const * bytes = value.data();
+   size_t len = value.size();
+   for (; len >= sizeof(uint64_t); bytes += sizeof(uint64_t),
+                                   len -= sizeof(uint64_t)) {
+      uint64_t word;
+      memcpy(&word, bytes, sizeof(word));
+      seed = mix_word(word, seed);
+   }
+   // Assemble the tail in a register: memcpy()ing it into a zeroed word
+   // would stall on store forwarding when loading the word back.
+   uint64_t tail = 0;
+   for (size_t i = 0; i < len; ++i) {
+      tail |= uint64_t(uint8_t(bytes[i])) << (8 * i);
+   }
+   seed = mix_word(tail, seed);
+   return mix_word(value.size(), seed);
+}
+
+template <typename A, typename B>
+inline uint64_t hash_mix::mix_value( std::pair<A, B> const & value,
+                                     uint64_t seed, int ) {
+   return mix_field(value.second, mix_field(value.first, seed));
+}
+
+template <typename T>
+inline auto hash_mix::mix_value( T const & value, uint64_t seed, int )
+      -> decltype(uint64_t(value.hash())) {
+   return mix_word(value.hash(), seed);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value ||
+                               std::is_enum<T>::value, uint64_t>::type
+hash_mix::mix_value( T value, uint64_t seed, int ) {
+   return mix_word(static_cast<uint64_t>(value), seed);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, uint64_t>::type
+hash_mix::mix_value( T value, uint64_t seed, int ) {
+   // 0.0 and -0.0 compare equal, so they must hash the same.
+   double d = value == 0 ? 0.0 : double(value);
+   uint64_t word;
+   memcpy(&word, &d, sizeof(word));
+   return mix_word(word, seed);
+}
+
+template <typename T>
+inline auto hash_mix::mix_value( T const & values, uint64_t seed, long )
+      -> decltype(uint64_t(values.begin() != values.end())) {
+   return mix_elements(values, seed, 0);
+}
+
+template <typename T>
+inline auto hash_mix::mix_elements( T const & values, uint64_t seed, int )
+      -> decltype(typename T::hasher(), uint64_t()) {
+   // Equal unordered containers may iterate in different orders, so add
+   // up the hashes of the elements instead of chaining them.
+   uint64_t sum = 0;
+   uint64_t count = 0;
+   for (auto it = values.begin(); it != values.end(); ++it) {
+      sum += final_mix_word(mix_field(*it, 0));
+      ++count;
+   }
+   return mix_word(count, mix_word(sum, seed));
+}
+
+template <typename T>
+inline uint64_t hash_mix::mix_elements( T const & values, uint64_t seed, long ) {
+   // Not all containers have a size(), e.g. std::forward_list.
+   uint64_t count = 0;
+   for (auto it = values.begin(); it != values.end(); ++it) {
+      seed = mix_field(*it, seed);
+      ++count;
+   }
+   return mix_word(count, seed);
+}
+
+#endif // SWIG
+
 }
 
 #endif // INLINE_HASH_MIX_H
@@ -10,6 +10,30 @@ inline mac_table_mgr * mac_table_handler::get_mac_table_mgr() const {
    return mgr_;
 }
 
+inline void mac_table_handler::mac_entry_batches_is(bool batches) {
+   if (mgr_) {
+      mgr_->mac_entry_batches_is(this, batches);
+   }
+}
+
+inline bool mac_table_handler::mac_entry_batches() const {
+   return mgr_ && mgr_->mac_entry_batches(this);
+}
+
+inline void mac_table_handler::mac_entry_conflation_is(bool conflation) {
+   if (mgr_) {
+      mgr_->mac_entry_conflation_is(this, conflation);
+   }
+}
+
+inline bool mac_table_handler::mac_entry_conflation() const {
+   return mgr_ && mgr_->mac_entry_conflation(this);
+}
+
+inline uint64_t mac_table_handler::mac_entry_changes_conflated() const {
+   return mgr_ ? mgr_->mac_entry_changes_conflated(this) : 0;
+}
+
 }
 
 #endif // INLINE_MAC_TABLE_H
@@ -8,4 +8,30 @@ inline neighbor_table_mgr *neighbor_table_handler::get_neighbor_table_mgr() cons
    return mgr_;
 }
 
+inline void neighbor_table_handler::neighbor_entry_batches_is(bool batches) {
+   if (mgr_) {
+      mgr_->neighbor_entry_batches_is(this, batches);
+   }
+}
+
+inline bool neighbor_table_handler::neighbor_entry_batches() const {
+   return mgr_ && mgr_->neighbor_entry_batches(this);
+}
+
+inline void
+neighbor_table_handler::neighbor_entry_conflation_is(bool conflation) {
+   if (mgr_) {
+      mgr_->neighbor_entry_conflation_is(this, conflation);
+   }
+}
+
+inline bool neighbor_table_handler::neighbor_entry_conflation() const {
+   return mgr_ && mgr_->neighbor_entry_conflation(this);
+}
+
+inline uint64_t
+neighbor_table_handler::neighbor_entry_changes_conflated() const {
+   return mgr_ ? mgr_->neighbor_entry_changes_conflated(this) : 0;
+}
+
 #endif // INLINE_NEIGHBOR_TABLE_H
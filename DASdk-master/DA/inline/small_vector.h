@@ -0,0 +1,321 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef INLINE_SMALL_VECTOR_H
+#define INLINE_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace DA {
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector()
+      : data_(inline_data()), size_(0), capacity_(N) {
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(small_vector const & other)
+      : data_(inline_data()), size_(0), capacity_(N) {
+   reserve(other.size_);
+   std::uninitialized_copy(other.begin(), other.end(), data_);
+   size_ = other.size_;
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(small_vector && other) noexcept
+      : data_(inline_data()), size_(0), capacity_(N) {
+   steal(other);
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::small_vector(std::initializer_list<T> values)
+      : data_(inline_data()), size_(0), capacity_(N) {
+   reserve(values.size());
+   std::uninitialized_copy(values.begin(), values.end(), data_);
+   size_ = values.size();
+}
+
+template <typename T, size_t N>
+template <typename InputIterator>
+inline small_vector<T, N>::small_vector(InputIterator first, InputIterator last)
+      : data_(inline_data()), size_(0), capacity_(N) {
+   for (; first != last; ++first) {
+      push_back(*first);
+   }
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N>::~small_vector() {
+   release();
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &
+small_vector<T, N>::operator=(small_vector const & other) {
+   if (this != &other) {
+      clear();
+      reserve(other.size_);
+      std::uninitialized_copy(other.begin(), other.end(), data_);
+      size_ = other.size_;
+   }
+   return *this;
+}
+
+template <typename T, size_t N>
+inline small_vector<T, N> &
+small_vector<T, N>::operator=(small_vector && other) noexcept {
+   if (this != &other) {
+      release();
+      data_ = inline_data();
+      size_ = 0;
+      capacity_ = N;
+      steal(other);
+   }
+   return *this;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::begin() {
+   return data_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::end() {
+   return data_ + size_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_iterator
+small_vector<T, N>::begin() const {
+   return data_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_iterator
+small_vector<T, N>::end() const {
+   return data_ + size_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_iterator
+small_vector<T, N>::cbegin() const {
+   return data_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::const_iterator
+small_vector<T, N>::cend() const {
+   return data_ + size_;
+}
+
+template <typename T, size_t N>
+inline size_t
+small_vector<T, N>::size() const {
+   return size_;
+}
+
+template <typename T, size_t N>
+inline bool
+small_vector<T, N>::empty() const {
+   return !size_;
+}
+
+template <typename T, size_t N>
+inline size_t
+small_vector<T, N>::capacity() const {
+   return capacity_;
+}
+
+template <typename T, size_t N>
+inline T &
+small_vector<T, N>::operator[](size_t index) {
+   return data_[index];
+}
+
+template <typename T, size_t N>
+inline T const &
+small_vector<T, N>::operator[](size_t index) const {
+   return data_[index];
+}
+
+template <typename T, size_t N>
+inline T &
+small_vector<T, N>::front() {
+   return data_[0];
+}
+
+template <typename T, size_t N>
+inline T const &
+small_vector<T, N>::front() const {
+   return data_[0];
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::push_back(T const & value) {
+   if (size_ == capacity_) {
+      // `value' may be one of our elements, so copy it before growing.
+      T copy(value);
+      grow(2 * capacity_);
+      new (data_ + size_) T(std::move(copy));
+   } else {
+      new (data_ + size_) T(value);
+   }
+   ++size_;
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::push_back(T && value) {
+   if (size_ == capacity_) {
+      T moved(std::move(value));
+      grow(2 * capacity_);
+      new (data_ + size_) T(std::move(moved));
+   } else {
+      new (data_ + size_) T(std::move(value));
+   }
+   ++size_;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::insert(const_iterator pos, T const & value) {
+   size_t index = pos - data_;
+   T copy(value);
+   if (size_ == capacity_) {
+      grow(2 * capacity_);
+   }
+   if (index == size_) {
+      new (data_ + size_) T(std::move(copy));
+   } else {
+      // Shift the tail up by one, starting with the last element, which
+      // moves into uninitialized storage.
+      new (data_ + size_) T(std::move(data_[size_ - 1]));
+      std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+      data_[index] = std::move(copy);
+   }
+   ++size_;
+   return data_ + index;
+}
+
+template <typename T, size_t N>
+inline typename small_vector<T, N>::iterator
+small_vector<T, N>::erase(const_iterator first, const_iterator last) {
+   T * dst = data_ + (first - data_);
+   if (first == last) {
+      // Moving the tail onto itself could leave it in a moved-from state.
+      return dst;
+   }
+   T * new_end = std::move(data_ + (last - data_), data_ + size_, dst);
+   for (T * p = new_end; p != data_ + size_; ++p) {
+      p->~T();
+   }
+   size_ = new_end - data_;
+   return dst;
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::remove(T const & value) {
+   // `value' may be one of our elements, which remove() would overwrite.
+   T copy(value);
+   erase(std::remove(begin(), end(), copy), end());
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::clear() {
+   erase(begin(), end());
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::reserve(size_t capacity) {
+   if (capacity > capacity_) {
+      grow(std::max(capacity, 2 * capacity_));
+   }
+}
+
+template <typename T, size_t N>
+inline bool
+small_vector<T, N>::operator==(small_vector const & other) const {
+   return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, size_t N>
+inline bool
+small_vector<T, N>::operator!=(small_vector const & other) const {
+   return !operator==(other);
+}
+
+template <typename T, size_t N>
+inline bool
+small_vector<T, N>::operator<(small_vector const & other) const {
+   return std::lexicographical_compare(begin(), end(),
+                                       other.begin(), other.end());
+}
+
+template <typename T, size_t N>
+inline T *
+small_vector<T, N>::inline_data() {
+   return reinterpret_cast<T *>(&storage_);
+}
+
+template <typename T, size_t N>
+inline bool
+small_vector<T, N>::is_inline() const {
+   return data_ == reinterpret_cast<T const *>(&storage_);
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::grow(size_t capacity) {
+   T * data = static_cast<T *>(::operator new(capacity * sizeof(T)));
+   for (size_t i = 0; i < size_; ++i) {
+      new (data + i) T(std::move(data_[i]));
+      data_[i].~T();
+   }
+   if (!is_inline()) {
+      ::operator delete(data_);
+   }
+   data_ = data;
+   capacity_ = capacity;
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::release() {
+   for (size_t i = 0; i < size_; ++i) {
+      data_[i].~T();
+   }
+   if (!is_inline()) {
+      ::operator delete(data_);
+   }
+}
+
+template <typename T, size_t N>
+inline void
+small_vector<T, N>::steal(small_vector & other) {
+   if (other.is_inline()) {
+      for (size_t i = 0; i < other.size_; ++i) {
+         new (data_ + i) T(std::move(other.data_[i]));
+         other.data_[i].~T();
+      }
+   } else {
+      data_ = other.data_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inline_data();
+      other.capacity_ = N;
+   }
+   size_ = other.size_;
+   other.size_ = 0;
+}
+
+}
+
+#endif // INLINE_SMALL_VECTOR_H
@@ -0,0 +1,28 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef DA_INLINE_TIMER_H
+#define DA_INLINE_TIMER_H
+
+namespace DA {
+
+inline timer_handle_t::timer_handle_t() : slot_(0), generation_(0) {
+}
+
+inline timer_handle_t::timer_handle_t(uint32_t slot, uint32_t generation)
+   : slot_(slot), generation_(generation) {
+}
+
+inline bool
+timer_handle_t::operator==(timer_handle_t const & other) const {
+   return slot_ == other.slot_ && generation_ == other.generation_;
+}
+
+inline bool
+timer_handle_t::operator!=(timer_handle_t const & other) const {
+   return !operator==(other);
+}
+
+}
+
+#endif // DA_INLINE_TIMER_H
@@ -6,101 +6,131 @@
 
 namespace DA {
 
+inline char const *
+enum_name(acl_type_t enum_val) {
+   switch (enum_val) {
+      case ACL_TYPE_NULL:
+         return "ACL_TYPE_NULL";
+      case ACL_TYPE_IPV4:
+         return "ACL_TYPE_IPV4";
+      case ACL_TYPE_IPV6:
+         return "ACL_TYPE_IPV6";
+      case ACL_TYPE_ETH:
+         return "ACL_TYPE_ETH";
+      case ACL_TYPE_MPLS:
+         return "ACL_TYPE_MPLS";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const acl_type_t & enum_val) {
-   if (enum_val==ACL_TYPE_NULL) {
-      os << "ACL_TYPE_NULL";
-   } else if (enum_val==ACL_TYPE_IPV4) {
-      os << "ACL_TYPE_IPV4";
-   } else if (enum_val==ACL_TYPE_IPV6) {
-      os << "ACL_TYPE_IPV6";
-   } else if (enum_val==ACL_TYPE_ETH) {
-      os << "ACL_TYPE_ETH";
-   } else if (enum_val==ACL_TYPE_MPLS) {
-      os << "ACL_TYPE_MPLS";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(acl_direction_t enum_val) {
+   switch (enum_val) {
+      case ACL_DIRECTION_NULL:
+         return "ACL_DIRECTION_NULL";
+      case ACL_IN:
+         return "ACL_IN";
+      case ACL_OUT:
+         return "ACL_OUT";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const acl_direction_t & enum_val) {
-   if (enum_val==ACL_DIRECTION_NULL) {
-      os << "ACL_DIRECTION_NULL";
-   } else if (enum_val==ACL_IN) {
-      os << "ACL_IN";
-   } else if (enum_val==ACL_OUT) {
-      os << "ACL_OUT";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(acl_range_operator_t enum_val) {
+   switch (enum_val) {
+      case ACL_RANGE_NULL:
+         return "ACL_RANGE_NULL";
+      case ACL_RANGE_ANY:
+         return "ACL_RANGE_ANY";
+      case ACL_RANGE_EQ:
+         return "ACL_RANGE_EQ";
+      case ACL_RANGE_GT:
+         return "ACL_RANGE_GT";
+      case ACL_RANGE_LT:
+         return "ACL_RANGE_LT";
+      case ACL_RANGE_NEQ:
+         return "ACL_RANGE_NEQ";
+      case ACL_RANGE_BETWEEN:
+         return "ACL_RANGE_BETWEEN";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const acl_range_operator_t & enum_val) {
-   if (enum_val==ACL_RANGE_NULL) {
-      os << "ACL_RANGE_NULL";
-   } else if (enum_val==ACL_RANGE_ANY) {
-      os << "ACL_RANGE_ANY";
-   } else if (enum_val==ACL_RANGE_EQ) {
-      os << "ACL_RANGE_EQ";
-   } else if (enum_val==ACL_RANGE_GT) {
-      os << "ACL_RANGE_GT";
-   } else if (enum_val==ACL_RANGE_LT) {
-      os << "ACL_RANGE_LT";
-   } else if (enum_val==ACL_RANGE_NEQ) {
-      os << "ACL_RANGE_NEQ";
-   } else if (enum_val==ACL_RANGE_BETWEEN) {
-      os << "ACL_RANGE_BETWEEN";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(acl_action_t enum_val) {
+   switch (enum_val) {
+      case ACL_ACTION_NULL:
+         return "ACL_ACTION_NULL";
+      case ACL_PERMIT:
+         return "ACL_PERMIT";
+      case ACL_DENY:
+         return "ACL_DENY";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const acl_action_t & enum_val) {
-   if (enum_val==ACL_ACTION_NULL) {
-      os << "ACL_ACTION_NULL";
-   } else if (enum_val==ACL_PERMIT) {
-      os << "ACL_PERMIT";
-   } else if (enum_val==ACL_DENY) {
-      os << "ACL_DENY";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(acl_tcp_flag_t enum_val) {
+   switch (enum_val) {
+      case ACL_TCP_NULL:
+         return "ACL_TCP_NULL";
+      case ACL_TCP_FIN:
+         return "ACL_TCP_FIN";
+      case ACL_TCP_SYN:
+         return "ACL_TCP_SYN";
+      case ACL_TCP_RST:
+         return "ACL_TCP_RST";
+      case ACL_TCP_PSH:
+         return "ACL_TCP_PSH";
+      case ACL_TCP_ACK:
+         return "ACL_TCP_ACK";
+      case ACL_TCP_URG:
+         return "ACL_TCP_URG";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const acl_tcp_flag_t & enum_val) {
-   if (enum_val==ACL_TCP_NULL) {
-      os << "ACL_TCP_NULL";
-   } else if (enum_val==ACL_TCP_FIN) {
-      os << "ACL_TCP_FIN";
-   } else if (enum_val==ACL_TCP_SYN) {
-      os << "ACL_TCP_SYN";
-   } else if (enum_val==ACL_TCP_RST) {
-      os << "ACL_TCP_RST";
-   } else if (enum_val==ACL_TCP_PSH) {
-      os << "ACL_TCP_PSH";
-   } else if (enum_val==ACL_TCP_ACK) {
-      os << "ACL_TCP_ACK";
-   } else if (enum_val==ACL_TCP_URG) {
-      os << "ACL_TCP_URG";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -160,23 +190,22 @@ acl_ttl_spec_t::operator<(acl_ttl_spec_t const & other) const {
 
 inline uint32_t
 acl_ttl_spec_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&oper_,
-              sizeof(acl_range_operator_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ttl_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(oper_, ttl_);
+}
+
+inline char *
+acl_ttl_spec_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "acl_ttl_spec_t(";
+   out << "oper=" << oper_;
+   out << ", ttl=" << ttl_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 acl_ttl_spec_t::to_string() const {
-   std::ostringstream ss;
-   ss << "acl_ttl_spec_t(";
-   ss << "oper=" << oper_;
-   ss << ", ttl=" << ttl_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -221,6 +250,13 @@ acl_port_spec_t::ports_is(std::list<uint16_t> const & ports) {
    ports_ = ports;
 }
 
+#ifndef SWIG
+inline void
+acl_port_spec_t::ports_is(std::list<uint16_t> && ports) {
+   ports_ = std::move(ports);
+}
+#endif
+
 inline void
 acl_port_spec_t::port_set(uint16_t const & ports) {
    ports_.push_front(ports);
@@ -254,35 +290,32 @@ acl_port_spec_t::operator<(acl_port_spec_t const & other) const {
 
 inline uint32_t
 acl_port_spec_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&oper_,
-              sizeof(acl_range_operator_t), ret);
-   for (auto it=ports_.cbegin(); it!=ports_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(uint16_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(oper_, ports_);
 }
 
-inline std::string
-acl_port_spec_t::to_string() const {
-   std::ostringstream ss;
-   ss << "acl_port_spec_t(";
-   ss << "oper=" << oper_;
-   ss << ", ports=" <<"'";
+inline char *
+acl_port_spec_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "acl_port_spec_t(";
+   out << "oper=" << oper_;
+   out << ", ports=" <<"'";
    bool first_ports = true;
    for (auto it=ports_.cbegin(); it!=ports_.cend(); ++it) {
       if (first_ports) {
-         ss << (*it);
+         out << (*it);
          first_ports = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+acl_port_spec_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -382,22 +415,22 @@ acl_key_t::operator!=(acl_key_t const & other) const {
 
 inline uint32_t
 acl_key_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(acl_name_);
-   ret = hash_mix::mix((uint8_t *)&acl_type_,
-              sizeof(acl_type_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(acl_name_, acl_type_);
+}
+
+inline char *
+acl_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "acl_key_t(";
+   out << "acl_name='" << acl_name_ << "'";
+   out << ", acl_type=" << acl_type_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 acl_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "acl_key_t(";
-   ss << "acl_name='" << acl_name_ << "'";
-   ss << ", acl_type=" << acl_type_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -444,26 +477,23 @@ acl_rule_base_t::tracked_is(bool tracked) {
 
 inline uint32_t
 acl_rule_base_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&action_,
-              sizeof(acl_action_t), ret);
-   ret = hash_mix::mix((uint8_t *)&log_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&tracked_,
-              sizeof(bool), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(action_, log_, tracked_);
+}
+
+inline char *
+acl_rule_base_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "acl_rule_base_t(";
+   out << "action=" << action_;
+   out << ", log=" << log_;
+   out << ", tracked=" << tracked_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 acl_rule_base_t::to_string() const {
-   std::ostringstream ss;
-   ss << "acl_rule_base_t(";
-   ss << "action=" << action_;
-   ss << ", log=" << log_;
-   ss << ", tracked=" << tracked_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -590,7 +620,7 @@ acl_rule_ip_t::nexthop_group() const {
 
 inline void
 acl_rule_ip_t::nexthop_group_is(std::string nexthop_group) {
-   nexthop_group_ = nexthop_group;
+   nexthop_group_ = std::move(nexthop_group);
 }
 
 inline uint16_t
@@ -747,73 +777,44 @@ acl_rule_ip_t::operator<(acl_rule_ip_t const & other) const {
 
 inline uint32_t
 acl_rule_ip_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&vlan_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vlan_mask_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&inner_vlan_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&inner_vlan_mask_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_protocol_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ttl_,
-              sizeof(acl_ttl_spec_t), ret);
-   ret = hash_mix::mix((uint8_t *)&source_addr_,
-              sizeof(ip_addr_mask_t), ret);
-   ret = hash_mix::mix((uint8_t *)&destination_addr_,
-              sizeof(ip_addr_mask_t), ret);
-   ret = hash_mix::mix((uint8_t *)&source_port_,
-              sizeof(acl_port_spec_t), ret);
-   ret = hash_mix::mix((uint8_t *)&destination_port_,
-              sizeof(acl_port_spec_t), ret);
-   ret ^= std::hash<std::string>()(nexthop_group_);
-   ret = hash_mix::mix((uint8_t *)&tcp_flags_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&established_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&icmp_type_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&icmp_code_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&priority_value_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::mix((uint8_t *)&priority_mask_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::mix((uint8_t *)&match_fragments_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&match_ip_priority_,
-              sizeof(bool), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(vlan_, vlan_mask_, inner_vlan_, inner_vlan_mask_,
+                           ip_protocol_, ttl_, source_addr_, destination_addr_,
+                           source_port_, destination_port_, nexthop_group_,
+                           tcp_flags_, established_, icmp_type_, icmp_code_,
+                           priority_value_, priority_mask_, match_fragments_,
+                           match_ip_priority_);
+}
+
+inline char *
+acl_rule_ip_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "acl_rule_ip_t(";
+   out << "vlan=" << vlan_;
+   out << ", vlan_mask=" << vlan_mask_;
+   out << ", inner_vlan=" << inner_vlan_;
+   out << ", inner_vlan_mask=" << inner_vlan_mask_;
+   out << ", ip_protocol=" << ip_protocol_;
+   out << ", ttl=" << ttl_;
+   out << ", source_addr=" << source_addr_;
+   out << ", destination_addr=" << destination_addr_;
+   out << ", source_port=" << source_port_;
+   out << ", destination_port=" << destination_port_;
+   out << ", nexthop_group='" << nexthop_group_ << "'";
+   out << ", tcp_flags=" << tcp_flags_;
+   out << ", established=" << established_;
+   out << ", icmp_type=" << icmp_type_;
+   out << ", icmp_code=" << icmp_code_;
+   out << ", priority_value=" << priority_value_;
+   out << ", priority_mask=" << priority_mask_;
+   out << ", match_fragments=" << match_fragments_;
+   out << ", match_ip_priority=" << match_ip_priority_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 acl_rule_ip_t::to_string() const {
-   std::ostringstream ss;
-   ss << "acl_rule_ip_t(";
-   ss << "vlan=" << vlan_;
-   ss << ", vlan_mask=" << vlan_mask_;
-   ss << ", inner_vlan=" << inner_vlan_;
-   ss << ", inner_vlan_mask=" << inner_vlan_mask_;
-   ss << ", ip_protocol=" << ip_protocol_;
-   ss << ", ttl=" << ttl_;
-   ss << ", source_addr=" << source_addr_;
-   ss << ", destination_addr=" << destination_addr_;
-   ss << ", source_port=" << source_port_;
-   ss << ", destination_port=" << destination_port_;
-   ss << ", nexthop_group='" << nexthop_group_ << "'";
-   ss << ", tcp_flags=" << tcp_flags_;
-   ss << ", established=" << established_;
-   ss << ", icmp_type=" << icmp_type_;
-   ss << ", icmp_code=" << icmp_code_;
-   ss << ", priority_value=" << priority_value_;
-   ss << ", priority_mask=" << priority_mask_;
-   ss << ", match_fragments=" << match_fragments_;
-   ss << ", match_ip_priority=" << match_ip_priority_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -928,41 +929,30 @@ acl_rule_eth_t::operator!=(acl_rule_eth_t const & other) const {
 
 inline uint32_t
 acl_rule_eth_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&vlan_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vlan_mask_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&inner_vlan_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&inner_vlan_mask_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&source_addr_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&destination_addr_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&source_mask_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&destination_mask_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(vlan_, vlan_mask_, inner_vlan_, inner_vlan_mask_,
+                           source_addr_, destination_addr_, source_mask_,
+                           destination_mask_);
+}
+
+inline char *
+acl_rule_eth_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "acl_rule_eth_t(";
+   out << "vlan=" << vlan_;
+   out << ", vlan_mask=" << vlan_mask_;
+   out << ", inner_vlan=" << inner_vlan_;
+   out << ", inner_vlan_mask=" << inner_vlan_mask_;
+   out << ", source_addr=" << source_addr_;
+   out << ", destination_addr=" << destination_addr_;
+   out << ", source_mask=" << source_mask_;
+   out << ", destination_mask=" << destination_mask_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 acl_rule_eth_t::to_string() const {
-   std::ostringstream ss;
-   ss << "acl_rule_eth_t(";
-   ss << "vlan=" << vlan_;
-   ss << ", vlan_mask=" << vlan_mask_;
-   ss << ", inner_vlan=" << inner_vlan_;
-   ss << ", inner_vlan_mask=" << inner_vlan_mask_;
-   ss << ", source_addr=" << source_addr_;
-   ss << ", destination_addr=" << destination_addr_;
-   ss << ", source_mask=" << source_mask_;
-   ss << ", destination_mask=" << destination_mask_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
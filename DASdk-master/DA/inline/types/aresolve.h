@@ -33,28 +33,24 @@ aresolve_record_base::last_error() const {
 
 inline uint32_t
 aresolve_record_base::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(qname_);
-   ret = hash_mix::mix((uint8_t *)&last_refresh_,
-              sizeof(seconds_t), ret);
-   ret = hash_mix::mix((uint8_t *)&valid_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&last_error_,
-              sizeof(int), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(qname_, last_refresh_, valid_, last_error_);
+}
+
+inline char *
+aresolve_record_base::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "aresolve_record_base(";
+   out << "qname='" << qname_ << "'";
+   out << ", last_refresh=" << last_refresh_;
+   out << ", valid=" << valid_;
+   out << ", last_error=" << last_error_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 aresolve_record_base::to_string() const {
-   std::ostringstream ss;
-   ss << "aresolve_record_base(";
-   ss << "qname='" << qname_ << "'";
-   ss << ", last_refresh=" << last_refresh_;
-   ss << ", valid=" << valid_;
-   ss << ", last_error=" << last_error_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -77,47 +73,42 @@ aresolve_record_host::addr_v6() const {
 
 inline uint32_t
 aresolve_record_host::hash() const {
-   uint32_t ret = 0;
-   for (auto it=addr_v4_.cbegin(); it!=addr_v4_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(ip_addr_t), ret);
-   }
-   for (auto it=addr_v6_.cbegin(); it!=addr_v6_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(ip_addr_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(addr_v4_, addr_v6_);
 }
 
-inline std::string
-aresolve_record_host::to_string() const {
-   std::ostringstream ss;
-   ss << "aresolve_record_host(";
-   ss << "addr_v4=" <<"'";
+inline char *
+aresolve_record_host::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "aresolve_record_host(";
+   out << "addr_v4=" <<"'";
    bool first_addr_v4 = true;
    for (auto it=addr_v4_.cbegin(); it!=addr_v4_.cend(); ++it) {
       if (first_addr_v4) {
-         ss << (*it);
+         out << (*it);
          first_addr_v4 = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ", addr_v6=" <<"'";
+   out << "'";
+   out << ", addr_v6=" <<"'";
    bool first_addr_v6 = true;
    for (auto it=addr_v6_.cbegin(); it!=addr_v6_.cend(); ++it) {
       if (first_addr_v6) {
-         ss << (*it);
+         out << (*it);
          first_addr_v6 = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+aresolve_record_host::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
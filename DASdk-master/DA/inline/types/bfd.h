@@ -6,45 +6,57 @@
 
 namespace DA {
 
+inline char const *
+enum_name(bfd_session_status_t enum_val) {
+   switch (enum_val) {
+      case BFD_SESSION_STATUS_NULL:
+         return "BFD_SESSION_STATUS_NULL";
+      case BFD_SESSION_STATUS_DOWN:
+         return "BFD_SESSION_STATUS_DOWN";
+      case BFD_SESSION_STATUS_INIT:
+         return "BFD_SESSION_STATUS_INIT";
+      case BFD_SESSION_STATUS_UP:
+         return "BFD_SESSION_STATUS_UP";
+      case BFD_SESSION_STATUS_ADMIN_DOWN:
+         return "BFD_SESSION_STATUS_ADMIN_DOWN";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const bfd_session_status_t & enum_val) {
-   if (enum_val==BFD_SESSION_STATUS_NULL) {
-      os << "BFD_SESSION_STATUS_NULL";
-   } else if (enum_val==BFD_SESSION_STATUS_DOWN) {
-      os << "BFD_SESSION_STATUS_DOWN";
-   } else if (enum_val==BFD_SESSION_STATUS_INIT) {
-      os << "BFD_SESSION_STATUS_INIT";
-   } else if (enum_val==BFD_SESSION_STATUS_UP) {
-      os << "BFD_SESSION_STATUS_UP";
-   } else if (enum_val==BFD_SESSION_STATUS_ADMIN_DOWN) {
-      os << "BFD_SESSION_STATUS_ADMIN_DOWN";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(bfd_session_type_t enum_val) {
+   switch (enum_val) {
+      case BFD_SESSION_TYPE_NULL:
+         return "BFD_SESSION_TYPE_NULL";
+      case BFD_SESSION_TYPE_NORMAL:
+         return "BFD_SESSION_TYPE_NORMAL";
+      case BFD_SESSION_TYPE_MICRO:
+         return "BFD_SESSION_TYPE_MICRO";
+      case BFD_SESSION_TYPE_VXLANTUNNEL:
+         return "BFD_SESSION_TYPE_VXLANTUNNEL";
+      case BFD_SESSION_TYPE_LAGRFC7130:
+         return "BFD_SESSION_TYPE_LAGRFC7130";
+      case BFD_SESSION_TYPE_MICRORFC7130:
+         return "BFD_SESSION_TYPE_MICRORFC7130";
+      case BFD_SESSION_TYPE_MULTIHOP:
+         return "BFD_SESSION_TYPE_MULTIHOP";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const bfd_session_type_t & enum_val) {
-   if (enum_val==BFD_SESSION_TYPE_NULL) {
-      os << "BFD_SESSION_TYPE_NULL";
-   } else if (enum_val==BFD_SESSION_TYPE_NORMAL) {
-      os << "BFD_SESSION_TYPE_NORMAL";
-   } else if (enum_val==BFD_SESSION_TYPE_MICRO) {
-      os << "BFD_SESSION_TYPE_MICRO";
-   } else if (enum_val==BFD_SESSION_TYPE_VXLANTUNNEL) {
-      os << "BFD_SESSION_TYPE_VXLANTUNNEL";
-   } else if (enum_val==BFD_SESSION_TYPE_LAGRFC7130) {
-      os << "BFD_SESSION_TYPE_LAGRFC7130";
-   } else if (enum_val==BFD_SESSION_TYPE_MICRORFC7130) {
-      os << "BFD_SESSION_TYPE_MICRORFC7130";
-   } else if (enum_val==BFD_SESSION_TYPE_MULTIHOP) {
-      os << "BFD_SESSION_TYPE_MULTIHOP";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -58,7 +70,8 @@ inline bfd_session_key_t::bfd_session_key_t() :
 inline bfd_session_key_t::bfd_session_key_t(ip_addr_t ip_addr, std::string vrf,
                                             bfd_session_type_t type,
                                             intf_id_t intf) :
-      ip_addr_(ip_addr), vrf_(vrf), type_(type), intf_(intf) {
+      ip_addr_(ip_addr), vrf_(std::move(vrf)), type_(type),
+      intf_(intf) {
 }
 
 inline ip_addr_t
@@ -110,28 +123,24 @@ bfd_session_key_t::operator<(bfd_session_key_t const & other) const {
 
 inline uint32_t
 bfd_session_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&ip_addr_,
-              sizeof(ip_addr_t), ret);
-   ret ^= std::hash<std::string>()(vrf_);
-   ret = hash_mix::mix((uint8_t *)&type_,
-              sizeof(bfd_session_type_t), ret);
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(ip_addr_, vrf_, type_, intf_);
+}
+
+inline char *
+bfd_session_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "bfd_session_key_t(";
+   out << "ip_addr=" << ip_addr_;
+   out << ", vrf='" << vrf_ << "'";
+   out << ", type=" << type_;
+   out << ", intf=" << intf_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 bfd_session_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "bfd_session_key_t(";
-   ss << "ip_addr=" << ip_addr_;
-   ss << ", vrf='" << vrf_ << "'";
-   ss << ", type=" << type_;
-   ss << ", intf=" << intf_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -180,26 +189,23 @@ bfd_interval_t::operator!=(bfd_interval_t const & other) const {
 
 inline uint32_t
 bfd_interval_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&tx_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&rx_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&mult_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(tx_, rx_, mult_);
+}
+
+inline char *
+bfd_interval_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "bfd_interval_t(";
+   out << "tx=" << tx_;
+   out << ", rx=" << rx_;
+   out << ", mult=" << mult_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 bfd_interval_t::to_string() const {
-   std::ostringstream ss;
-   ss << "bfd_interval_t(";
-   ss << "tx=" << tx_;
-   ss << ", rx=" << rx_;
-   ss << ", mult=" << mult_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -253,23 +259,22 @@ bfd_session_t::operator<(bfd_session_t const & other) const {
 
 inline uint32_t
 bfd_session_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&peer_,
-              sizeof(bfd_session_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&status_,
-              sizeof(bfd_session_status_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(peer_, status_);
+}
+
+inline char *
+bfd_session_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "bfd_session_t(";
+   out << "peer=" << peer_;
+   out << ", status=" << status_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 bfd_session_t::to_string() const {
-   std::ostringstream ss;
-   ss << "bfd_session_t(";
-   ss << "peer=" << peer_;
-   ss << ", status=" << status_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
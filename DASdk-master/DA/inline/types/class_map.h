@@ -32,20 +32,21 @@ class_map_rule_t::operator!=(class_map_rule_t const & other) const {
 
 inline uint32_t
 class_map_rule_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&acl_key_,
-              sizeof(acl_key_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(acl_key_);
+}
+
+inline char *
+class_map_rule_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "class_map_rule_t(";
+   out << "acl_key=" << acl_key_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 class_map_rule_t::to_string() const {
-   std::ostringstream ss;
-   ss << "class_map_rule_t(";
-   ss << "acl_key=" << acl_key_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -85,6 +86,13 @@ class_map_t::rules_is(std::map<uint32_t, class_map_rule_t> const & rules) {
    rules_ = rules;
 }
 
+#ifndef SWIG
+inline void
+class_map_t::rules_is(std::map<uint32_t, class_map_rule_t> && rules) {
+   rules_ = std::move(rules);
+}
+#endif
+
 inline void
 class_map_t::rule_set(uint32_t key, class_map_rule_t const & value) {
    rules_[key] = value;
@@ -108,37 +116,32 @@ class_map_t::operator!=(class_map_t const & other) const {
 
 inline uint32_t
 class_map_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&key_,
-              sizeof(class_map_key_t), ret);
-   for (auto it=rules_.cbegin(); it!=rules_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&it->first,
-                 sizeof(uint32_t), ret);
-      ret = hash_mix::mix((uint8_t *)&it->second,
-                 sizeof(class_map_rule_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(key_, rules_);
 }
 
-inline std::string
-class_map_t::to_string() const {
-   std::ostringstream ss;
-   ss << "class_map_t(";
-   ss << "key=" << key_;
-   ss << ", rules=" <<"'";
+inline char *
+class_map_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "class_map_t(";
+   out << "key=" << key_;
+   out << ", rules=" <<"'";
    bool first_rules = true;
    for (auto it=rules_.cbegin(); it!=rules_.cend(); ++it) {
       if (first_rules) {
-         ss << it->first << "=" << it->second;
+         out << it->first << "=" << it->second;
          first_rules = false;
       } else {
-         ss << "," << it->first << "=" << it->second;
+         out << "," << it->first << "=" << it->second;
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+class_map_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
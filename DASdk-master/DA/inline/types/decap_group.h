@@ -6,15 +6,21 @@
 
 namespace DA {
 
+inline char const *
+enum_name(decap_protocol_type_t enum_val) {
+   switch (enum_val) {
+      case PROTOCOL_TYPE_NULL:
+         return "PROTOCOL_TYPE_NULL";
+      case PROTOCOL_TYPE_GRE:
+         return "PROTOCOL_TYPE_GRE";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const decap_protocol_type_t & enum_val) {
-   if (enum_val==PROTOCOL_TYPE_NULL) {
-      os << "PROTOCOL_TYPE_NULL";
-   } else if (enum_val==PROTOCOL_TYPE_GRE) {
-      os << "PROTOCOL_TYPE_GRE";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -86,25 +92,23 @@ decap_group_t::operator<(decap_group_t const & other) const {
 
 inline uint32_t
 decap_group_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(group_name_);
-   ret = hash_mix::mix((uint8_t *)&destination_addr_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&protocol_type_,
-              sizeof(decap_protocol_type_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(group_name_, destination_addr_, protocol_type_);
+}
+
+inline char *
+decap_group_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "decap_group_t(";
+   out << "group_name='" << group_name_ << "'";
+   out << ", destination_addr=" << destination_addr_;
+   out << ", protocol_type=" << protocol_type_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 decap_group_t::to_string() const {
-   std::ostringstream ss;
-   ss << "decap_group_t(";
-   ss << "group_name='" << group_name_ << "'";
-   ss << ", destination_addr=" << destination_addr_;
-   ss << ", protocol_type=" << protocol_type_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -30,20 +30,21 @@ flow_match_field_set_t::operator<(flow_match_field_set_t const & other) const {
 
 inline uint32_t
 flow_match_field_set_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&match_bitset_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(match_bitset_);
+}
+
+inline char *
+flow_match_field_set_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "flow_match_field_set_t(";
+   out << "match_bitset=" << match_bitset_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 flow_match_field_set_t::to_string() const {
-   std::ostringstream ss;
-   ss << "flow_match_field_set_t(";
-   ss << "match_bitset=" << match_bitset_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -80,6 +81,13 @@ flow_match_t::input_intfs_is(std::set<intf_id_t> const & input_intfs) {
    input_intfs_ = input_intfs;
 }
 
+#ifndef SWIG
+inline void
+flow_match_t::input_intfs_is(std::set<intf_id_t> && input_intfs) {
+   input_intfs_ = std::move(input_intfs);
+}
+#endif
+
 inline void
 flow_match_t::input_intf_set(intf_id_t const & value) {
    input_intfs_.insert(value);
@@ -299,71 +307,47 @@ flow_match_t::operator<(flow_match_t const & other) const {
 
 inline uint32_t
 flow_match_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&match_field_set_,
-              sizeof(flow_match_field_set_t), ret);
-   for (auto it=input_intfs_.cbegin(); it!=input_intfs_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(intf_id_t), ret);
-   }
-   ret = hash_mix::mix((uint8_t *)&eth_src_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_src_mask_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_dst_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_dst_mask_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_type_,
-              sizeof(eth_type_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vlan_id_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vlan_id_mask_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&cos_,
-              sizeof(cos_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_src_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_src_mask_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_dst_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_dst_mask_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
-}
-
-inline std::string
-flow_match_t::to_string() const {
-   std::ostringstream ss;
-   ss << "flow_match_t(";
-   ss << "match_field_set=" << match_field_set_;
-   ss << ", input_intfs=" <<"'";
+   return hash_mix::fields(match_field_set_, input_intfs_, eth_src_, eth_src_mask_,
+                           eth_dst_, eth_dst_mask_, eth_type_, vlan_id_,
+                           vlan_id_mask_, cos_, ip_src_, ip_src_mask_, ip_dst_,
+                           ip_dst_mask_);
+}
+
+inline char *
+flow_match_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "flow_match_t(";
+   out << "match_field_set=" << match_field_set_;
+   out << ", input_intfs=" <<"'";
    bool first_input_intfs = true;
    for (auto it=input_intfs_.cbegin(); it!=input_intfs_.cend(); ++it) {
       if (first_input_intfs) {
-         ss << (*it);
+         out << (*it);
          first_input_intfs = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ", eth_src=" << eth_src_;
-   ss << ", eth_src_mask=" << eth_src_mask_;
-   ss << ", eth_dst=" << eth_dst_;
-   ss << ", eth_dst_mask=" << eth_dst_mask_;
-   ss << ", eth_type=" << eth_type_;
-   ss << ", vlan_id=" << vlan_id_;
-   ss << ", vlan_id_mask=" << vlan_id_mask_;
-   ss << ", cos=" << cos_;
-   ss << ", ip_src=" << ip_src_;
-   ss << ", ip_src_mask=" << ip_src_mask_;
-   ss << ", ip_dst=" << ip_dst_;
-   ss << ", ip_dst_mask=" << ip_dst_mask_;
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ", eth_src=" << eth_src_;
+   out << ", eth_src_mask=" << eth_src_mask_;
+   out << ", eth_dst=" << eth_dst_;
+   out << ", eth_dst_mask=" << eth_dst_mask_;
+   out << ", eth_type=" << eth_type_;
+   out << ", vlan_id=" << vlan_id_;
+   out << ", vlan_id_mask=" << vlan_id_mask_;
+   out << ", cos=" << cos_;
+   out << ", ip_src=" << ip_src_;
+   out << ", ip_src_mask=" << ip_src_mask_;
+   out << ", ip_dst=" << ip_dst_;
+   out << ", ip_dst_mask=" << ip_dst_mask_;
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+flow_match_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -390,20 +374,21 @@ flow_action_set_t::operator!=(flow_action_set_t const & other) const {
 
 inline uint32_t
 flow_action_set_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&action_bitset_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(action_bitset_);
+}
+
+inline char *
+flow_action_set_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "flow_action_set_t(";
+   out << "action_bitset=" << action_bitset_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 flow_action_set_t::to_string() const {
-   std::ostringstream ss;
-   ss << "flow_action_set_t(";
-   ss << "action_bitset=" << action_bitset_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -439,6 +424,13 @@ flow_action_t::output_intfs_is(std::set<intf_id_t> const & output_intfs) {
    output_intfs_ = output_intfs;
 }
 
+#ifndef SWIG
+inline void
+flow_action_t::output_intfs_is(std::set<intf_id_t> && output_intfs) {
+   output_intfs_ = std::move(output_intfs);
+}
+#endif
+
 inline void
 flow_action_t::output_intf_set(intf_id_t const & value) {
    output_intfs_.insert(value);
@@ -534,53 +526,39 @@ flow_action_t::operator!=(flow_action_t const & other) const {
 
 inline uint32_t
 flow_action_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&action_set_,
-              sizeof(flow_action_set_t), ret);
-   for (auto it=output_intfs_.cbegin(); it!=output_intfs_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(intf_id_t), ret);
-   }
-   ret = hash_mix::mix((uint8_t *)&vlan_id_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&cos_,
-              sizeof(cos_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_src_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_dst_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_src_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ip_dst_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(action_set_, output_intfs_, vlan_id_, cos_, eth_src_,
+                           eth_dst_, ip_src_, ip_dst_);
 }
 
-inline std::string
-flow_action_t::to_string() const {
-   std::ostringstream ss;
-   ss << "flow_action_t(";
-   ss << "action_set=" << action_set_;
-   ss << ", output_intfs=" <<"'";
+inline char *
+flow_action_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "flow_action_t(";
+   out << "action_set=" << action_set_;
+   out << ", output_intfs=" <<"'";
    bool first_output_intfs = true;
    for (auto it=output_intfs_.cbegin(); it!=output_intfs_.cend(); ++it) {
       if (first_output_intfs) {
-         ss << (*it);
+         out << (*it);
          first_output_intfs = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ", vlan_id=" << vlan_id_;
-   ss << ", cos=" << cos_;
-   ss << ", eth_src=" << eth_src_;
-   ss << ", eth_dst=" << eth_dst_;
-   ss << ", ip_src=" << ip_src_;
-   ss << ", ip_dst=" << ip_dst_;
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ", vlan_id=" << vlan_id_;
+   out << ", cos=" << cos_;
+   out << ", eth_src=" << eth_src_;
+   out << ", eth_dst=" << eth_dst_;
+   out << ", ip_src=" << ip_src_;
+   out << ", ip_dst=" << ip_dst_;
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+flow_action_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -635,28 +613,24 @@ flow_entry_t::operator!=(flow_entry_t const & other) const {
 
 inline uint32_t
 flow_entry_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(name_);
-   ret = hash_mix::mix((uint8_t *)&match_,
-              sizeof(flow_match_t), ret);
-   ret = hash_mix::mix((uint8_t *)&action_,
-              sizeof(flow_action_t), ret);
-   ret = hash_mix::mix((uint8_t *)&priority_,
-              sizeof(flow_priority_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(name_, match_, action_, priority_);
+}
+
+inline char *
+flow_entry_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "flow_entry_t(";
+   out << "name='" << name_ << "'";
+   out << ", match=" << match_;
+   out << ", action=" << action_;
+   out << ", priority=" << priority_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 flow_entry_t::to_string() const {
-   std::ostringstream ss;
-   ss << "flow_entry_t(";
-   ss << "name='" << name_ << "'";
-   ss << ", match=" << match_;
-   ss << ", action=" << action_;
-   ss << ", priority=" << priority_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -694,23 +668,22 @@ flow_counters_t::operator!=(flow_counters_t const & other) const {
 
 inline uint32_t
 flow_counters_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&bytes_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&packets_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(bytes_, packets_);
+}
+
+inline char *
+flow_counters_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "flow_counters_t(";
+   out << "bytes=" << bytes_;
+   out << ", packets=" << packets_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 flow_counters_t::to_string() const {
-   std::ostringstream ss;
-   ss << "flow_counters_t(";
-   ss << "bytes=" << bytes_;
-   ss << ", packets=" << packets_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -721,43 +694,55 @@ operator<<(std::ostream& os, const flow_counters_t& obj) {
 
 
 
+inline char const *
+enum_name(flow_status_t enum_val) {
+   switch (enum_val) {
+      case FLOW_STATUS_UNKNOWN:
+         return "FLOW_STATUS_UNKNOWN";
+      case FLOW_CREATED:
+         return "FLOW_CREATED";
+      case FLOW_DELETED:
+         return "FLOW_DELETED";
+      case FLOW_REJECTED:
+         return "FLOW_REJECTED";
+      case FLOW_PENDING:
+         return "FLOW_PENDING";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const flow_status_t & enum_val) {
-   if (enum_val==FLOW_STATUS_UNKNOWN) {
-      os << "FLOW_STATUS_UNKNOWN";
-   } else if (enum_val==FLOW_CREATED) {
-      os << "FLOW_CREATED";
-   } else if (enum_val==FLOW_DELETED) {
-      os << "FLOW_DELETED";
-   } else if (enum_val==FLOW_REJECTED) {
-      os << "FLOW_REJECTED";
-   } else if (enum_val==FLOW_PENDING) {
-      os << "FLOW_PENDING";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(flow_rejected_reason_t enum_val) {
+   switch (enum_val) {
+      case FLOW_REJECTED_BAD_MATCH:
+         return "FLOW_REJECTED_BAD_MATCH";
+      case FLOW_REJECTED_BAD_ACTION:
+         return "FLOW_REJECTED_BAD_ACTION";
+      case FLOW_REJECTED_HW_TABLE_FULL:
+         return "FLOW_REJECTED_HW_TABLE_FULL";
+      case FLOW_REJECTED_OTHER:
+         return "FLOW_REJECTED_OTHER";
+      case FLOW_REJECTED_ACTIONS_UNSUPPORTED:
+         return "FLOW_REJECTED_ACTIONS_UNSUPPORTED";
+      case FLOW_REJECTED_TIMEOUT_NOT_SUPPORTED:
+         return "FLOW_REJECTED_TIMEOUT_NOT_SUPPORTED";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const flow_rejected_reason_t & enum_val) {
-   if (enum_val==FLOW_REJECTED_BAD_MATCH) {
-      os << "FLOW_REJECTED_BAD_MATCH";
-   } else if (enum_val==FLOW_REJECTED_BAD_ACTION) {
-      os << "FLOW_REJECTED_BAD_ACTION";
-   } else if (enum_val==FLOW_REJECTED_HW_TABLE_FULL) {
-      os << "FLOW_REJECTED_HW_TABLE_FULL";
-   } else if (enum_val==FLOW_REJECTED_OTHER) {
-      os << "FLOW_REJECTED_OTHER";
-   } else if (enum_val==FLOW_REJECTED_ACTIONS_UNSUPPORTED) {
-      os << "FLOW_REJECTED_ACTIONS_UNSUPPORTED";
-   } else if (enum_val==FLOW_REJECTED_TIMEOUT_NOT_SUPPORTED) {
-      os << "FLOW_REJECTED_TIMEOUT_NOT_SUPPORTED";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
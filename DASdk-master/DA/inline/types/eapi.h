@@ -43,27 +43,32 @@ eapi_response_t::raw_response() const {
    return raw_response_;
 }
 
-inline std::string
-eapi_response_t::to_string() const {
-   std::ostringstream ss;
-   ss << "eapi_response_t(";
-   ss << "success=" << success_;
-   ss << ", error_code=" << error_code_;
-   ss << ", error_message='" << error_message_ << "'";
-   ss << ", responses=" <<"'";
+inline char *
+eapi_response_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "eapi_response_t(";
+   out << "success=" << success_;
+   out << ", error_code=" << error_code_;
+   out << ", error_message='" << error_message_ << "'";
+   out << ", responses=" <<"'";
    bool first_responses = true;
    for (auto it=responses_.cbegin(); it!=responses_.cend(); ++it) {
       if (first_responses) {
-         ss << (*it);
+         out << (*it);
          first_responses = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ", raw_response='" << raw_response_ << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ", raw_response='" << raw_response_ << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+eapi_response_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -6,23 +6,29 @@
 
 namespace DA {
 
+inline char const *
+enum_name(switchport_mode_t enum_val) {
+   switch (enum_val) {
+      case SWITCHPORT_MODE_ACCESS:
+         return "SWITCHPORT_MODE_ACCESS";
+      case SWITCHPORT_MODE_TRUNK:
+         return "SWITCHPORT_MODE_TRUNK";
+      case SWITCHPORT_MODE_DOT1Q_TUNNEL:
+         return "SWITCHPORT_MODE_DOT1Q_TUNNEL";
+      case SWITCHPORT_MODE_TAP:
+         return "SWITCHPORT_MODE_TAP";
+      case SWITCHPORT_MODE_TOOL:
+         return "SWITCHPORT_MODE_TOOL";
+      case SWITCHPORT_MODE_ROUTED:
+         return "SWITCHPORT_MODE_ROUTED";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const switchport_mode_t & enum_val) {
-   if (enum_val==SWITCHPORT_MODE_ACCESS) {
-      os << "SWITCHPORT_MODE_ACCESS";
-   } else if (enum_val==SWITCHPORT_MODE_TRUNK) {
-      os << "SWITCHPORT_MODE_TRUNK";
-   } else if (enum_val==SWITCHPORT_MODE_DOT1Q_TUNNEL) {
-      os << "SWITCHPORT_MODE_DOT1Q_TUNNEL";
-   } else if (enum_val==SWITCHPORT_MODE_TAP) {
-      os << "SWITCHPORT_MODE_TAP";
-   } else if (enum_val==SWITCHPORT_MODE_TOOL) {
-      os << "SWITCHPORT_MODE_TOOL";
-   } else if (enum_val==SWITCHPORT_MODE_ROUTED) {
-      os << "SWITCHPORT_MODE_ROUTED";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -6,78 +6,108 @@
 
 namespace DA {
 
+inline char const *
+enum_name(eth_lag_intf_fallback_type_t enum_val) {
+   switch (enum_val) {
+      case ETH_LAG_INTF_FALLBACK_NULL:
+         return "ETH_LAG_INTF_FALLBACK_NULL";
+      case ETH_LAG_INTF_FALLBACK_NONE:
+         return "ETH_LAG_INTF_FALLBACK_NONE";
+      case ETH_LAG_INTF_FALLBACK_STATIC:
+         return "ETH_LAG_INTF_FALLBACK_STATIC";
+      case ETH_LAG_INTF_FALLBACK_INDIVIDUAL:
+         return "ETH_LAG_INTF_FALLBACK_INDIVIDUAL";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const eth_lag_intf_fallback_type_t & enum_val) {
-   if (enum_val==ETH_LAG_INTF_FALLBACK_NULL) {
-      os << "ETH_LAG_INTF_FALLBACK_NULL";
-   } else if (enum_val==ETH_LAG_INTF_FALLBACK_NONE) {
-      os << "ETH_LAG_INTF_FALLBACK_NONE";
-   } else if (enum_val==ETH_LAG_INTF_FALLBACK_STATIC) {
-      os << "ETH_LAG_INTF_FALLBACK_STATIC";
-   } else if (enum_val==ETH_LAG_INTF_FALLBACK_INDIVIDUAL) {
-      os << "ETH_LAG_INTF_FALLBACK_INDIVIDUAL";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(eth_lag_intf_fallback_timeout_default_t enum_val) {
+   switch (enum_val) {
+      case ETH_LAG_INTF_FALLBACK_TIMEOUT_DEFAULT:
+         return "ETH_LAG_INTF_FALLBACK_TIMEOUT_DEFAULT";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os,
            const eth_lag_intf_fallback_timeout_default_t & enum_val) {
-   if (enum_val==ETH_LAG_INTF_FALLBACK_TIMEOUT_DEFAULT) {
-      os << "ETH_LAG_INTF_FALLBACK_TIMEOUT_DEFAULT";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(eth_lag_intf_member_priority_t enum_val) {
+   switch (enum_val) {
+      case ETH_LAG_INTF_PORT_PRIORITY_DEFAULT:
+         return "ETH_LAG_INTF_PORT_PRIORITY_DEFAULT";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const eth_lag_intf_member_priority_t & enum_val) {
-   if (enum_val==ETH_LAG_INTF_PORT_PRIORITY_DEFAULT) {
-      os << "ETH_LAG_INTF_PORT_PRIORITY_DEFAULT";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(eth_lag_intf_member_lacp_mode_t enum_val) {
+   switch (enum_val) {
+      case ETH_LAG_INTF_MEMBER_LACP_MODE_NULL:
+         return "ETH_LAG_INTF_MEMBER_LACP_MODE_NULL";
+      case ETH_LAG_INTF_MEMBER_LACP_MODE_OFF:
+         return "ETH_LAG_INTF_MEMBER_LACP_MODE_OFF";
+      case ETH_LAG_INTF_MEMBER_LACP_MODE_PASSIVE:
+         return "ETH_LAG_INTF_MEMBER_LACP_MODE_PASSIVE";
+      case ETH_LAG_INTF_MEMBER_LACP_MODE_ACTIVE:
+         return "ETH_LAG_INTF_MEMBER_LACP_MODE_ACTIVE";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const eth_lag_intf_member_lacp_mode_t & enum_val) {
-   if (enum_val==ETH_LAG_INTF_MEMBER_LACP_MODE_NULL) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_MODE_NULL";
-   } else if (enum_val==ETH_LAG_INTF_MEMBER_LACP_MODE_OFF) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_MODE_OFF";
-   } else if (enum_val==ETH_LAG_INTF_MEMBER_LACP_MODE_PASSIVE) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_MODE_PASSIVE";
-   } else if (enum_val==ETH_LAG_INTF_MEMBER_LACP_MODE_ACTIVE) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_MODE_ACTIVE";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(eth_lag_intf_member_lacp_timeout_t enum_val) {
+   switch (enum_val) {
+      case ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_NULL:
+         return "ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_NULL";
+      case ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_SHORT:
+         return "ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_SHORT";
+      case ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_LONG:
+         return "ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_LONG";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const eth_lag_intf_member_lacp_timeout_t & enum_val) {
-   if (enum_val==ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_NULL) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_NULL";
-   } else if (enum_val==ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_SHORT) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_SHORT";
-   } else if (enum_val==ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_LONG) {
-      os << "ETH_LAG_INTF_MEMBER_LACP_TIMEOUT_LONG";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -166,31 +196,25 @@ eth_lag_intf_membership_t::operator<(eth_lag_intf_membership_t const & other)
 
 inline uint32_t
 eth_lag_intf_membership_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&eth_lag_intf_id_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&active_,
-              sizeof(bool), ret);
-   ret ^= std::hash<std::string>()(reason_);
-   ret = hash_mix::mix((uint8_t *)&member_time_,
-              sizeof(double), ret);
-   ret = hash_mix::mix((uint8_t *)&mode_,
-              sizeof(eth_lag_intf_member_lacp_mode_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(eth_lag_intf_id_, active_, reason_, member_time_, mode_);
+}
+
+inline char *
+eth_lag_intf_membership_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "eth_lag_intf_membership_t(";
+   out << "eth_lag_intf_id=" << eth_lag_intf_id_;
+   out << ", active=" << active_;
+   out << ", reason='" << reason_ << "'";
+   out << ", member_time=" << member_time_;
+   out << ", mode=" << mode_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 eth_lag_intf_membership_t::to_string() const {
-   std::ostringstream ss;
-   ss << "eth_lag_intf_membership_t(";
-   ss << "eth_lag_intf_id=" << eth_lag_intf_id_;
-   ss << ", active=" << active_;
-   ss << ", reason='" << reason_ << "'";
-   ss << ", member_time=" << member_time_;
-   ss << ", mode=" << mode_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -282,32 +306,26 @@ eth_lag_intf_t::operator<(eth_lag_intf_t const & other) const {
 
 inline uint32_t
 eth_lag_intf_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&speed_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&min_links_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fallback_type_,
-              sizeof(eth_lag_intf_fallback_type_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fallback_timeout_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(intf_, speed_, min_links_, fallback_type_,
+                           fallback_timeout_);
+}
+
+inline char *
+eth_lag_intf_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "eth_lag_intf_t(";
+   out << "intf=" << intf_;
+   out << ", speed=" << speed_;
+   out << ", min_links=" << min_links_;
+   out << ", fallback_type=" << fallback_type_;
+   out << ", fallback_timeout=" << fallback_timeout_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 eth_lag_intf_t::to_string() const {
-   std::ostringstream ss;
-   ss << "eth_lag_intf_t(";
-   ss << "intf=" << intf_;
-   ss << ", speed=" << speed_;
-   ss << ", min_links=" << min_links_;
-   ss << ", fallback_type=" << fallback_type_;
-   ss << ", fallback_timeout=" << fallback_timeout_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
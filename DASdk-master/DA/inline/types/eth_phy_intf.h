@@ -6,39 +6,45 @@
 
 namespace DA {
 
+inline char const *
+enum_name(eth_link_speed_t enum_val) {
+   switch (enum_val) {
+      case LINK_SPEED_UNKNOWN:
+         return "LINK_SPEED_UNKNOWN";
+      case LINK_SPEED_10MBPS:
+         return "LINK_SPEED_10MBPS";
+      case LINK_SPEED_100MBPS:
+         return "LINK_SPEED_100MBPS";
+      case LINK_SPEED_1GBPS:
+         return "LINK_SPEED_1GBPS";
+      case LINK_SPEED_2P5GBPS:
+         return "LINK_SPEED_2P5GBPS";
+      case LINK_SPEED_5GBPS:
+         return "LINK_SPEED_5GBPS";
+      case LINK_SPEED_10GBPS:
+         return "LINK_SPEED_10GBPS";
+      case LINK_SPEED_25GBPS:
+         return "LINK_SPEED_25GBPS";
+      case LINK_SPEED_40GBPS:
+         return "LINK_SPEED_40GBPS";
+      case LINK_SPEED_50GBPS:
+         return "LINK_SPEED_50GBPS";
+      case LINK_SPEED_100GBPS:
+         return "LINK_SPEED_100GBPS";
+      case LINK_SPEED_200GBPS:
+         return "LINK_SPEED_200GBPS";
+      case LINK_SPEED_400GBPS:
+         return "LINK_SPEED_400GBPS";
+      case LINK_SPEED_UNEXPECTED:
+         return "LINK_SPEED_UNEXPECTED";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const eth_link_speed_t & enum_val) {
-   if (enum_val==LINK_SPEED_UNKNOWN) {
-      os << "LINK_SPEED_UNKNOWN";
-   } else if (enum_val==LINK_SPEED_10MBPS) {
-      os << "LINK_SPEED_10MBPS";
-   } else if (enum_val==LINK_SPEED_100MBPS) {
-      os << "LINK_SPEED_100MBPS";
-   } else if (enum_val==LINK_SPEED_1GBPS) {
-      os << "LINK_SPEED_1GBPS";
-   } else if (enum_val==LINK_SPEED_2P5GBPS) {
-      os << "LINK_SPEED_2P5GBPS";
-   } else if (enum_val==LINK_SPEED_5GBPS) {
-      os << "LINK_SPEED_5GBPS";
-   } else if (enum_val==LINK_SPEED_10GBPS) {
-      os << "LINK_SPEED_10GBPS";
-   } else if (enum_val==LINK_SPEED_25GBPS) {
-      os << "LINK_SPEED_25GBPS";
-   } else if (enum_val==LINK_SPEED_40GBPS) {
-      os << "LINK_SPEED_40GBPS";
-   } else if (enum_val==LINK_SPEED_50GBPS) {
-      os << "LINK_SPEED_50GBPS";
-   } else if (enum_val==LINK_SPEED_100GBPS) {
-      os << "LINK_SPEED_100GBPS";
-   } else if (enum_val==LINK_SPEED_200GBPS) {
-      os << "LINK_SPEED_200GBPS";
-   } else if (enum_val==LINK_SPEED_400GBPS) {
-      os << "LINK_SPEED_400GBPS";
-   } else if (enum_val==LINK_SPEED_UNEXPECTED) {
-      os << "LINK_SPEED_UNEXPECTED";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -205,74 +211,46 @@ eth_phy_intf_counters_t::operator!=(eth_phy_intf_counters_t const & other) const
 
 inline uint32_t
 eth_phy_intf_counters_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&single_collision_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&multiple_collision_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fcs_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&alignment_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&deferred_transmissions_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&late_collisions_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&excessive_collisions_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&internal_mac_transmit_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&carrier_sense_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&internal_mac_receive_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&frame_too_shorts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&frame_too_longs_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&sqe_test_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&symbol_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_unknown_opcodes_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_pause_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_pause_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fragments_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&jabbers_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(single_collision_frames_, multiple_collision_frames_,
+                           fcs_errors_, alignment_errors_, deferred_transmissions_,
+                           late_collisions_, excessive_collisions_,
+                           internal_mac_transmit_errors_, carrier_sense_errors_,
+                           internal_mac_receive_errors_, frame_too_shorts_,
+                           frame_too_longs_, sqe_test_errors_, symbol_errors_,
+                           in_unknown_opcodes_, out_pause_frames_, in_pause_frames_,
+                           fragments_, jabbers_);
+}
+
+inline char *
+eth_phy_intf_counters_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "eth_phy_intf_counters_t(";
+   out << "single_collision_frames=" << single_collision_frames_;
+   out << ", multiple_collision_frames=" << multiple_collision_frames_;
+   out << ", fcs_errors=" << fcs_errors_;
+   out << ", alignment_errors=" << alignment_errors_;
+   out << ", deferred_transmissions=" << deferred_transmissions_;
+   out << ", late_collisions=" << late_collisions_;
+   out << ", excessive_collisions=" << excessive_collisions_;
+   out << ", internal_mac_transmit_errors=" << internal_mac_transmit_errors_;
+   out << ", carrier_sense_errors=" << carrier_sense_errors_;
+   out << ", internal_mac_receive_errors=" << internal_mac_receive_errors_;
+   out << ", frame_too_shorts=" << frame_too_shorts_;
+   out << ", frame_too_longs=" << frame_too_longs_;
+   out << ", sqe_test_errors=" << sqe_test_errors_;
+   out << ", symbol_errors=" << symbol_errors_;
+   out << ", in_unknown_opcodes=" << in_unknown_opcodes_;
+   out << ", out_pause_frames=" << out_pause_frames_;
+   out << ", in_pause_frames=" << in_pause_frames_;
+   out << ", fragments=" << fragments_;
+   out << ", jabbers=" << jabbers_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 eth_phy_intf_counters_t::to_string() const {
-   std::ostringstream ss;
-   ss << "eth_phy_intf_counters_t(";
-   ss << "single_collision_frames=" << single_collision_frames_;
-   ss << ", multiple_collision_frames=" << multiple_collision_frames_;
-   ss << ", fcs_errors=" << fcs_errors_;
-   ss << ", alignment_errors=" << alignment_errors_;
-   ss << ", deferred_transmissions=" << deferred_transmissions_;
-   ss << ", late_collisions=" << late_collisions_;
-   ss << ", excessive_collisions=" << excessive_collisions_;
-   ss << ", internal_mac_transmit_errors=" << internal_mac_transmit_errors_;
-   ss << ", carrier_sense_errors=" << carrier_sense_errors_;
-   ss << ", internal_mac_receive_errors=" << internal_mac_receive_errors_;
-   ss << ", frame_too_shorts=" << frame_too_shorts_;
-   ss << ", frame_too_longs=" << frame_too_longs_;
-   ss << ", sqe_test_errors=" << sqe_test_errors_;
-   ss << ", symbol_errors=" << symbol_errors_;
-   ss << ", in_unknown_opcodes=" << in_unknown_opcodes_;
-   ss << ", out_pause_frames=" << out_pause_frames_;
-   ss << ", in_pause_frames=" << in_pause_frames_;
-   ss << ", fragments=" << fragments_;
-   ss << ", jabbers=" << jabbers_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -418,59 +396,43 @@ eth_phy_intf_bin_counters_t::operator!=(eth_phy_intf_bin_counters_t const & othe
 
 inline uint32_t
 eth_phy_intf_bin_counters_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&in_64_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_65_to_127_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_128_to_255_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_256_to_511_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_512_to_1023_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_1024_to_1522_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_1523_to_max_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_64_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_65_to_127_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_128_to_255_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_256_to_511_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_512_to_1023_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_1024_to_1522_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_1523_to_max_octet_frames_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(in_64_octet_frames_, in_65_to_127_octet_frames_,
+                           in_128_to_255_octet_frames_, in_256_to_511_octet_frames_,
+                           in_512_to_1023_octet_frames_,
+                           in_1024_to_1522_octet_frames_,
+                           in_1523_to_max_octet_frames_, out_64_octet_frames_,
+                           out_65_to_127_octet_frames_, out_128_to_255_octet_frames_,
+                           out_256_to_511_octet_frames_,
+                           out_512_to_1023_octet_frames_,
+                           out_1024_to_1522_octet_frames_,
+                           out_1523_to_max_octet_frames_);
+}
+
+inline char *
+eth_phy_intf_bin_counters_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "eth_phy_intf_bin_counters_t(";
+   out << "in_64_octet_frames=" << in_64_octet_frames_;
+   out << ", in_65_to_127_octet_frames=" << in_65_to_127_octet_frames_;
+   out << ", in_128_to_255_octet_frames=" << in_128_to_255_octet_frames_;
+   out << ", in_256_to_511_octet_frames=" << in_256_to_511_octet_frames_;
+   out << ", in_512_to_1023_octet_frames=" << in_512_to_1023_octet_frames_;
+   out << ", in_1024_to_1522_octet_frames=" << in_1024_to_1522_octet_frames_;
+   out << ", in_1523_to_max_octet_frames=" << in_1523_to_max_octet_frames_;
+   out << ", out_64_octet_frames=" << out_64_octet_frames_;
+   out << ", out_65_to_127_octet_frames=" << out_65_to_127_octet_frames_;
+   out << ", out_128_to_255_octet_frames=" << out_128_to_255_octet_frames_;
+   out << ", out_256_to_511_octet_frames=" << out_256_to_511_octet_frames_;
+   out << ", out_512_to_1023_octet_frames=" << out_512_to_1023_octet_frames_;
+   out << ", out_1024_to_1522_octet_frames=" << out_1024_to_1522_octet_frames_;
+   out << ", out_1523_to_max_octet_frames=" << out_1523_to_max_octet_frames_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 eth_phy_intf_bin_counters_t::to_string() const {
-   std::ostringstream ss;
-   ss << "eth_phy_intf_bin_counters_t(";
-   ss << "in_64_octet_frames=" << in_64_octet_frames_;
-   ss << ", in_65_to_127_octet_frames=" << in_65_to_127_octet_frames_;
-   ss << ", in_128_to_255_octet_frames=" << in_128_to_255_octet_frames_;
-   ss << ", in_256_to_511_octet_frames=" << in_256_to_511_octet_frames_;
-   ss << ", in_512_to_1023_octet_frames=" << in_512_to_1023_octet_frames_;
-   ss << ", in_1024_to_1522_octet_frames=" << in_1024_to_1522_octet_frames_;
-   ss << ", in_1523_to_max_octet_frames=" << in_1523_to_max_octet_frames_;
-   ss << ", out_64_octet_frames=" << out_64_octet_frames_;
-   ss << ", out_65_to_127_octet_frames=" << out_65_to_127_octet_frames_;
-   ss << ", out_128_to_255_octet_frames=" << out_128_to_255_octet_frames_;
-   ss << ", out_256_to_511_octet_frames=" << out_256_to_511_octet_frames_;
-   ss << ", out_512_to_1023_octet_frames=" << out_512_to_1023_octet_frames_;
-   ss << ", out_1024_to_1522_octet_frames=" << out_1024_to_1522_octet_frames_;
-   ss << ", out_1523_to_max_octet_frames=" << out_1523_to_max_octet_frames_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -37,20 +37,21 @@ fib_route_key_t::operator!=(fib_route_key_t const & other) const {
 
 inline uint32_t
 fib_route_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&prefix_,
-              sizeof(ip_prefix_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(prefix_);
+}
+
+inline char *
+fib_route_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "fib_route_key_t(";
+   out << "prefix=" << prefix_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 fib_route_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "fib_route_key_t(";
-   ss << "prefix=" << prefix_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -61,63 +62,69 @@ operator<<(std::ostream& os, const fib_route_key_t& obj) {
 
 
 
+inline char const *
+enum_name(fib_route_type_t enum_val) {
+   switch (enum_val) {
+      case ROUTE_TYPE_INVALID:
+         return "ROUTE_TYPE_INVALID";
+      case ROUTE_TYPE_RECEIVE:
+         return "ROUTE_TYPE_RECEIVE";
+      case ROUTE_TYPE_RECEIVE_BCAST:
+         return "ROUTE_TYPE_RECEIVE_BCAST";
+      case ROUTE_TYPE_ATTACHED:
+         return "ROUTE_TYPE_ATTACHED";
+      case ROUTE_TYPE_UNKNOWN:
+         return "ROUTE_TYPE_UNKNOWN";
+      case ROUTE_TYPE_STATIC_CONFIG:
+         return "ROUTE_TYPE_STATIC_CONFIG";
+      case ROUTE_TYPE_KERNEL:
+         return "ROUTE_TYPE_KERNEL";
+      case ROUTE_TYPE_RIP:
+         return "ROUTE_TYPE_RIP";
+      case ROUTE_TYPE_CONNECTED:
+         return "ROUTE_TYPE_CONNECTED";
+      case ROUTE_TYPE_REDIRECT:
+         return "ROUTE_TYPE_REDIRECT";
+      case ROUTE_TYPE_BGP_AGGREGATE:
+         return "ROUTE_TYPE_BGP_AGGREGATE";
+      case ROUTE_TYPE_OSPF_AGGREGATE:
+         return "ROUTE_TYPE_OSPF_AGGREGATE";
+      case ROUTE_TYPE_OSPF_INTRA_AREA:
+         return "ROUTE_TYPE_OSPF_INTRA_AREA";
+      case ROUTE_TYPE_OSPF_INTER_AREA:
+         return "ROUTE_TYPE_OSPF_INTER_AREA";
+      case ROUTE_TYPE_OSPF_EXTERNAL_TYPE1:
+         return "ROUTE_TYPE_OSPF_EXTERNAL_TYPE1";
+      case ROUTE_TYPE_OSPF_EXTERNAL_TYPE2:
+         return "ROUTE_TYPE_OSPF_EXTERNAL_TYPE2";
+      case ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE1:
+         return "ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE1";
+      case ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE2:
+         return "ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE2";
+      case ROUTE_TYPE_BGP:
+         return "ROUTE_TYPE_BGP";
+      case ROUTE_TYPE_IBGP:
+         return "ROUTE_TYPE_IBGP";
+      case ROUTE_TYPE_EBGP:
+         return "ROUTE_TYPE_EBGP";
+      case ROUTE_TYPE_ISIS:
+         return "ROUTE_TYPE_ISIS";
+      case ROUTE_TYPE_ISIS_LEVEL1:
+         return "ROUTE_TYPE_ISIS_LEVEL1";
+      case ROUTE_TYPE_ISIS_LEVEL2:
+         return "ROUTE_TYPE_ISIS_LEVEL2";
+      case ROUTE_TYPE_NEXTHOP_GROUP:
+         return "ROUTE_TYPE_NEXTHOP_GROUP";
+      case ROUTE_TYPE_OSPF3:
+         return "ROUTE_TYPE_OSPF3";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const fib_route_type_t & enum_val) {
-   if (enum_val==ROUTE_TYPE_INVALID) {
-      os << "ROUTE_TYPE_INVALID";
-   } else if (enum_val==ROUTE_TYPE_RECEIVE) {
-      os << "ROUTE_TYPE_RECEIVE";
-   } else if (enum_val==ROUTE_TYPE_RECEIVE_BCAST) {
-      os << "ROUTE_TYPE_RECEIVE_BCAST";
-   } else if (enum_val==ROUTE_TYPE_ATTACHED) {
-      os << "ROUTE_TYPE_ATTACHED";
-   } else if (enum_val==ROUTE_TYPE_UNKNOWN) {
-      os << "ROUTE_TYPE_UNKNOWN";
-   } else if (enum_val==ROUTE_TYPE_STATIC_CONFIG) {
-      os << "ROUTE_TYPE_STATIC_CONFIG";
-   } else if (enum_val==ROUTE_TYPE_KERNEL) {
-      os << "ROUTE_TYPE_KERNEL";
-   } else if (enum_val==ROUTE_TYPE_RIP) {
-      os << "ROUTE_TYPE_RIP";
-   } else if (enum_val==ROUTE_TYPE_CONNECTED) {
-      os << "ROUTE_TYPE_CONNECTED";
-   } else if (enum_val==ROUTE_TYPE_REDIRECT) {
-      os << "ROUTE_TYPE_REDIRECT";
-   } else if (enum_val==ROUTE_TYPE_BGP_AGGREGATE) {
-      os << "ROUTE_TYPE_BGP_AGGREGATE";
-   } else if (enum_val==ROUTE_TYPE_OSPF_AGGREGATE) {
-      os << "ROUTE_TYPE_OSPF_AGGREGATE";
-   } else if (enum_val==ROUTE_TYPE_OSPF_INTRA_AREA) {
-      os << "ROUTE_TYPE_OSPF_INTRA_AREA";
-   } else if (enum_val==ROUTE_TYPE_OSPF_INTER_AREA) {
-      os << "ROUTE_TYPE_OSPF_INTER_AREA";
-   } else if (enum_val==ROUTE_TYPE_OSPF_EXTERNAL_TYPE1) {
-      os << "ROUTE_TYPE_OSPF_EXTERNAL_TYPE1";
-   } else if (enum_val==ROUTE_TYPE_OSPF_EXTERNAL_TYPE2) {
-      os << "ROUTE_TYPE_OSPF_EXTERNAL_TYPE2";
-   } else if (enum_val==ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE1) {
-      os << "ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE1";
-   } else if (enum_val==ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE2) {
-      os << "ROUTE_TYPE_OSPF_NSSA_EXTERNAL_TYPE2";
-   } else if (enum_val==ROUTE_TYPE_BGP) {
-      os << "ROUTE_TYPE_BGP";
-   } else if (enum_val==ROUTE_TYPE_IBGP) {
-      os << "ROUTE_TYPE_IBGP";
-   } else if (enum_val==ROUTE_TYPE_EBGP) {
-      os << "ROUTE_TYPE_EBGP";
-   } else if (enum_val==ROUTE_TYPE_ISIS) {
-      os << "ROUTE_TYPE_ISIS";
-   } else if (enum_val==ROUTE_TYPE_ISIS_LEVEL1) {
-      os << "ROUTE_TYPE_ISIS_LEVEL1";
-   } else if (enum_val==ROUTE_TYPE_ISIS_LEVEL2) {
-      os << "ROUTE_TYPE_ISIS_LEVEL2";
-   } else if (enum_val==ROUTE_TYPE_NEXTHOP_GROUP) {
-      os << "ROUTE_TYPE_NEXTHOP_GROUP";
-   } else if (enum_val==ROUTE_TYPE_OSPF3) {
-      os << "ROUTE_TYPE_OSPF3";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -198,32 +205,25 @@ fib_route_t::operator!=(fib_route_t const & other) const {
 
 inline uint32_t
 fib_route_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&route_key_,
-              sizeof(fib_route_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&preference_,
-              sizeof(ip_route_preference_t), ret);
-   ret = hash_mix::mix((uint8_t *)&metric_,
-              sizeof(ip_route_metric_t), ret);
-   ret = hash_mix::mix((uint8_t *)&route_type_,
-              sizeof(fib_route_type_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fec_id_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(route_key_, preference_, metric_, route_type_, fec_id_);
+}
+
+inline char *
+fib_route_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "fib_route_t(";
+   out << "route_key=" << route_key_;
+   out << ", preference=" << preference_;
+   out << ", metric=" << metric_;
+   out << ", route_type=" << route_type_;
+   out << ", fec_id=" << fec_id_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 fib_route_t::to_string() const {
-   std::ostringstream ss;
-   ss << "fib_route_t(";
-   ss << "route_key=" << route_key_;
-   ss << ", preference=" << preference_;
-   ss << ", metric=" << metric_;
-   ss << ", route_type=" << route_type_;
-   ss << ", fec_id=" << fec_id_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -265,20 +265,21 @@ fib_fec_key_t::operator!=(fib_fec_key_t const & other) const {
 
 inline uint32_t
 fib_fec_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&fec_id_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(fec_id_);
+}
+
+inline char *
+fib_fec_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "fib_fec_key_t(";
+   out << "fec_id=" << fec_id_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 fib_fec_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "fib_fec_key_t(";
-   ss << "fec_id=" << fec_id_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -342,26 +343,23 @@ fib_via_t::operator!=(fib_via_t const & other) const {
 
 inline uint32_t
 fib_via_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&hop_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&mpls_label_,
-              sizeof(mpls_label_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(hop_, intf_, mpls_label_);
+}
+
+inline char *
+fib_via_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "fib_via_t(";
+   out << "hop=" << hop_;
+   out << ", intf=" << intf_;
+   out << ", mpls_label=" << mpls_label_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 fib_via_t::to_string() const {
-   std::ostringstream ss;
-   ss << "fib_via_t(";
-   ss << "hop=" << hop_;
-   ss << ", intf=" << intf_;
-   ss << ", mpls_label=" << mpls_label_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -372,27 +370,33 @@ operator<<(std::ostream& os, const fib_via_t& obj) {
 
 
 
+inline char const *
+enum_name(fib_fec_type_t enum_val) {
+   switch (enum_val) {
+      case FEC_TYPE_FORWARD:
+         return "FEC_TYPE_FORWARD";
+      case FEC_TYPE_DROP:
+         return "FEC_TYPE_DROP";
+      case FEC_TYPE_RECEIVE:
+         return "FEC_TYPE_RECEIVE";
+      case FEC_TYPE_ATTACHED:
+         return "FEC_TYPE_ATTACHED";
+      case FEC_TYPE_RECEIVE_BCAST:
+         return "FEC_TYPE_RECEIVE_BCAST";
+      case FEC_TYPE_NEXTHOP_GROUP:
+         return "FEC_TYPE_NEXTHOP_GROUP";
+      case FEC_TYPE_KERNEL:
+         return "FEC_TYPE_KERNEL";
+      case FEC_TYPE_UNKNOWN:
+         return "FEC_TYPE_UNKNOWN";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const fib_fec_type_t & enum_val) {
-   if (enum_val==FEC_TYPE_FORWARD) {
-      os << "FEC_TYPE_FORWARD";
-   } else if (enum_val==FEC_TYPE_DROP) {
-      os << "FEC_TYPE_DROP";
-   } else if (enum_val==FEC_TYPE_RECEIVE) {
-      os << "FEC_TYPE_RECEIVE";
-   } else if (enum_val==FEC_TYPE_ATTACHED) {
-      os << "FEC_TYPE_ATTACHED";
-   } else if (enum_val==FEC_TYPE_RECEIVE_BCAST) {
-      os << "FEC_TYPE_RECEIVE_BCAST";
-   } else if (enum_val==FEC_TYPE_NEXTHOP_GROUP) {
-      os << "FEC_TYPE_NEXTHOP_GROUP";
-   } else if (enum_val==FEC_TYPE_KERNEL) {
-      os << "FEC_TYPE_KERNEL";
-   } else if (enum_val==FEC_TYPE_UNKNOWN) {
-      os << "FEC_TYPE_UNKNOWN";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -434,65 +438,76 @@ fib_fec_t::nexthop_group_name() const {
 
 inline void
 fib_fec_t::nexthop_group_name_is(std::string nexthop_group_name) {
-   nexthop_group_name_ = nexthop_group_name;
+   nexthop_group_name_ = std::move(nexthop_group_name);
 }
 
-inline std::forward_list<fib_via_t> const &
+inline std::vector<fib_via_t> const &
 fib_fec_t::via() const {
    return via_;
 }
 
+inline std::forward_list<fib_via_t>
+fib_fec_t::via_list() const {
+   return std::forward_list<fib_via_t>(via_.begin(), via_.end());
+}
+
 inline void
-fib_fec_t::via_is(std::forward_list<fib_via_t> const & via) {
+fib_fec_t::via_is(std::vector<fib_via_t> const & via) {
    via_ = via;
 }
 
+#ifndef SWIG
+inline void
+fib_fec_t::via_is(std::vector<fib_via_t> && via) {
+   via_ = std::move(via);
+}
+#endif
+
+inline void
+fib_fec_t::via_is(std::forward_list<fib_via_t> const & via) {
+   via_.assign(via.begin(), via.end());
+}
+
 inline void
 fib_fec_t::via_set(fib_via_t const & via) {
-   via_.push_front(via);
+   via_.insert(via_.begin(), via);
 }
 
 inline void
 fib_fec_t::via_del(fib_via_t const & via) {
-   via_.remove(via);
+   via_.erase(std::remove(via_.begin(), via_.end(), via), via_.end());
 }
 
 inline uint32_t
 fib_fec_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&fec_key_,
-              sizeof(fib_fec_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fec_type_,
-              sizeof(fib_fec_type_t), ret);
-   ret ^= std::hash<std::string>()(nexthop_group_name_);
-   for (auto it=via_.cbegin(); it!=via_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(fib_via_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(fec_key_, fec_type_, nexthop_group_name_, via_);
 }
 
-inline std::string
-fib_fec_t::to_string() const {
-   std::ostringstream ss;
-   ss << "fib_fec_t(";
-   ss << "fec_key=" << fec_key_;
-   ss << ", fec_type=" << fec_type_;
-   ss << ", nexthop_group_name='" << nexthop_group_name_ << "'";
-   ss << ", via=" <<"'";
+inline char *
+fib_fec_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "fib_fec_t(";
+   out << "fec_key=" << fec_key_;
+   out << ", fec_type=" << fec_type_;
+   out << ", nexthop_group_name='" << nexthop_group_name_ << "'";
+   out << ", via=" <<"'";
    bool first_via = true;
    for (auto it=via_.cbegin(); it!=via_.cend(); ++it) {
       if (first_via) {
-         ss << (*it);
+         out << (*it);
          first_via = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+fib_fec_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -66,23 +66,23 @@ hardware_table_key_t::operator<(hardware_table_key_t const & other) const {
 
 inline uint32_t
 hardware_table_key_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(table_name_);
-   ret ^= std::hash<std::string>()(feature_);
-   ret ^= std::hash<std::string>()(chip_);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(table_name_, feature_, chip_);
+}
+
+inline char *
+hardware_table_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "hardware_table_key_t(";
+   out << "table_name='" << table_name_ << "'";
+   out << ", feature='" << feature_ << "'";
+   out << ", chip='" << chip_ << "'";
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 hardware_table_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "hardware_table_key_t(";
-   ss << "table_name='" << table_name_ << "'";
-   ss << ", feature='" << feature_ << "'";
-   ss << ", chip='" << chip_ << "'";
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -138,23 +138,22 @@ hardware_table_high_watermark_t::operator<(
 
 inline uint32_t
 hardware_table_high_watermark_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&max_entries_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&timestamp_,
-              sizeof(time_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(max_entries_, timestamp_);
+}
+
+inline char *
+hardware_table_high_watermark_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "hardware_table_high_watermark_t(";
+   out << "max_entries=" << max_entries_;
+   out << ", timestamp=" << timestamp_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 hardware_table_high_watermark_t::to_string() const {
-   std::ostringstream ss;
-   ss << "hardware_table_high_watermark_t(";
-   ss << "max_entries=" << max_entries_;
-   ss << ", timestamp=" << timestamp_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -217,26 +216,23 @@ hardware_table_usage_t::operator<(hardware_table_usage_t const & other) const {
 
 inline uint32_t
 hardware_table_usage_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&used_entries_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&free_entries_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&committed_entries_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(used_entries_, free_entries_, committed_entries_);
+}
+
+inline char *
+hardware_table_usage_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "hardware_table_usage_t(";
+   out << "used_entries=" << used_entries_;
+   out << ", free_entries=" << free_entries_;
+   out << ", committed_entries=" << committed_entries_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 hardware_table_usage_t::to_string() const {
-   std::ostringstream ss;
-   ss << "hardware_table_usage_t(";
-   ss << "used_entries=" << used_entries_;
-   ss << ", free_entries=" << free_entries_;
-   ss << ", committed_entries=" << committed_entries_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -299,26 +295,23 @@ hardware_table_entry_t::operator<(hardware_table_entry_t const & other) const {
 
 inline uint32_t
 hardware_table_entry_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&usage_,
-              sizeof(hardware_table_usage_t), ret);
-   ret = hash_mix::mix((uint8_t *)&max_entries_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&high_watermark_,
-              sizeof(hardware_table_high_watermark_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(usage_, max_entries_, high_watermark_);
+}
+
+inline char *
+hardware_table_entry_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "hardware_table_entry_t(";
+   out << "usage=" << usage_;
+   out << ", max_entries=" << max_entries_;
+   out << ", high_watermark=" << high_watermark_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 hardware_table_entry_t::to_string() const {
-   std::ostringstream ss;
-   ss << "hardware_table_entry_t(";
-   ss << "usage=" << usage_;
-   ss << ", max_entries=" << max_entries_;
-   ss << ", high_watermark=" << high_watermark_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
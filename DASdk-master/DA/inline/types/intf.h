@@ -6,56 +6,95 @@
 
 namespace DA {
 
+inline char const *
+enum_name(oper_status_t enum_val) {
+   switch (enum_val) {
+      case INTF_OPER_NULL:
+         return "INTF_OPER_NULL";
+      case INTF_OPER_UP:
+         return "INTF_OPER_UP";
+      case INTF_OPER_DOWN:
+         return "INTF_OPER_DOWN";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const oper_status_t & enum_val) {
-   if (enum_val==INTF_OPER_NULL) {
-      os << "INTF_OPER_NULL";
-   } else if (enum_val==INTF_OPER_UP) {
-      os << "INTF_OPER_UP";
-   } else if (enum_val==INTF_OPER_DOWN) {
-      os << "INTF_OPER_DOWN";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(intf_type_t enum_val) {
+   switch (enum_val) {
+      case INTF_TYPE_NULL:
+         return "INTF_TYPE_NULL";
+      case INTF_TYPE_OTHER:
+         return "INTF_TYPE_OTHER";
+      case INTF_TYPE_ETH:
+         return "INTF_TYPE_ETH";
+      case INTF_TYPE_VLAN:
+         return "INTF_TYPE_VLAN";
+      case INTF_TYPE_MANAGEMENT:
+         return "INTF_TYPE_MANAGEMENT";
+      case INTF_TYPE_LOOPBACK:
+         return "INTF_TYPE_LOOPBACK";
+      case INTF_TYPE_LAG:
+         return "INTF_TYPE_LAG";
+      case INTF_TYPE_NULL0:
+         return "INTF_TYPE_NULL0";
+      case INTF_TYPE_CPU:
+         return "INTF_TYPE_CPU";
+      case INTF_TYPE_VXLAN:
+         return "INTF_TYPE_VXLAN";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const intf_type_t & enum_val) {
-   if (enum_val==INTF_TYPE_NULL) {
-      os << "INTF_TYPE_NULL";
-   } else if (enum_val==INTF_TYPE_OTHER) {
-      os << "INTF_TYPE_OTHER";
-   } else if (enum_val==INTF_TYPE_ETH) {
-      os << "INTF_TYPE_ETH";
-   } else if (enum_val==INTF_TYPE_VLAN) {
-      os << "INTF_TYPE_VLAN";
-   } else if (enum_val==INTF_TYPE_MANAGEMENT) {
-      os << "INTF_TYPE_MANAGEMENT";
-   } else if (enum_val==INTF_TYPE_LOOPBACK) {
-      os << "INTF_TYPE_LOOPBACK";
-   } else if (enum_val==INTF_TYPE_LAG) {
-      os << "INTF_TYPE_LAG";
-   } else if (enum_val==INTF_TYPE_NULL0) {
-      os << "INTF_TYPE_NULL0";
-   } else if (enum_val==INTF_TYPE_CPU) {
-      os << "INTF_TYPE_CPU";
-   } else if (enum_val==INTF_TYPE_VXLAN) {
-      os << "INTF_TYPE_VXLAN";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline intf_id_t::intf_id_t() : intfId_(0) {
+}
+
 inline intf_id_t::intf_id_t(uint64_t id) {
    intfId_ = id;
 }
 
+inline bool
+intf_id_t::is_null0() const {
+   return intf_type() == INTF_TYPE_NULL0;
+}
+
+inline bool
+intf_id_t::is_subintf() const {
+   if (intfId_ & (uint64_t(1) << 55)) {
+      // Interned names keep a flag.
+      return intfId_ & (uint64_t(1) << 54);
+   }
+   return intfId_ & 0xffff;
+}
+
+inline intf_type_t
+intf_id_t::intf_type() const {
+   return intf_type_t(intfId_ >> 56);
+}
+
+inline bool
+intf_id_t::operator!() const {
+   return !intfId_;
+}
+
 inline bool
 intf_id_t::operator==(intf_id_t const & other) const {
    return intfId_ == other.intfId_;
@@ -76,11 +115,7 @@ intf_id_t::operator<(intf_id_t const & other) const {
 
 inline uint32_t
 intf_id_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&intfId_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::final_mix_word(hash_mix::mix_word(intfId_, 0));
 }
 
 inline std::ostream&
@@ -206,56 +241,36 @@ intf_counters_t::operator!=(intf_counters_t const & other) const {
 
 inline uint32_t
 intf_counters_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&out_ucast_pkts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_multicast_pkts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_broadcast_pkts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_ucast_pkts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_multicast_pkts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_broadcast_pkts_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_octets_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_octets_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_discards_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_discards_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_errors_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&sample_time_,
-              sizeof(seconds_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(out_ucast_pkts_, out_multicast_pkts_, out_broadcast_pkts_,
+                           in_ucast_pkts_, in_multicast_pkts_, in_broadcast_pkts_,
+                           out_octets_, in_octets_, out_discards_, out_errors_,
+                           in_discards_, in_errors_, sample_time_);
+}
+
+inline char *
+intf_counters_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "intf_counters_t(";
+   out << "out_ucast_pkts=" << out_ucast_pkts_;
+   out << ", out_multicast_pkts=" << out_multicast_pkts_;
+   out << ", out_broadcast_pkts=" << out_broadcast_pkts_;
+   out << ", in_ucast_pkts=" << in_ucast_pkts_;
+   out << ", in_multicast_pkts=" << in_multicast_pkts_;
+   out << ", in_broadcast_pkts=" << in_broadcast_pkts_;
+   out << ", out_octets=" << out_octets_;
+   out << ", in_octets=" << in_octets_;
+   out << ", out_discards=" << out_discards_;
+   out << ", out_errors=" << out_errors_;
+   out << ", in_discards=" << in_discards_;
+   out << ", in_errors=" << in_errors_;
+   out << ", sample_time=" << sample_time_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 intf_counters_t::to_string() const {
-   std::ostringstream ss;
-   ss << "intf_counters_t(";
-   ss << "out_ucast_pkts=" << out_ucast_pkts_;
-   ss << ", out_multicast_pkts=" << out_multicast_pkts_;
-   ss << ", out_broadcast_pkts=" << out_broadcast_pkts_;
-   ss << ", in_ucast_pkts=" << in_ucast_pkts_;
-   ss << ", in_multicast_pkts=" << in_multicast_pkts_;
-   ss << ", in_broadcast_pkts=" << in_broadcast_pkts_;
-   ss << ", out_octets=" << out_octets_;
-   ss << ", in_octets=" << in_octets_;
-   ss << ", out_discards=" << out_discards_;
-   ss << ", out_errors=" << out_errors_;
-   ss << ", in_discards=" << in_discards_;
-   ss << ", in_errors=" << in_errors_;
-   ss << ", sample_time=" << sample_time_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -323,32 +338,26 @@ intf_traffic_rates_t::operator!=(intf_traffic_rates_t const & other) const {
 
 inline uint32_t
 intf_traffic_rates_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&out_pkts_rate_,
-              sizeof(double), ret);
-   ret = hash_mix::mix((uint8_t *)&in_pkts_rate_,
-              sizeof(double), ret);
-   ret = hash_mix::mix((uint8_t *)&out_bits_rate_,
-              sizeof(double), ret);
-   ret = hash_mix::mix((uint8_t *)&in_bits_rate_,
-              sizeof(double), ret);
-   ret = hash_mix::mix((uint8_t *)&sample_time_,
-              sizeof(seconds_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(out_pkts_rate_, in_pkts_rate_, out_bits_rate_,
+                           in_bits_rate_, sample_time_);
+}
+
+inline char *
+intf_traffic_rates_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "intf_traffic_rates_t(";
+   out << "out_pkts_rate=" << out_pkts_rate_;
+   out << ", in_pkts_rate=" << in_pkts_rate_;
+   out << ", out_bits_rate=" << out_bits_rate_;
+   out << ", in_bits_rate=" << in_bits_rate_;
+   out << ", sample_time=" << sample_time_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 intf_traffic_rates_t::to_string() const {
-   std::ostringstream ss;
-   ss << "intf_traffic_rates_t(";
-   ss << "out_pkts_rate=" << out_pkts_rate_;
-   ss << ", in_pkts_rate=" << in_pkts_rate_;
-   ss << ", out_bits_rate=" << out_bits_rate_;
-   ss << ", in_bits_rate=" << in_bits_rate_;
-   ss << ", sample_time=" << sample_time_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -387,20 +396,21 @@ no_such_interface_error::raise() const {
 
 inline uint32_t
 no_such_interface_error::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(intf_);
+}
+
+inline char *
+no_such_interface_error::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "no_such_interface_error(";
+   out << "intf=" << intf_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 no_such_interface_error::to_string() const {
-   std::ostringstream ss;
-   ss << "no_such_interface_error(";
-   ss << "intf=" << intf_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -437,20 +447,21 @@ not_switchport_eligible_error::raise() const {
 
 inline uint32_t
 not_switchport_eligible_error::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(intf_);
+}
+
+inline char *
+not_switchport_eligible_error::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "not_switchport_eligible_error(";
+   out << "intf=" << intf_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 not_switchport_eligible_error::to_string() const {
-   std::ostringstream ss;
-   ss << "not_switchport_eligible_error(";
-   ss << "intf=" << intf_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
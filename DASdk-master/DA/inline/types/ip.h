@@ -6,17 +6,23 @@
 
 namespace DA {
 
+inline char const *
+enum_name(af_t enum_val) {
+   switch (enum_val) {
+      case AF_NULL:
+         return "AF_NULL";
+      case AF_IPV4:
+         return "AF_IPV4";
+      case AF_IPV6:
+         return "AF_IPV6";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const af_t & enum_val) {
-   if (enum_val==AF_NULL) {
-      os << "AF_NULL";
-   } else if (enum_val==AF_IPV4) {
-      os << "AF_IPV4";
-   } else if (enum_val==AF_IPV6) {
-      os << "AF_IPV6";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -32,7 +38,7 @@ inline ip_addr_t::ip_addr_t() :
 inline ip_addr_t::ip_addr_t(std::string const & address_string) {
 
    memset(&addr_, 0, sizeof(addr_));
-   if (!parse_ip_addr(address_string.c_str(), this)) {
+   if (!parse_ip_addr(address_string.data(), address_string.size(), this)) {
       panic(invalid_argument_error("ip.ip_addr_t",
                                    "invalid IP address."));
    }
@@ -91,33 +97,7 @@ ip_addr_t::addr_v4() const {
 
 inline std::string
 ip_addr_t::to_string() const {
-
-   if (af_ == AF_IPV4) {
-      char buf[128];
-      int rv;
-      rv =snprintf(buf, sizeof(buf), "%d.%d.%d.%d",
-                                     addr_.words[0] & 0xFF,
-                                     (addr_.words[0] >> 8) & 0xFF,
-                                     (addr_.words[0] >> 16) & 0xFF,
-                                     (addr_.words[0] >> 24) & 0xFF);
-      assert(rv>0);
-      return std::string(buf);
-   } else if (af_ == AF_IPV6) {
-      struct sockaddr_in6 addr;
-      char buf[INET6_ADDRSTRLEN];
-
-      addr.sin6_family = AF_INET6;
-      memcpy(&addr.sin6_addr.s6_addr, addr_.bytes, 16);
-      if (!inet_ntop(addr.sin6_family, addr.sin6_addr.s6_addr,
-                     buf, sizeof(buf))) {
-         panic(invalid_argument_error("ip.ip_addr_t.to_string",
-                                      "Can't convert IPV6 address to string."));
-      }
-      return std::string(buf);
-   } else {
-      return "Unknown IP address type.";
-   }
-
+   return chars_writer::to_string(*this);
 }
 
 inline
@@ -127,13 +107,18 @@ ip_addr_t::operator bool() const {
 
 inline uint32_t
 ip_addr_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&af_,
-              sizeof(af_t), ret);
-   ret = hash_mix::mix((uint8_t *)addr_.bytes,
-              af_ == AF_IPV4 ? 4: sizeof(addr_.bytes), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   // Only hash the bytes that operator== compares: the rest of an IPv4
+   // address isn't always zeroed.
+   uint64_t ret = af_;
+   if (af_ == AF_IPV4) {
+      ret = hash_mix::mix_word(addr_.words[0], ret);
+   } else {
+      ret = hash_mix::mix_word(addr_.words[0] | uint64_t(addr_.words[1]) << 32,
+                               ret);
+      ret = hash_mix::mix_word(addr_.words[2] | uint64_t(addr_.words[3]) << 32,
+                               ret);
+   }
+   return hash_mix::final_mix_word(ret);
 }
 
 inline std::ostream&
@@ -195,16 +180,16 @@ ip_prefix_t::mask() const {
 
 }
 
+inline char *
+ip_prefix_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << addr_ << '/' << prefix_length_;
+   return out.end();
+}
+
 inline std::string
 ip_prefix_t::to_string() const {
-
-   char buf[128];
-   int rv;
-   rv = snprintf(buf, sizeof(buf), "%s/%d",
-                 addr_.to_string().c_str(), prefix_length_);
-   assert(rv>0);
-   return std::string(buf);
-
+   return chars_writer::to_string(*this);
 }
 
 inline bool
@@ -220,13 +205,8 @@ ip_prefix_t::operator!=(ip_prefix_t const & other) const {
 
 inline uint32_t
 ip_prefix_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&addr_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&prefix_length_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   uint64_t word = (uint64_t(addr_.hash()) << 8) | prefix_length_;
+   return hash_mix::final_mix_word(hash_mix::mix_word(word, 0));
 }
 
 inline std::ostream&
@@ -237,6 +217,185 @@ operator<<(std::ostream& os, const ip_prefix_t& obj) {
 
 
 
+inline ip4_addr_t::ip4_addr_t() :
+      addr_() {
+}
+
+inline ip4_addr_t::ip4_addr_t(uint32_be_t addr_v4) :
+      addr_(addr_v4) {
+}
+
+inline ip4_addr_t::ip4_addr_t(in_addr const & addr) :
+      addr_(addr.s_addr) {
+}
+
+inline ip4_addr_t::ip4_addr_t(ip_addr_t const & addr) :
+      addr_() {
+   if (addr.af() != AF_IPV4) {
+      panic(invalid_argument_error("ip4_addr_t", "not an IPv4 address."));
+   }
+   addr_ = addr.addr_v4();
+}
+
+inline ip4_addr_t::ip4_addr_t(char const * address_string) :
+      addr_() {
+   if (!parse_ip4_addr(address_string, strlen(address_string), this)) {
+      panic(invalid_argument_error("ip4_addr_t", "invalid IPv4 address."));
+   }
+}
+
+inline uint32_be_t
+ip4_addr_t::addr_v4() const {
+   return addr_;
+}
+
+inline
+ip4_addr_t::operator ip_addr_t() const {
+   return ip_addr_t(addr_);
+}
+
+inline bool
+ip4_addr_t::operator==(ip4_addr_t const & other) const {
+   return addr_ == other.addr_;
+}
+
+inline bool
+ip4_addr_t::operator!=(ip4_addr_t const & other) const {
+   return addr_ != other.addr_;
+}
+
+inline bool
+ip4_addr_t::operator<(ip4_addr_t const & other) const {
+   // In host order, to sort the way ip_addr_t's byte comparison does.
+   return ntohl(addr_) < ntohl(other.addr_);
+}
+
+inline char *
+ip4_addr_t::to_chars(char * first, char * last) const {
+   uint8_t bytes[4];
+   memcpy(bytes, &addr_, sizeof(bytes));
+   chars_writer out(first, last);
+   out << bytes[0] << '.' << bytes[1] << '.' << bytes[2] << '.' << bytes[3];
+   return out.end();
+}
+
+inline std::string
+ip4_addr_t::to_string() const {
+   return chars_writer::to_string(*this);
+}
+
+inline uint32_t
+ip4_addr_t::hash() const {
+   // What ip_addr_t::hash() computes for an AF_IPV4 address.
+   return hash_mix::final_mix_word(hash_mix::mix_word(addr_, AF_IPV4));
+}
+
+inline std::ostream&
+operator<<(std::ostream& os, const ip4_addr_t& obj) {
+   os << obj.to_string();
+   return os;
+}
+
+
+
+inline ip4_prefix_t::ip4_prefix_t() :
+      addr_(), prefix_length_() {
+}
+
+inline ip4_prefix_t::ip4_prefix_t(ip4_addr_t const & addr, uint8_t prefix_length) :
+      addr_(), prefix_length_(prefix_length) {
+   uint32_t host_bits = prefix_length < 32 ? 0xFFFFFFFF >> prefix_length : 0;
+   if (prefix_length > 32 || (ntohl(addr.addr_v4()) & host_bits)) {
+      panic(invalid_argument_error("ip4_prefix_t",
+                                   "invalid IPv4 network prefix."));
+   }
+   uint32_be_t network = addr.addr_v4();
+   memcpy(addr_, &network, sizeof(addr_));
+}
+
+inline ip4_prefix_t::ip4_prefix_t(ip_prefix_t const & prefix) :
+      addr_(), prefix_length_(prefix.prefix_length()) {
+   if (prefix.af() != AF_IPV4) {
+      panic(invalid_argument_error("ip4_prefix_t", "not an IPv4 prefix."));
+   }
+   memcpy(addr_, prefix.network().addr(), sizeof(addr_));
+}
+
+inline ip4_prefix_t::ip4_prefix_t(char const * prefix_string) :
+      addr_(), prefix_length_() {
+   if (!parse_ip4_prefix(prefix_string, strlen(prefix_string), this)) {
+      panic(invalid_argument_error("ip4_prefix_t",
+                                   "input is not an IPv4 prefix"));
+   }
+}
+
+inline uint8_t
+ip4_prefix_t::prefix_length() const {
+   return prefix_length_;
+}
+
+inline ip4_addr_t
+ip4_prefix_t::network() const {
+   uint32_be_t network;
+   memcpy(&network, addr_, sizeof(network));
+   return ip4_addr_t(network);
+}
+
+inline ip4_addr_t
+ip4_prefix_t::mask() const {
+   return ip4_addr_t(
+      prefix_length_ ? htonl(0xFFFFFFFF << (32 - prefix_length_)) : 0);
+}
+
+inline
+ip4_prefix_t::operator ip_prefix_t() const {
+   return ip_prefix_t(network(), prefix_length_);
+}
+
+inline bool
+ip4_prefix_t::operator==(ip4_prefix_t const & other) const {
+   return !memcmp(addr_, other.addr_, sizeof(addr_)) &&
+          prefix_length_ == other.prefix_length_;
+}
+
+inline bool
+ip4_prefix_t::operator!=(ip4_prefix_t const & other) const {
+   return !operator==(other);
+}
+
+inline bool
+ip4_prefix_t::operator<(ip4_prefix_t const & other) const {
+   int cmp = memcmp(addr_, other.addr_, sizeof(addr_));
+   return cmp < 0 || (cmp == 0 && prefix_length_ < other.prefix_length_);
+}
+
+inline char *
+ip4_prefix_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << network() << '/' << prefix_length_;
+   return out.end();
+}
+
+inline std::string
+ip4_prefix_t::to_string() const {
+   return chars_writer::to_string(*this);
+}
+
+inline uint32_t
+ip4_prefix_t::hash() const {
+   // What ip_prefix_t::hash() computes for an AF_IPV4 prefix.
+   uint64_t word = (uint64_t(network().hash()) << 8) | prefix_length_;
+   return hash_mix::final_mix_word(hash_mix::mix_word(word, 0));
+}
+
+inline std::ostream&
+operator<<(std::ostream& os, const ip4_prefix_t& obj) {
+   os << obj.to_string();
+   return os;
+}
+
+
+
 inline ip_addr_mask_t::ip_addr_mask_t() :
       addr_(ip_addr_t()), mask_length_() {
 }
@@ -279,24 +438,23 @@ ip_addr_mask_t::mask() const {
 
 }
 
-inline std::string
-ip_addr_mask_t::to_string() const {
-
-   if (addr_.af() == AF_IPV6 || addr_.af() == AF_IPV4) {
-      // Emit the address/mask_length for IPV6/IPV4 addresses
-      char buf[128];
-      int rv;
-      rv = snprintf(buf, sizeof(buf), "%s/%d",
-                    addr_.to_string().c_str(), mask_length_);
-      assert(rv>0);
-      return std::string(buf);
-   } else {
+inline char *
+ip_addr_mask_t::to_chars(char * first, char * last) const {
+   if (addr_.af() != AF_IPV6 && addr_.af() != AF_IPV4) {
       panic(
          invalid_argument_error(
             "ip.ip_addr_mask_t",
             "Must have a valid address family to convert to string."));
    }
+   // Emit the address/mask_length for IPV6/IPV4 addresses
+   chars_writer out(first, last);
+   out << addr_ << '/' << mask_length_;
+   return out.end();
+}
 
+inline std::string
+ip_addr_mask_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline bool
@@ -322,13 +480,8 @@ ip_addr_mask_t::operator<(ip_addr_mask_t const & other) const {
 
 inline uint32_t
 ip_addr_mask_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&addr_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&mask_length_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   uint64_t word = (uint64_t(addr_.hash()) << 8) | mask_length_;
+   return hash_mix::final_mix_word(hash_mix::mix_word(word, 0));
 }
 
 inline std::ostream&
@@ -356,20 +509,21 @@ address_overlap_error::raise() const {
 
 inline uint32_t
 address_overlap_error::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&addr_,
-              sizeof(ip_addr_mask_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(addr_);
+}
+
+inline char *
+address_overlap_error::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "address_overlap_error(";
+   out << "addr=" << addr_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 address_overlap_error::to_string() const {
-   std::ostringstream ss;
-   ss << "address_overlap_error(";
-   ss << "addr=" << addr_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -6,19 +6,25 @@
 
 namespace DA {
 
+inline char const *
+enum_name(ip_route_action_t enum_val) {
+   switch (enum_val) {
+      case IP_ROUTE_ACTION_NULL:
+         return "IP_ROUTE_ACTION_NULL";
+      case IP_ROUTE_ACTION_FORWARD:
+         return "IP_ROUTE_ACTION_FORWARD";
+      case IP_ROUTE_ACTION_DROP:
+         return "IP_ROUTE_ACTION_DROP";
+      case IP_ROUTE_ACTION_NEXTHOP_GROUP:
+         return "IP_ROUTE_ACTION_NEXTHOP_GROUP";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const ip_route_action_t & enum_val) {
-   if (enum_val==IP_ROUTE_ACTION_NULL) {
-      os << "IP_ROUTE_ACTION_NULL";
-   } else if (enum_val==IP_ROUTE_ACTION_FORWARD) {
-      os << "IP_ROUTE_ACTION_FORWARD";
-   } else if (enum_val==IP_ROUTE_ACTION_DROP) {
-      os << "IP_ROUTE_ACTION_DROP";
-   } else if (enum_val==IP_ROUTE_ACTION_NEXTHOP_GROUP) {
-      os << "IP_ROUTE_ACTION_NEXTHOP_GROUP";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -70,23 +76,22 @@ ip_route_key_t::operator!=(ip_route_key_t const & other) const {
 
 inline uint32_t
 ip_route_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&prefix_,
-              sizeof(ip_prefix_t), ret);
-   ret = hash_mix::mix((uint8_t *)&preference_,
-              sizeof(ip_route_preference_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(prefix_, preference_);
+}
+
+inline char *
+ip_route_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "ip_route_key_t(";
+   out << "prefix=" << prefix_;
+   out << ", preference=" << preference_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 ip_route_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "ip_route_key_t(";
-   ss << "prefix=" << prefix_;
-   ss << ", preference=" << preference_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -138,23 +143,22 @@ ip_route_t::operator!=(ip_route_t const & other) const {
 
 inline uint32_t
 ip_route_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&key_,
-              sizeof(ip_route_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&tag_,
-              sizeof(ip_route_tag_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(key_, tag_);
+}
+
+inline char *
+ip_route_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "ip_route_t(";
+   out << "key=" << key_;
+   out << ", tag=" << tag_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 ip_route_t::to_string() const {
-   std::ostringstream ss;
-   ss << "ip_route_t(";
-   ss << "key=" << key_;
-   ss << ", tag=" << tag_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -274,40 +278,29 @@ ip_route_via_t::operator!=(ip_route_via_t const & other) const {
 
 inline uint32_t
 ip_route_via_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&route_key_,
-              sizeof(ip_route_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&hop_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret ^= std::hash<std::string>()(nexthop_group_);
-   ret = hash_mix::mix((uint8_t *)&mpls_label_,
-              sizeof(mpls_label_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vni_,
-              sizeof(vni_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vtep_addr_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&router_mac_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(route_key_, hop_, intf_, nexthop_group_, mpls_label_,
+                           vni_, vtep_addr_, router_mac_);
+}
+
+inline char *
+ip_route_via_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "ip_route_via_t(";
+   out << "route_key=" << route_key_;
+   out << ", hop=" << hop_;
+   out << ", intf=" << intf_;
+   out << ", nexthop_group='" << nexthop_group_ << "'";
+   out << ", mpls_label=" << mpls_label_;
+   out << ", vni=" << vni_;
+   out << ", vtep_addr=" << vtep_addr_;
+   out << ", router_mac=" << router_mac_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 ip_route_via_t::to_string() const {
-   std::ostringstream ss;
-   ss << "ip_route_via_t(";
-   ss << "route_key=" << route_key_;
-   ss << ", hop=" << hop_;
-   ss << ", intf=" << intf_;
-   ss << ", nexthop_group='" << nexthop_group_ << "'";
-   ss << ", mpls_label=" << mpls_label_;
-   ss << ", vni=" << vni_;
-   ss << ", vtep_addr=" << vtep_addr_;
-   ss << ", router_mac=" << router_mac_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
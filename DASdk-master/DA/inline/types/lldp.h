@@ -70,23 +70,22 @@ lldp_tlv_type_t::operator<(lldp_tlv_type_t const & other) const {
 
 inline uint32_t
 lldp_tlv_type_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&organization_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&subtype_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(organization_, subtype_);
+}
+
+inline char *
+lldp_tlv_type_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_tlv_type_t(";
+   out << "organization=" << organization_;
+   out << ", subtype=" << subtype_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_tlv_type_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_tlv_type_t(";
-   ss << "organization=" << organization_;
-   ss << ", subtype=" << subtype_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -97,33 +96,39 @@ operator<<(std::ostream& os, const lldp_tlv_type_t& obj) {
 
 
 
+inline char const *
+enum_name(lldp_std_tlv_type_bit_t enum_val) {
+   switch (enum_val) {
+      case LLDP_TLV_NONE:
+         return "LLDP_TLV_NONE";
+      case LLDP_TLV_CHASSIS_ID:
+         return "LLDP_TLV_CHASSIS_ID";
+      case LLDP_TLV_INTF_ID:
+         return "LLDP_TLV_INTF_ID";
+      case LLDP_TLV_INTF_DESCR:
+         return "LLDP_TLV_INTF_DESCR";
+      case LLDP_TLV_SYSTEM_CAP:
+         return "LLDP_TLV_SYSTEM_CAP";
+      case LLDP_TLV_MANAGEMENT:
+         return "LLDP_TLV_MANAGEMENT";
+      case LLDP_TLV_VLAN:
+         return "LLDP_TLV_VLAN";
+      case LLDP_TLV_MANAGMENT_VLAN:
+         return "LLDP_TLV_MANAGMENT_VLAN";
+      case LLDP_TLV_MAX_FRAME_SIZE:
+         return "LLDP_TLV_MAX_FRAME_SIZE";
+      case LLDP_TLV_LACP:
+         return "LLDP_TLV_LACP";
+      case LLDP_TLV_PHY:
+         return "LLDP_TLV_PHY";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const lldp_std_tlv_type_bit_t & enum_val) {
-   if (enum_val==LLDP_TLV_NONE) {
-      os << "LLDP_TLV_NONE";
-   } else if (enum_val==LLDP_TLV_CHASSIS_ID) {
-      os << "LLDP_TLV_CHASSIS_ID";
-   } else if (enum_val==LLDP_TLV_INTF_ID) {
-      os << "LLDP_TLV_INTF_ID";
-   } else if (enum_val==LLDP_TLV_INTF_DESCR) {
-      os << "LLDP_TLV_INTF_DESCR";
-   } else if (enum_val==LLDP_TLV_SYSTEM_CAP) {
-      os << "LLDP_TLV_SYSTEM_CAP";
-   } else if (enum_val==LLDP_TLV_MANAGEMENT) {
-      os << "LLDP_TLV_MANAGEMENT";
-   } else if (enum_val==LLDP_TLV_VLAN) {
-      os << "LLDP_TLV_VLAN";
-   } else if (enum_val==LLDP_TLV_MANAGMENT_VLAN) {
-      os << "LLDP_TLV_MANAGMENT_VLAN";
-   } else if (enum_val==LLDP_TLV_MAX_FRAME_SIZE) {
-      os << "LLDP_TLV_MAX_FRAME_SIZE";
-   } else if (enum_val==LLDP_TLV_LACP) {
-      os << "LLDP_TLV_LACP";
-   } else if (enum_val==LLDP_TLV_PHY) {
-      os << "LLDP_TLV_PHY";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -235,20 +240,21 @@ lldp_std_tlv_type_t::phy() const {
 
 inline uint32_t
 lldp_std_tlv_type_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&bitset_,
-              sizeof(lldp_std_tlv_type_bit_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(bitset_);
+}
+
+inline char *
+lldp_std_tlv_type_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_std_tlv_type_t(";
+   out << "bitset=" << bitset_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_std_tlv_type_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_std_tlv_type_t(";
-   ss << "bitset=" << bitset_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -259,27 +265,33 @@ operator<<(std::ostream& os, const lldp_std_tlv_type_t& obj) {
 
 
 
+inline char const *
+enum_name(lldp_syscap_bits_t enum_val) {
+   switch (enum_val) {
+      case LLDP_SYSCAP_OTHER:
+         return "LLDP_SYSCAP_OTHER";
+      case LLDP_SYSCAP_REPEATER:
+         return "LLDP_SYSCAP_REPEATER";
+      case LLDP_SYSCAP_BRIDGE:
+         return "LLDP_SYSCAP_BRIDGE";
+      case LLDP_SYSCAP_VLAN_AP:
+         return "LLDP_SYSCAP_VLAN_AP";
+      case LLDP_SYSCAP_ROUTER:
+         return "LLDP_SYSCAP_ROUTER";
+      case LLDP_SYSCAP_TELEPONE:
+         return "LLDP_SYSCAP_TELEPONE";
+      case LLDP_SYSCAP_DOCSIS:
+         return "LLDP_SYSCAP_DOCSIS";
+      case LLDP_SYSCAP_STATION:
+         return "LLDP_SYSCAP_STATION";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const lldp_syscap_bits_t & enum_val) {
-   if (enum_val==LLDP_SYSCAP_OTHER) {
-      os << "LLDP_SYSCAP_OTHER";
-   } else if (enum_val==LLDP_SYSCAP_REPEATER) {
-      os << "LLDP_SYSCAP_REPEATER";
-   } else if (enum_val==LLDP_SYSCAP_BRIDGE) {
-      os << "LLDP_SYSCAP_BRIDGE";
-   } else if (enum_val==LLDP_SYSCAP_VLAN_AP) {
-      os << "LLDP_SYSCAP_VLAN_AP";
-   } else if (enum_val==LLDP_SYSCAP_ROUTER) {
-      os << "LLDP_SYSCAP_ROUTER";
-   } else if (enum_val==LLDP_SYSCAP_TELEPONE) {
-      os << "LLDP_SYSCAP_TELEPONE";
-   } else if (enum_val==LLDP_SYSCAP_DOCSIS) {
-      os << "LLDP_SYSCAP_DOCSIS";
-   } else if (enum_val==LLDP_SYSCAP_STATION) {
-      os << "LLDP_SYSCAP_STATION";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -336,20 +348,21 @@ lldp_syscap_t::station() const {
 
 inline uint32_t
 lldp_syscap_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&bitset_,
-              sizeof(lldp_syscap_bits_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(bitset_);
+}
+
+inline char *
+lldp_syscap_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_syscap_t(";
+   out << "bitset=" << bitset_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_syscap_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_syscap_t(";
-   ss << "bitset=" << bitset_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -368,8 +381,8 @@ inline lldp_management_address_t::lldp_management_address_t() :
 inline lldp_management_address_t::lldp_management_address_t(
          uint32_t address_family, std::string address, uint32_t snmp_ifindex,
          std::string oid) :
-      address_family_(address_family), address_(address),
-      snmp_ifindex_(snmp_ifindex), oid_(oid) {
+      address_family_(address_family), address_(std::move(address)),
+      snmp_ifindex_(snmp_ifindex), oid_(std::move(oid)) {
 }
 
 inline uint32_t
@@ -394,27 +407,24 @@ lldp_management_address_t::oid() const {
 
 inline uint32_t
 lldp_management_address_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&address_family_,
-              sizeof(uint32_t), ret);
-   ret ^= std::hash<std::string>()(address_);
-   ret = hash_mix::mix((uint8_t *)&snmp_ifindex_,
-              sizeof(uint32_t), ret);
-   ret ^= std::hash<std::string>()(oid_);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(address_family_, address_, snmp_ifindex_, oid_);
+}
+
+inline char *
+lldp_management_address_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_management_address_t(";
+   out << "address_family=" << address_family_;
+   out << ", address='" << address_ << "'";
+   out << ", snmp_ifindex=" << snmp_ifindex_;
+   out << ", oid='" << oid_ << "'";
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_management_address_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_management_address_t(";
-   ss << "address_family=" << address_family_;
-   ss << ", address='" << address_ << "'";
-   ss << ", snmp_ifindex=" << snmp_ifindex_;
-   ss << ", oid='" << oid_ << "'";
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -463,29 +473,24 @@ lldp_lacp_t::operator!() const {
 
 inline uint32_t
 lldp_lacp_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&capable_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&enabled_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&id_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&valid_,
-              sizeof(bool), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(capable_, enabled_, id_, valid_);
+}
+
+inline char *
+lldp_lacp_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_lacp_t(";
+   out << "capable=" << capable_;
+   out << ", enabled=" << enabled_;
+   out << ", id=" << id_;
+   out << ", valid=" << valid_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_lacp_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_lacp_t(";
-   ss << "capable=" << capable_;
-   ss << ", enabled=" << enabled_;
-   ss << ", id=" << id_;
-   ss << ", valid=" << valid_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -530,29 +535,25 @@ lldp_phy_t::valid() const {
 
 inline uint32_t
 lldp_phy_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&autonegSupported_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&autonegEnabled_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&autonegCapabilitiesBm_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&valid_,
-              sizeof(bool), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(autonegSupported_, autonegEnabled_,
+                           autonegCapabilitiesBm_, valid_);
+}
+
+inline char *
+lldp_phy_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_phy_t(";
+   out << "autonegSupported=" << autonegSupported_;
+   out << ", autonegEnabled=" << autonegEnabled_;
+   out << ", autonegCapabilitiesBm=" << autonegCapabilitiesBm_;
+   out << ", valid=" << valid_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_phy_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_phy_t(";
-   ss << "autonegSupported=" << autonegSupported_;
-   ss << ", autonegEnabled=" << autonegEnabled_;
-   ss << ", autonegCapabilitiesBm=" << autonegCapabilitiesBm_;
-   ss << ", valid=" << valid_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -563,49 +564,61 @@ operator<<(std::ostream& os, const lldp_phy_t& obj) {
 
 
 
+inline char const *
+enum_name(lldp_intf_enabled_t enum_val) {
+   switch (enum_val) {
+      case LLDP_INTF_STATUS_NULL:
+         return "LLDP_INTF_STATUS_NULL";
+      case LLDP_INTF_ENABLE_TX:
+         return "LLDP_INTF_ENABLE_TX";
+      case LLDP_INTF_ENABLE_RX:
+         return "LLDP_INTF_ENABLE_RX";
+      case LLDP_INTF_ENABLE_BIDIR:
+         return "LLDP_INTF_ENABLE_BIDIR";
+      case LLDP_INTF_DISABLE:
+         return "LLDP_INTF_DISABLE";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const lldp_intf_enabled_t & enum_val) {
-   if (enum_val==LLDP_INTF_STATUS_NULL) {
-      os << "LLDP_INTF_STATUS_NULL";
-   } else if (enum_val==LLDP_INTF_ENABLE_TX) {
-      os << "LLDP_INTF_ENABLE_TX";
-   } else if (enum_val==LLDP_INTF_ENABLE_RX) {
-      os << "LLDP_INTF_ENABLE_RX";
-   } else if (enum_val==LLDP_INTF_ENABLE_BIDIR) {
-      os << "LLDP_INTF_ENABLE_BIDIR";
-   } else if (enum_val==LLDP_INTF_DISABLE) {
-      os << "LLDP_INTF_DISABLE";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(lldp_chassis_id_encoding_t enum_val) {
+   switch (enum_val) {
+      case LLDP_CHASSIS_RESERVED:
+         return "LLDP_CHASSIS_RESERVED";
+      case LLDP_CHASSIS_COMPONENT:
+         return "LLDP_CHASSIS_COMPONENT";
+      case LLDP_CHASSIS_INTF_ALIAS:
+         return "LLDP_CHASSIS_INTF_ALIAS";
+      case LLDP_CHASSIS_PORT_COMPONENT:
+         return "LLDP_CHASSIS_PORT_COMPONENT";
+      case LLDP_CHASSIS_MAC_ADDR:
+         return "LLDP_CHASSIS_MAC_ADDR";
+      case LLDP_CHASSIS_NET_ADDR:
+         return "LLDP_CHASSIS_NET_ADDR";
+      case LLDP_CHASSIS_INTF_NAME:
+         return "LLDP_CHASSIS_INTF_NAME";
+      case LLDP_CHASSIS_LOCAL:
+         return "LLDP_CHASSIS_LOCAL";
+      case LLDP_CHASSIS_NULL:
+         return "LLDP_CHASSIS_NULL";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const lldp_chassis_id_encoding_t & enum_val) {
-   if (enum_val==LLDP_CHASSIS_RESERVED) {
-      os << "LLDP_CHASSIS_RESERVED";
-   } else if (enum_val==LLDP_CHASSIS_COMPONENT) {
-      os << "LLDP_CHASSIS_COMPONENT";
-   } else if (enum_val==LLDP_CHASSIS_INTF_ALIAS) {
-      os << "LLDP_CHASSIS_INTF_ALIAS";
-   } else if (enum_val==LLDP_CHASSIS_PORT_COMPONENT) {
-      os << "LLDP_CHASSIS_PORT_COMPONENT";
-   } else if (enum_val==LLDP_CHASSIS_MAC_ADDR) {
-      os << "LLDP_CHASSIS_MAC_ADDR";
-   } else if (enum_val==LLDP_CHASSIS_NET_ADDR) {
-      os << "LLDP_CHASSIS_NET_ADDR";
-   } else if (enum_val==LLDP_CHASSIS_INTF_NAME) {
-      os << "LLDP_CHASSIS_INTF_NAME";
-   } else if (enum_val==LLDP_CHASSIS_LOCAL) {
-      os << "LLDP_CHASSIS_LOCAL";
-   } else if (enum_val==LLDP_CHASSIS_NULL) {
-      os << "LLDP_CHASSIS_NULL";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -618,7 +631,7 @@ inline lldp_chassis_id_t::lldp_chassis_id_t() :
 // chassis name, full constructor.
 inline lldp_chassis_id_t::lldp_chassis_id_t(lldp_chassis_id_encoding_t encoding,
                                             std::string value) :
-      encoding_(encoding), value_(value) {
+      encoding_(encoding), value_(std::move(value)) {
 }
 
 inline lldp_chassis_id_encoding_t
@@ -709,22 +722,22 @@ lldp_chassis_id_t::operator<(lldp_chassis_id_t const & other) const {
 
 inline uint32_t
 lldp_chassis_id_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&encoding_,
-              sizeof(lldp_chassis_id_encoding_t), ret);
-   ret ^= std::hash<std::string>()(value_);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(encoding_, value_);
+}
+
+inline char *
+lldp_chassis_id_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_chassis_id_t(";
+   out << "encoding=" << encoding_;
+   out << ", value='" << value_ << "'";
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_chassis_id_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_chassis_id_t(";
-   ss << "encoding=" << encoding_;
-   ss << ", value='" << value_ << "'";
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -735,29 +748,35 @@ operator<<(std::ostream& os, const lldp_chassis_id_t& obj) {
 
 
 
+inline char const *
+enum_name(lldp_intf_id_encoding_t enum_val) {
+   switch (enum_val) {
+      case LLDP_INTF_RESERVED:
+         return "LLDP_INTF_RESERVED";
+      case LLDP_INTF_ALIAS:
+         return "LLDP_INTF_ALIAS";
+      case LLDP_INTF_COMPONENT:
+         return "LLDP_INTF_COMPONENT";
+      case LLDP_INTF_MAC_ADDR:
+         return "LLDP_INTF_MAC_ADDR";
+      case LLDP_INTF_NET_ADDR:
+         return "LLDP_INTF_NET_ADDR";
+      case LLDP_INTF_NAME:
+         return "LLDP_INTF_NAME";
+      case LLDP_INTF_CIRCUIT:
+         return "LLDP_INTF_CIRCUIT";
+      case LLDP_INTF_LOCAL:
+         return "LLDP_INTF_LOCAL";
+      case LLDP_INTF_NULL:
+         return "LLDP_INTF_NULL";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const lldp_intf_id_encoding_t & enum_val) {
-   if (enum_val==LLDP_INTF_RESERVED) {
-      os << "LLDP_INTF_RESERVED";
-   } else if (enum_val==LLDP_INTF_ALIAS) {
-      os << "LLDP_INTF_ALIAS";
-   } else if (enum_val==LLDP_INTF_COMPONENT) {
-      os << "LLDP_INTF_COMPONENT";
-   } else if (enum_val==LLDP_INTF_MAC_ADDR) {
-      os << "LLDP_INTF_MAC_ADDR";
-   } else if (enum_val==LLDP_INTF_NET_ADDR) {
-      os << "LLDP_INTF_NET_ADDR";
-   } else if (enum_val==LLDP_INTF_NAME) {
-      os << "LLDP_INTF_NAME";
-   } else if (enum_val==LLDP_INTF_CIRCUIT) {
-      os << "LLDP_INTF_CIRCUIT";
-   } else if (enum_val==LLDP_INTF_LOCAL) {
-      os << "LLDP_INTF_LOCAL";
-   } else if (enum_val==LLDP_INTF_NULL) {
-      os << "LLDP_INTF_NULL";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -770,7 +789,7 @@ inline lldp_intf_id_t::lldp_intf_id_t() :
 // interface name, full constructor.
 inline lldp_intf_id_t::lldp_intf_id_t(lldp_intf_id_encoding_t encoding,
                                       std::string value) :
-      encoding_(encoding), value_(value) {
+      encoding_(encoding), value_(std::move(value)) {
 }
 
 inline lldp_intf_id_encoding_t
@@ -860,22 +879,22 @@ lldp_intf_id_t::operator<(lldp_intf_id_t const & other) const {
 
 inline uint32_t
 lldp_intf_id_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&encoding_,
-              sizeof(lldp_intf_id_encoding_t), ret);
-   ret ^= std::hash<std::string>()(value_);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(encoding_, value_);
+}
+
+inline char *
+lldp_intf_id_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_intf_id_t(";
+   out << "encoding=" << encoding_;
+   out << ", value='" << value_ << "'";
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_intf_id_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_intf_id_t(";
-   ss << "encoding=" << encoding_;
-   ss << ", value='" << value_ << "'";
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -950,23 +969,22 @@ lldp_remote_system_t::operator<(lldp_remote_system_t const & other) const {
 
 inline uint32_t
 lldp_remote_system_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&chassis_,
-              sizeof(lldp_chassis_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&port_,
-              sizeof(lldp_intf_id_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(chassis_, port_);
+}
+
+inline char *
+lldp_remote_system_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_remote_system_t(";
+   out << "chassis=" << chassis_;
+   out << ", port=" << port_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_remote_system_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_remote_system_t(";
-   ss << "chassis=" << chassis_;
-   ss << ", port=" << port_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -1047,23 +1065,22 @@ lldp_neighbor_t::operator<(lldp_neighbor_t const & other) const {
 
 inline uint32_t
 lldp_neighbor_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&remote_system_,
-              sizeof(lldp_remote_system_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(intf_, remote_system_);
+}
+
+inline char *
+lldp_neighbor_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "lldp_neighbor_t(";
+   out << "intf=" << intf_;
+   out << ", remote_system=" << remote_system_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 lldp_neighbor_t::to_string() const {
-   std::ostringstream ss;
-   ss << "lldp_neighbor_t(";
-   ss << "intf=" << intf_;
-   ss << ", remote_system=" << remote_system_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
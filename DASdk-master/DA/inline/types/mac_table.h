@@ -6,97 +6,123 @@
 
 namespace DA {
 
+inline char const *
+enum_name(mac_entry_type_t enum_val) {
+   switch (enum_val) {
+      case MAC_ENTRY_NULL:
+         return "MAC_ENTRY_NULL";
+      case MAC_ENTRY_LEARNED_DYNAMIC:
+         return "MAC_ENTRY_LEARNED_DYNAMIC";
+      case MAC_ENTRY_LEARNED_SECURE:
+         return "MAC_ENTRY_LEARNED_SECURE";
+      case MAC_ENTRY_CONFIGURED_DYNAMIC:
+         return "MAC_ENTRY_CONFIGURED_DYNAMIC";
+      case MAC_ENTRY_CONFIGURED_SECURE:
+         return "MAC_ENTRY_CONFIGURED_SECURE";
+      case MAC_ENTRY_CONFIGURED_STATIC:
+         return "MAC_ENTRY_CONFIGURED_STATIC";
+      case MAC_ENTRY_PEER_DYNAMIC:
+         return "MAC_ENTRY_PEER_DYNAMIC";
+      case MAC_ENTRY_PEER_STATIC:
+         return "MAC_ENTRY_PEER_STATIC";
+      case MAC_ENTRY_PEER_SECURE:
+         return "MAC_ENTRY_PEER_SECURE";
+      case MAC_ENTRY_LEARNED_REMOTE:
+         return "MAC_ENTRY_LEARNED_REMOTE";
+      case MAC_ENTRY_CONFIGURED_REMOTE:
+         return "MAC_ENTRY_CONFIGURED_REMOTE";
+      case MAC_ENTRY_RECEIVED_REMOTE:
+         return "MAC_ENTRY_RECEIVED_REMOTE";
+      case MAC_ENTRY_PEER_LEARNED_REMOTE:
+         return "MAC_ENTRY_PEER_LEARNED_REMOTE";
+      case MAC_ENTRY_PEER_CONFIGURED_REMOTE:
+         return "MAC_ENTRY_PEER_CONFIGURED_REMOTE";
+      case MAC_ENTRY_PEER_RECEIVED_REMOTE:
+         return "MAC_ENTRY_PEER_RECEIVED_REMOTE";
+      case MAC_ENTRY_EVPN_DYNAMIC_REMOTE:
+         return "MAC_ENTRY_EVPN_DYNAMIC_REMOTE";
+      case MAC_ENTRY_EVPN_CONFIGURED_REMOTE:
+         return "MAC_ENTRY_EVPN_CONFIGURED_REMOTE";
+      case MAC_ENTRY_PEER_EVPN_REMOTE:
+         return "MAC_ENTRY_PEER_EVPN_REMOTE";
+      case MAC_ENTRY_CONFIGURED_ROUTER:
+         return "MAC_ENTRY_CONFIGURED_ROUTER";
+      case MAC_ENTRY_PEER_ROUTER:
+         return "MAC_ENTRY_PEER_ROUTER";
+      case MAC_ENTRY_EVPN_INTF:
+         return "MAC_ENTRY_EVPN_INTF";
+      case MAC_ENTRY_EVPN_REMOTE_MAC:
+         return "MAC_ENTRY_EVPN_REMOTE_MAC";
+      case MAC_ENTRY_PEER_EVPN_REMOTE_MAC:
+         return "MAC_ENTRY_PEER_EVPN_REMOTE_MAC";
+      case MAC_ENTRY_EVPN_INTF_DYNAMIC:
+         return "MAC_ENTRY_EVPN_INTF_DYNAMIC";
+      case MAC_ENTRY_EVPN_INTF_STATIC:
+         return "MAC_ENTRY_EVPN_INTF_STATIC";
+      case MAC_ENTRY_AUTHENTICATED:
+         return "MAC_ENTRY_AUTHENTICATED";
+      case MAC_ENTRY_PEER_AUTHENTICATED:
+         return "MAC_ENTRY_PEER_AUTHENTICATED";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const mac_entry_type_t & enum_val) {
-   if (enum_val==MAC_ENTRY_NULL) {
-      os << "MAC_ENTRY_NULL";
-   } else if (enum_val==MAC_ENTRY_LEARNED_DYNAMIC) {
-      os << "MAC_ENTRY_LEARNED_DYNAMIC";
-   } else if (enum_val==MAC_ENTRY_LEARNED_SECURE) {
-      os << "MAC_ENTRY_LEARNED_SECURE";
-   } else if (enum_val==MAC_ENTRY_CONFIGURED_DYNAMIC) {
-      os << "MAC_ENTRY_CONFIGURED_DYNAMIC";
-   } else if (enum_val==MAC_ENTRY_CONFIGURED_SECURE) {
-      os << "MAC_ENTRY_CONFIGURED_SECURE";
-   } else if (enum_val==MAC_ENTRY_CONFIGURED_STATIC) {
-      os << "MAC_ENTRY_CONFIGURED_STATIC";
-   } else if (enum_val==MAC_ENTRY_PEER_DYNAMIC) {
-      os << "MAC_ENTRY_PEER_DYNAMIC";
-   } else if (enum_val==MAC_ENTRY_PEER_STATIC) {
-      os << "MAC_ENTRY_PEER_STATIC";
-   } else if (enum_val==MAC_ENTRY_PEER_SECURE) {
-      os << "MAC_ENTRY_PEER_SECURE";
-   } else if (enum_val==MAC_ENTRY_LEARNED_REMOTE) {
-      os << "MAC_ENTRY_LEARNED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_CONFIGURED_REMOTE) {
-      os << "MAC_ENTRY_CONFIGURED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_RECEIVED_REMOTE) {
-      os << "MAC_ENTRY_RECEIVED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_PEER_LEARNED_REMOTE) {
-      os << "MAC_ENTRY_PEER_LEARNED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_PEER_CONFIGURED_REMOTE) {
-      os << "MAC_ENTRY_PEER_CONFIGURED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_PEER_RECEIVED_REMOTE) {
-      os << "MAC_ENTRY_PEER_RECEIVED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_EVPN_DYNAMIC_REMOTE) {
-      os << "MAC_ENTRY_EVPN_DYNAMIC_REMOTE";
-   } else if (enum_val==MAC_ENTRY_EVPN_CONFIGURED_REMOTE) {
-      os << "MAC_ENTRY_EVPN_CONFIGURED_REMOTE";
-   } else if (enum_val==MAC_ENTRY_PEER_EVPN_REMOTE) {
-      os << "MAC_ENTRY_PEER_EVPN_REMOTE";
-   } else if (enum_val==MAC_ENTRY_CONFIGURED_ROUTER) {
-      os << "MAC_ENTRY_CONFIGURED_ROUTER";
-   } else if (enum_val==MAC_ENTRY_PEER_ROUTER) {
-      os << "MAC_ENTRY_PEER_ROUTER";
-   } else if (enum_val==MAC_ENTRY_EVPN_INTF) {
-      os << "MAC_ENTRY_EVPN_INTF";
-   } else if (enum_val==MAC_ENTRY_EVPN_REMOTE_MAC) {
-      os << "MAC_ENTRY_EVPN_REMOTE_MAC";
-   } else if (enum_val==MAC_ENTRY_PEER_EVPN_REMOTE_MAC) {
-      os << "MAC_ENTRY_PEER_EVPN_REMOTE_MAC";
-   } else if (enum_val==MAC_ENTRY_EVPN_INTF_DYNAMIC) {
-      os << "MAC_ENTRY_EVPN_INTF_DYNAMIC";
-   } else if (enum_val==MAC_ENTRY_EVPN_INTF_STATIC) {
-      os << "MAC_ENTRY_EVPN_INTF_STATIC";
-   } else if (enum_val==MAC_ENTRY_AUTHENTICATED) {
-      os << "MAC_ENTRY_AUTHENTICATED";
-   } else if (enum_val==MAC_ENTRY_PEER_AUTHENTICATED) {
-      os << "MAC_ENTRY_PEER_AUTHENTICATED";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
-inline mac_key_t::mac_key_t() :
-      vlan_id_(), eth_addr_() {
+inline mac_key_t::mac_key_t() {
+   word_is(0);
+}
+
+inline mac_key_t::mac_key_t(vlan_id_t vlan_id, eth_addr_t const & eth_addr) {
+   uint8_t bytes[6];
+   eth_addr.bytes(bytes);
+   uint64_t word = uint64_t(vlan_id) << 48;
+   for (int i = 0; i < 6; ++i) {
+      word |= uint64_t(bytes[i]) << (40 - 8 * i);
+   }
+   word_is(word);
+}
+
+inline uint64_t
+mac_key_t::word() const {
+   uint64_t word;
+   std::memcpy(&word, key_, sizeof(word));
+   return word;
 }
 
-inline mac_key_t::mac_key_t(vlan_id_t vlan_id, eth_addr_t const & eth_addr) :
-      vlan_id_(vlan_id), eth_addr_(eth_addr) {
+inline void
+mac_key_t::word_is(uint64_t word) {
+   std::memcpy(key_, &word, sizeof(word));
 }
 
 inline vlan_id_t
 mac_key_t::vlan_id() const {
-   return vlan_id_;
+   return vlan_id_t(word() >> 48);
 }
 
 inline eth_addr_t
 mac_key_t::eth_addr() const {
-   return eth_addr_;
+   uint64_t word = this->word();
+   return eth_addr_t(uint8_t(word >> 40), uint8_t(word >> 32),
+                     uint8_t(word >> 24), uint8_t(word >> 16),
+                     uint8_t(word >> 8), uint8_t(word));
 }
 
 inline bool
 mac_key_t::operator!() const {
-   return !vlan_id_ && !eth_addr_;
+   return !word();
 }
 
 inline bool
 mac_key_t::operator==(mac_key_t const & other) const {
-   return vlan_id_ == other.vlan_id_ &&
-          eth_addr_ == other.eth_addr_;
+   return word() == other.word();
 }
 
 inline bool
@@ -106,33 +132,28 @@ mac_key_t::operator!=(mac_key_t const & other) const {
 
 inline bool
 mac_key_t::operator<(mac_key_t const & other) const {
-   if(vlan_id_ != other.vlan_id_) {
-      return vlan_id_ < other.vlan_id_;
-   } else if(eth_addr_ != other.eth_addr_) {
-      return eth_addr_ < other.eth_addr_;
-   }
-   return false;
+   // Orders by VLAN, then by address, like comparing the fields would.
+   return word() < other.word();
 }
 
 inline uint32_t
 mac_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&vlan_id_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_addr_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::final_mix_word(hash_mix::mix_word(word(), 0));
+}
+
+inline char *
+mac_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mac_key_t(";
+   out << "vlan_id=" << vlan_id();
+   out << ", eth_addr=" << eth_addr();
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mac_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mac_key_t(";
-   ss << "vlan_id=" << vlan_id_;
-   ss << ", eth_addr=" << eth_addr_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -188,6 +209,13 @@ mac_entry_t::intfs_is(std::set<intf_id_t> const & intfs) {
    intfs_ = intfs;
 }
 
+#ifndef SWIG
+inline void
+mac_entry_t::intfs_is(std::set<intf_id_t> && intfs) {
+   intfs_ = std::move(intfs);
+}
+#endif
+
 inline void
 mac_entry_t::intf_set(intf_id_t const & value) {
    intfs_.insert(value);
@@ -236,35 +264,32 @@ mac_entry_t::operator!=(mac_entry_t const & other) const {
 
 inline uint32_t
 mac_entry_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&mac_key_,
-              sizeof(mac_key_t), ret);
-   for (auto it=intfs_.cbegin(); it!=intfs_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(intf_id_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(mac_key_, intfs_);
 }
 
-inline std::string
-mac_entry_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mac_entry_t(";
-   ss << "mac_key=" << mac_key_;
-   ss << ", intfs=" <<"'";
+inline char *
+mac_entry_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mac_entry_t(";
+   out << "mac_key=" << mac_key_;
+   out << ", intfs=" <<"'";
    bool first_intfs = true;
    for (auto it=intfs_.cbegin(); it!=intfs_.cend(); ++it) {
       if (first_intfs) {
-         ss << (*it);
+         out << (*it);
          first_intfs = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+mac_entry_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
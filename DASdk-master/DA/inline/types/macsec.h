@@ -6,35 +6,47 @@
 
 namespace DA {
 
+inline char const *
+enum_name(macsec_cipher_suite_t enum_val) {
+   switch (enum_val) {
+      case CIPHER_NULL:
+         return "CIPHER_NULL";
+      case GCM_AES_XPN_128:
+         return "GCM_AES_XPN_128";
+      case GCM_AES_XPN_256:
+         return "GCM_AES_XPN_256";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const macsec_cipher_suite_t & enum_val) {
-   if (enum_val==CIPHER_NULL) {
-      os << "CIPHER_NULL";
-   } else if (enum_val==GCM_AES_XPN_128) {
-      os << "GCM_AES_XPN_128";
-   } else if (enum_val==GCM_AES_XPN_256) {
-      os << "GCM_AES_XPN_256";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(macsec_intf_key_status_t enum_val) {
+   switch (enum_val) {
+      case MACSEC_NO_PROFILE:
+         return "MACSEC_NO_PROFILE";
+      case MACSEC_KEY_NONE:
+         return "MACSEC_KEY_NONE";
+      case MACSEC_KEY_PRIMARY:
+         return "MACSEC_KEY_PRIMARY";
+      case MACSEC_KEY_FALLBACK:
+         return "MACSEC_KEY_FALLBACK";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const macsec_intf_key_status_t & enum_val) {
-   if (enum_val==MACSEC_NO_PROFILE) {
-      os << "MACSEC_NO_PROFILE";
-   } else if (enum_val==MACSEC_KEY_NONE) {
-      os << "MACSEC_KEY_NONE";
-   } else if (enum_val==MACSEC_KEY_PRIMARY) {
-      os << "MACSEC_KEY_PRIMARY";
-   } else if (enum_val==MACSEC_KEY_FALLBACK) {
-      os << "MACSEC_KEY_FALLBACK";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -51,7 +63,7 @@ macsec_key_t::cak() const {
 
 inline void
 macsec_key_t::cak_is(std::string cak) {
-   cak_ = cak;
+   cak_ = std::move(cak);
 }
 
 inline std::string
@@ -61,7 +73,7 @@ macsec_key_t::ckn() const {
 
 inline void
 macsec_key_t::ckn_is(std::string ckn) {
-   ckn_ = ckn;
+   ckn_ = std::move(ckn);
 }
 
 inline bool
@@ -100,24 +112,23 @@ macsec_key_t::operator<(macsec_key_t const & other) const {
 
 inline uint32_t
 macsec_key_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(cak_);
-   ret ^= std::hash<std::string>()(ckn_);
-   ret = hash_mix::mix((uint8_t *)&encoded_,
-              sizeof(bool), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(cak_, ckn_, encoded_);
+}
+
+inline char *
+macsec_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "macsec_key_t(";
+   out << "cak='" << cak_ << "'";
+   out << ", ckn='" << ckn_ << "'";
+   out << ", encoded=" << encoded_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 macsec_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "macsec_key_t(";
-   ss << "cak='" << cak_ << "'";
-   ss << ", ckn='" << ckn_ << "'";
-   ss << ", encoded=" << encoded_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -260,41 +271,29 @@ macsec_profile_t::operator<(macsec_profile_t const & other) const {
 
 inline uint32_t
 macsec_profile_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&name_,
-              sizeof(macsec_profile_name_t), ret);
-   ret = hash_mix::mix((uint8_t *)&primary_key_,
-              sizeof(macsec_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&fallback_key_,
-              sizeof(macsec_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&key_server_priority_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::mix((uint8_t *)&rekey_period_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::mix((uint8_t *)&cipher_,
-              sizeof(macsec_cipher_suite_t), ret);
-   ret = hash_mix::mix((uint8_t *)&dot1x_,
-              sizeof(bool), ret);
-   ret = hash_mix::mix((uint8_t *)&include_sci_,
-              sizeof(bool), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(name_, primary_key_, fallback_key_, key_server_priority_,
+                           rekey_period_, cipher_, dot1x_, include_sci_);
+}
+
+inline char *
+macsec_profile_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "macsec_profile_t(";
+   out << "name=" << name_;
+   out << ", primary_key=" << primary_key_;
+   out << ", fallback_key=" << fallback_key_;
+   out << ", key_server_priority=" << key_server_priority_;
+   out << ", rekey_period=" << rekey_period_;
+   out << ", cipher=" << cipher_;
+   out << ", dot1x=" << dot1x_;
+   out << ", include_sci=" << include_sci_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 macsec_profile_t::to_string() const {
-   std::ostringstream ss;
-   ss << "macsec_profile_t(";
-   ss << "name=" << name_;
-   ss << ", primary_key=" << primary_key_;
-   ss << ", fallback_key=" << fallback_key_;
-   ss << ", key_server_priority=" << key_server_priority_;
-   ss << ", rekey_period=" << rekey_period_;
-   ss << ", cipher=" << cipher_;
-   ss << ", dot1x=" << dot1x_;
-   ss << ", include_sci=" << include_sci_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -339,20 +338,21 @@ macsec_intf_status_t::operator<(macsec_intf_status_t const & other) const {
 
 inline uint32_t
 macsec_intf_status_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&status_,
-              sizeof(macsec_intf_key_status_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(status_);
+}
+
+inline char *
+macsec_intf_status_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "macsec_intf_status_t(";
+   out << "status=" << status_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 macsec_intf_status_t::to_string() const {
-   std::ostringstream ss;
-   ss << "macsec_intf_status_t(";
-   ss << "status=" << status_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -436,32 +436,27 @@ macsec_intf_counters_t::operator<(macsec_intf_counters_t const & other) const {
 
 inline uint32_t
 macsec_intf_counters_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&out_pkts_encrypted_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&out_octets_encrypted_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_pkts_decrypted_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_octets_decrypted_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&in_pkts_not_valid_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(out_pkts_encrypted_, out_octets_encrypted_,
+                           in_pkts_decrypted_, in_octets_decrypted_,
+                           in_pkts_not_valid_);
+}
+
+inline char *
+macsec_intf_counters_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "macsec_intf_counters_t(";
+   out << "out_pkts_encrypted=" << out_pkts_encrypted_;
+   out << ", out_octets_encrypted=" << out_octets_encrypted_;
+   out << ", in_pkts_decrypted=" << in_pkts_decrypted_;
+   out << ", in_octets_decrypted=" << in_octets_decrypted_;
+   out << ", in_pkts_not_valid=" << in_pkts_not_valid_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 macsec_intf_counters_t::to_string() const {
-   std::ostringstream ss;
-   ss << "macsec_intf_counters_t(";
-   ss << "out_pkts_encrypted=" << out_pkts_encrypted_;
-   ss << ", out_octets_encrypted=" << out_octets_encrypted_;
-   ss << ", in_pkts_decrypted=" << in_pkts_decrypted_;
-   ss << ", in_octets_decrypted=" << in_octets_decrypted_;
-   ss << ", in_pkts_not_valid=" << in_pkts_not_valid_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -6,21 +6,27 @@
 
 namespace DA {
 
+inline char const *
+enum_name(mlag_state_t enum_val) {
+   switch (enum_val) {
+      case MLAG_STATE_UNKNOWN:
+         return "MLAG_STATE_UNKNOWN";
+      case MLAG_STATE_DISABLED:
+         return "MLAG_STATE_DISABLED";
+      case MLAG_STATE_INACTIVE:
+         return "MLAG_STATE_INACTIVE";
+      case MLAG_STATE_PRIMARY:
+         return "MLAG_STATE_PRIMARY";
+      case MLAG_STATE_SECONDARY:
+         return "MLAG_STATE_SECONDARY";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const mlag_state_t & enum_val) {
-   if (enum_val==MLAG_STATE_UNKNOWN) {
-      os << "MLAG_STATE_UNKNOWN";
-   } else if (enum_val==MLAG_STATE_DISABLED) {
-      os << "MLAG_STATE_DISABLED";
-   } else if (enum_val==MLAG_STATE_INACTIVE) {
-      os << "MLAG_STATE_INACTIVE";
-   } else if (enum_val==MLAG_STATE_PRIMARY) {
-      os << "MLAG_STATE_PRIMARY";
-   } else if (enum_val==MLAG_STATE_SECONDARY) {
-      os << "MLAG_STATE_SECONDARY";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -12,57 +12,75 @@ namespace DA {
 invalid_range_error invalid_mpls_label(uint32_t label) DA_SDK_INTERNAL;
 
 
+inline char const *
+enum_name(mpls_action_t enum_val) {
+   switch (enum_val) {
+      case MPLS_ACTION_NULL:
+         return "MPLS_ACTION_NULL";
+      case MPLS_ACTION_PUSH:
+         return "MPLS_ACTION_PUSH";
+      case MPLS_ACTION_POP:
+         return "MPLS_ACTION_POP";
+      case MPLS_ACTION_SWAP:
+         return "MPLS_ACTION_SWAP";
+      case MPLS_ACTION_FORWARD:
+         return "MPLS_ACTION_FORWARD";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const mpls_action_t & enum_val) {
-   if (enum_val==MPLS_ACTION_NULL) {
-      os << "MPLS_ACTION_NULL";
-   } else if (enum_val==MPLS_ACTION_PUSH) {
-      os << "MPLS_ACTION_PUSH";
-   } else if (enum_val==MPLS_ACTION_POP) {
-      os << "MPLS_ACTION_POP";
-   } else if (enum_val==MPLS_ACTION_SWAP) {
-      os << "MPLS_ACTION_SWAP";
-   } else if (enum_val==MPLS_ACTION_FORWARD) {
-      os << "MPLS_ACTION_FORWARD";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(mpls_ttl_mode_t enum_val) {
+   switch (enum_val) {
+      case MPLS_TTLMODE_NULL:
+         return "MPLS_TTLMODE_NULL";
+      case MPLS_TTLMODE_PIPE:
+         return "MPLS_TTLMODE_PIPE";
+      case MPLS_TTLMODE_UNIFORM:
+         return "MPLS_TTLMODE_UNIFORM";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const mpls_ttl_mode_t & enum_val) {
-   if (enum_val==MPLS_TTLMODE_NULL) {
-      os << "MPLS_TTLMODE_NULL";
-   } else if (enum_val==MPLS_TTLMODE_PIPE) {
-      os << "MPLS_TTLMODE_PIPE";
-   } else if (enum_val==MPLS_TTLMODE_UNIFORM) {
-      os << "MPLS_TTLMODE_UNIFORM";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(mpls_payload_type_t enum_val) {
+   switch (enum_val) {
+      case MPLS_PAYLOAD_TYPE_NULL:
+         return "MPLS_PAYLOAD_TYPE_NULL";
+      case MPLS_PAYLOAD_TYPE_MPLS:
+         return "MPLS_PAYLOAD_TYPE_MPLS";
+      case MPLS_PAYLOAD_TYPE_IPV4:
+         return "MPLS_PAYLOAD_TYPE_IPV4";
+      case MPLS_PAYLOAD_TYPE_IPV6:
+         return "MPLS_PAYLOAD_TYPE_IPV6";
+      case MPLS_PAYLOAD_TYPE_GUESS:
+         return "MPLS_PAYLOAD_TYPE_GUESS";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const mpls_payload_type_t & enum_val) {
-   if (enum_val==MPLS_PAYLOAD_TYPE_NULL) {
-      os << "MPLS_PAYLOAD_TYPE_NULL";
-   } else if (enum_val==MPLS_PAYLOAD_TYPE_MPLS) {
-      os << "MPLS_PAYLOAD_TYPE_MPLS";
-   } else if (enum_val==MPLS_PAYLOAD_TYPE_IPV4) {
-      os << "MPLS_PAYLOAD_TYPE_IPV4";
-   } else if (enum_val==MPLS_PAYLOAD_TYPE_IPV6) {
-      os << "MPLS_PAYLOAD_TYPE_IPV6";
-   } else if (enum_val==MPLS_PAYLOAD_TYPE_GUESS) {
-      os << "MPLS_PAYLOAD_TYPE_GUESS";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -105,20 +123,21 @@ mpls_label_t::operator<(mpls_label_t const & other) const {
 
 inline uint32_t
 mpls_label_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&label_,
-              sizeof(uint32_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(label_);
+}
+
+inline char *
+mpls_label_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mpls_label_t(";
+   out << "label=" << label_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mpls_label_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mpls_label_t(";
-   ss << "label=" << label_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
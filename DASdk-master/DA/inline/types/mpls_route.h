@@ -48,23 +48,22 @@ mpls_route_key_t::operator!=(mpls_route_key_t const & other) const {
 
 inline uint32_t
 mpls_route_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&top_label_,
-              sizeof(mpls_label_t), ret);
-   ret = hash_mix::mix((uint8_t *)&metric_,
-              sizeof(mpls_route_metric_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(top_label_, metric_);
+}
+
+inline char *
+mpls_route_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mpls_route_key_t(";
+   out << "top_label=" << top_label_;
+   out << ", metric=" << metric_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mpls_route_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mpls_route_key_t(";
-   ss << "top_label=" << top_label_;
-   ss << ", metric=" << metric_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -105,20 +104,21 @@ mpls_route_t::operator!=(mpls_route_t const & other) const {
 
 inline uint32_t
 mpls_route_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&key_,
-              sizeof(mpls_route_key_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(key_);
+}
+
+inline char *
+mpls_route_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mpls_route_t(";
+   out << "key=" << key_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mpls_route_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mpls_route_t(";
-   ss << "key=" << key_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -238,7 +238,7 @@ mpls_route_via_t::nexthop_group() const {
 
 inline void
 mpls_route_via_t::nexthop_group_is(std::string nexthop_group) {
-   nexthop_group_ = nexthop_group;
+   nexthop_group_ = std::move(nexthop_group);
 }
 
 inline bool
@@ -261,43 +261,31 @@ mpls_route_via_t::operator!=(mpls_route_via_t const & other) const {
 
 inline uint32_t
 mpls_route_via_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&route_key_,
-              sizeof(mpls_route_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&hop_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&pushswap_label_,
-              sizeof(mpls_label_t), ret);
-   ret = hash_mix::mix((uint8_t *)&label_action_,
-              sizeof(mpls_action_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ttl_mode_,
-              sizeof(mpls_ttl_mode_t), ret);
-   ret = hash_mix::mix((uint8_t *)&payload_type_,
-              sizeof(mpls_payload_type_t), ret);
-   ret = hash_mix::mix((uint8_t *)&skip_egress_acl_,
-              sizeof(bool), ret);
-   ret ^= std::hash<std::string>()(nexthop_group_);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(route_key_, hop_, intf_, pushswap_label_, label_action_,
+                           ttl_mode_, payload_type_, skip_egress_acl_,
+                           nexthop_group_);
+}
+
+inline char *
+mpls_route_via_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mpls_route_via_t(";
+   out << "route_key=" << route_key_;
+   out << ", hop=" << hop_;
+   out << ", intf=" << intf_;
+   out << ", pushswap_label=" << pushswap_label_;
+   out << ", label_action=" << label_action_;
+   out << ", ttl_mode=" << ttl_mode_;
+   out << ", payload_type=" << payload_type_;
+   out << ", skip_egress_acl=" << skip_egress_acl_;
+   out << ", nexthop_group='" << nexthop_group_ << "'";
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mpls_route_via_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mpls_route_via_t(";
-   ss << "route_key=" << route_key_;
-   ss << ", hop=" << hop_;
-   ss << ", intf=" << intf_;
-   ss << ", pushswap_label=" << pushswap_label_;
-   ss << ", label_action=" << label_action_;
-   ss << ", ttl_mode=" << ttl_mode_;
-   ss << ", payload_type=" << payload_type_;
-   ss << ", skip_egress_acl=" << skip_egress_acl_;
-   ss << ", nexthop_group='" << nexthop_group_ << "'";
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -346,20 +334,21 @@ mpls_fec_id_t::operator<(mpls_fec_id_t const & other) const {
 
 inline uint32_t
 mpls_fec_id_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&id_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(id_);
+}
+
+inline char *
+mpls_fec_id_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mpls_fec_id_t(";
+   out << "id=" << id_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mpls_fec_id_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mpls_fec_id_t(";
-   ss << "id=" << id_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -12,7 +12,7 @@ inline mpls_vrf_label_t::mpls_vrf_label_t() :
 }
 
 inline mpls_vrf_label_t::mpls_vrf_label_t(mpls_label_t label, std::string vrf_name) :
-      label_(label), vrf_name_(vrf_name) {
+      label_(label), vrf_name_(std::move(vrf_name)) {
 }
 
 inline mpls_label_t
@@ -48,22 +48,22 @@ mpls_vrf_label_t::operator<(mpls_vrf_label_t const & other) const {
 
 inline uint32_t
 mpls_vrf_label_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&label_,
-              sizeof(mpls_label_t), ret);
-   ret ^= std::hash<std::string>()(vrf_name_);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(label_, vrf_name_);
+}
+
+inline char *
+mpls_vrf_label_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "mpls_vrf_label_t(";
+   out << "label=" << label_;
+   out << ", vrf_name='" << vrf_name_ << "'";
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 mpls_vrf_label_t::to_string() const {
-   std::ostringstream ss;
-   ss << "mpls_vrf_label_t(";
-   ss << "label=" << label_;
-   ss << ", vrf_name='" << vrf_name_ << "'";
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -6,17 +6,23 @@
 
 namespace DA {
 
+inline char const *
+enum_name(neighbor_entry_type_t enum_val) {
+   switch (enum_val) {
+      case NEIGHBOR_ENTRY_TYPE_NULL:
+         return "NEIGHBOR_ENTRY_TYPE_NULL";
+      case NEIGHBOR_ENTRY_TYPE_DYNAMIC:
+         return "NEIGHBOR_ENTRY_TYPE_DYNAMIC";
+      case NEIGHBOR_ENTRY_TYPE_STATIC:
+         return "NEIGHBOR_ENTRY_TYPE_STATIC";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const neighbor_entry_type_t & enum_val) {
-   if (enum_val==NEIGHBOR_ENTRY_TYPE_NULL) {
-      os << "NEIGHBOR_ENTRY_TYPE_NULL";
-   } else if (enum_val==NEIGHBOR_ENTRY_TYPE_DYNAMIC) {
-      os << "NEIGHBOR_ENTRY_TYPE_DYNAMIC";
-   } else if (enum_val==NEIGHBOR_ENTRY_TYPE_STATIC) {
-      os << "NEIGHBOR_ENTRY_TYPE_STATIC";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -68,23 +74,23 @@ neighbor_key_t::operator<(neighbor_key_t const & other) const {
 
 inline uint32_t
 neighbor_key_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&ip_addr_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&intf_id_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   uint64_t word = (uint64_t(ip_addr_.hash()) << 32) | intf_id_.hash();
+   return hash_mix::final_mix_word(hash_mix::mix_word(word, 0));
+}
+
+inline char *
+neighbor_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "neighbor_key_t(";
+   out << "ip_addr=" << ip_addr_;
+   out << ", intf_id=" << intf_id_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 neighbor_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "neighbor_key_t(";
-   ss << "ip_addr=" << ip_addr_;
-   ss << ", intf_id=" << intf_id_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -147,26 +153,23 @@ neighbor_entry_t::operator<(neighbor_entry_t const & other) const {
 
 inline uint32_t
 neighbor_entry_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&neighbor_key_,
-              sizeof(neighbor_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&eth_addr_,
-              sizeof(eth_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&entry_type_,
-              sizeof(neighbor_entry_type_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(neighbor_key_, eth_addr_, entry_type_);
+}
+
+inline char *
+neighbor_entry_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "neighbor_entry_t(";
+   out << "neighbor_key=" << neighbor_key_;
+   out << ", eth_addr=" << eth_addr_;
+   out << ", entry_type=" << entry_type_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 neighbor_entry_t::to_string() const {
-   std::ostringstream ss;
-   ss << "neighbor_entry_t(";
-   ss << "neighbor_key=" << neighbor_key_;
-   ss << ", eth_addr=" << eth_addr_;
-   ss << ", entry_type=" << entry_type_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
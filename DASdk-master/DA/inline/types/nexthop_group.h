@@ -6,37 +6,49 @@
 
 namespace DA {
 
+inline char const *
+enum_name(nexthop_group_encap_t enum_val) {
+   switch (enum_val) {
+      case NEXTHOP_GROUP_TYPE_NULL:
+         return "NEXTHOP_GROUP_TYPE_NULL";
+      case NEXTHOP_GROUP_IP_IN_IP:
+         return "NEXTHOP_GROUP_IP_IN_IP";
+      case NEXTHOP_GROUP_GRE:
+         return "NEXTHOP_GROUP_GRE";
+      case NEXTHOP_GROUP_MPLS:
+         return "NEXTHOP_GROUP_MPLS";
+      case NEXTHOP_GROUP_MPLS_OVER_GRE:
+         return "NEXTHOP_GROUP_MPLS_OVER_GRE";
+      case NEXTHOP_GROUP_IP:
+         return "NEXTHOP_GROUP_IP";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const nexthop_group_encap_t & enum_val) {
-   if (enum_val==NEXTHOP_GROUP_TYPE_NULL) {
-      os << "NEXTHOP_GROUP_TYPE_NULL";
-   } else if (enum_val==NEXTHOP_GROUP_IP_IN_IP) {
-      os << "NEXTHOP_GROUP_IP_IN_IP";
-   } else if (enum_val==NEXTHOP_GROUP_GRE) {
-      os << "NEXTHOP_GROUP_GRE";
-   } else if (enum_val==NEXTHOP_GROUP_MPLS) {
-      os << "NEXTHOP_GROUP_MPLS";
-   } else if (enum_val==NEXTHOP_GROUP_MPLS_OVER_GRE) {
-      os << "NEXTHOP_GROUP_MPLS_OVER_GRE";
-   } else if (enum_val==NEXTHOP_GROUP_IP) {
-      os << "NEXTHOP_GROUP_IP";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(nexthop_group_gre_key_t enum_val) {
+   switch (enum_val) {
+      case NEXTHOP_GROUP_GRE_KEY_NULL:
+         return "NEXTHOP_GROUP_GRE_KEY_NULL";
+      case NEXTHOP_GROUP_GRE_KEY_INGRESS_INTF:
+         return "NEXTHOP_GROUP_GRE_KEY_INGRESS_INTF";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const nexthop_group_gre_key_t & enum_val) {
-   if (enum_val==NEXTHOP_GROUP_GRE_KEY_NULL) {
-      os << "NEXTHOP_GROUP_GRE_KEY_NULL";
-   } else if (enum_val==NEXTHOP_GROUP_GRE_KEY_INGRESS_INTF) {
-      os << "NEXTHOP_GROUP_GRE_KEY_INGRESS_INTF";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -53,10 +65,17 @@ inline nexthop_group_mpls_action_t::nexthop_group_mpls_action_t(
 
 inline nexthop_group_mpls_action_t::nexthop_group_mpls_action_t(
          mpls_action_t action_type,
-         std::forward_list<mpls_label_t> const & label_stack) :
+         small_vector<mpls_label_t, 3> const & label_stack) :
       action_type_(action_type), label_stack_(label_stack) {
 }
 
+inline nexthop_group_mpls_action_t::nexthop_group_mpls_action_t(
+         mpls_action_t action_type,
+         std::forward_list<mpls_label_t> const & label_stack) :
+      action_type_(action_type),
+      label_stack_(label_stack.begin(), label_stack.end()) {
+}
+
 inline mpls_action_t
 nexthop_group_mpls_action_t::action_type() const {
    return action_type_;
@@ -67,20 +86,41 @@ nexthop_group_mpls_action_t::action_type_is(mpls_action_t action_type) {
    action_type_ = action_type;
 }
 
-inline std::forward_list<mpls_label_t> const &
+inline small_vector<mpls_label_t, 3> const &
 nexthop_group_mpls_action_t::label_stack() const {
    return label_stack_;
 }
 
+inline std::forward_list<mpls_label_t>
+nexthop_group_mpls_action_t::label_stack_list() const {
+   return std::forward_list<mpls_label_t>(label_stack_.begin(),
+                                          label_stack_.end());
+}
+
 inline void
 nexthop_group_mpls_action_t::label_stack_is(
-         std::forward_list<mpls_label_t> const & label_stack) {
+         small_vector<mpls_label_t, 3> const & label_stack) {
    label_stack_ = label_stack;
 }
 
+#ifndef SWIG
+inline void
+nexthop_group_mpls_action_t::label_stack_is(
+         small_vector<mpls_label_t, 3> && label_stack) {
+   label_stack_ = std::move(label_stack);
+}
+#endif
+
+inline void
+nexthop_group_mpls_action_t::label_stack_is(
+         std::forward_list<mpls_label_t> const & label_stack) {
+   label_stack_ = small_vector<mpls_label_t, 3>(label_stack.begin(),
+                                                label_stack.end());
+}
+
 inline void
 nexthop_group_mpls_action_t::label_stack_set(mpls_label_t const & label_stack) {
-   label_stack_.push_front(label_stack);
+   label_stack_.insert(label_stack_.begin(), label_stack);
 }
 
 inline void
@@ -114,35 +154,32 @@ nexthop_group_mpls_action_t::operator<(nexthop_group_mpls_action_t const & other
 
 inline uint32_t
 nexthop_group_mpls_action_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&action_type_,
-              sizeof(mpls_action_t), ret);
-   for (auto it=label_stack_.cbegin(); it!=label_stack_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(mpls_label_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(action_type_, label_stack_);
 }
 
-inline std::string
-nexthop_group_mpls_action_t::to_string() const {
-   std::ostringstream ss;
-   ss << "nexthop_group_mpls_action_t(";
-   ss << "action_type=" << action_type_;
-   ss << ", label_stack=" <<"'";
+inline char *
+nexthop_group_mpls_action_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "nexthop_group_mpls_action_t(";
+   out << "action_type=" << action_type_;
+   out << ", label_stack=" <<"'";
    bool first_label_stack = true;
    for (auto it=label_stack_.cbegin(); it!=label_stack_.cend(); ++it) {
       if (first_label_stack) {
-         ss << (*it);
+         out << (*it);
          first_label_stack = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+nexthop_group_mpls_action_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -198,23 +235,22 @@ nexthop_group_entry_counter_t::operator<(
 
 inline uint32_t
 nexthop_group_entry_counter_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&packets_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::mix((uint8_t *)&bytes_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(packets_, bytes_);
+}
+
+inline char *
+nexthop_group_entry_counter_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "nexthop_group_entry_counter_t(";
+   out << "packets=" << packets_;
+   out << ", bytes=" << bytes_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 nexthop_group_entry_counter_t::to_string() const {
-   std::ostringstream ss;
-   ss << "nexthop_group_entry_counter_t(";
-   ss << "packets=" << packets_;
-   ss << ", bytes=" << bytes_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -277,23 +313,22 @@ nexthop_group_entry_t::operator<(nexthop_group_entry_t const & other) const {
 
 inline uint32_t
 nexthop_group_entry_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&mpls_action_,
-              sizeof(nexthop_group_mpls_action_t), ret);
-   ret = hash_mix::mix((uint8_t *)&nexthop_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(mpls_action_, nexthop_);
+}
+
+inline char *
+nexthop_group_entry_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "nexthop_group_entry_t(";
+   out << "mpls_action=" << mpls_action_;
+   out << ", nexthop=" << nexthop_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 nexthop_group_entry_t::to_string() const {
-   std::ostringstream ss;
-   ss << "nexthop_group_entry_t(";
-   ss << "mpls_action=" << mpls_action_;
-   ss << ", nexthop=" << nexthop_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -312,16 +347,16 @@ inline nexthop_group_t::nexthop_group_t() :
 
 inline nexthop_group_t::nexthop_group_t(std::string name,
                                         nexthop_group_encap_t type) :
-      name_(name), type_(type), gre_key_type_(NEXTHOP_GROUP_GRE_KEY_NULL),
-      ttl_(64), source_ip_(), source_intf_(), autosize_(false), nexthops_(),
-      destination_ips_() {
+      name_(std::move(name)), type_(type),
+      gre_key_type_(NEXTHOP_GROUP_GRE_KEY_NULL), ttl_(64), source_ip_(),
+      source_intf_(), autosize_(false), nexthops_(), destination_ips_() {
 }
 
 inline nexthop_group_t::nexthop_group_t(std::string name,
                                         nexthop_group_encap_t type,
                                         nexthop_group_gre_key_t gre_key_type) :
-      name_(name), type_(type), gre_key_type_(gre_key_type), ttl_(64),
-      source_ip_(), source_intf_(), autosize_(false), nexthops_(),
+      name_(std::move(name)), type_(type), gre_key_type_(gre_key_type),
+      ttl_(64), source_ip_(), source_intf_(), autosize_(false), nexthops_(),
       destination_ips_() {
 }
 
@@ -414,6 +449,13 @@ nexthop_group_t::nexthops_is(
    nexthops_ = nexthops;
 }
 
+#ifndef SWIG
+inline void
+nexthop_group_t::nexthops_is(std::map<uint16_t, nexthop_group_entry_t> && nexthops) {
+   nexthops_ = std::move(nexthops);
+}
+#endif
+
 inline void
 nexthop_group_t::nexthop_set(uint16_t key, nexthop_group_entry_t const & value) {
    nexthops_[key] = value;
@@ -435,6 +477,14 @@ nexthop_group_t::destination_ips_is(
    destination_ips_ = destination_ips;
 }
 
+#ifndef SWIG
+inline void
+nexthop_group_t::destination_ips_is(
+         std::map<uint16_t, ip_addr_t> && destination_ips) {
+   destination_ips_ = std::move(destination_ips);
+}
+#endif
+
 inline void
 nexthop_group_t::destination_ip_set(uint16_t key, ip_addr_t const & value) {
    destination_ips_[key] = value;
@@ -489,71 +539,50 @@ nexthop_group_t::operator<(nexthop_group_t const & other) const {
 
 inline uint32_t
 nexthop_group_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(name_);
-   ret = hash_mix::mix((uint8_t *)&type_,
-              sizeof(nexthop_group_encap_t), ret);
-   ret = hash_mix::mix((uint8_t *)&gre_key_type_,
-              sizeof(nexthop_group_gre_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&ttl_,
-              sizeof(uint16_t), ret);
-   ret = hash_mix::mix((uint8_t *)&source_ip_,
-              sizeof(ip_addr_t), ret);
-   ret = hash_mix::mix((uint8_t *)&source_intf_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&autosize_,
-              sizeof(bool), ret);
-   for (auto it=nexthops_.cbegin(); it!=nexthops_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&it->first,
-                 sizeof(uint16_t), ret);
-      ret = hash_mix::mix((uint8_t *)&it->second,
-                 sizeof(nexthop_group_entry_t), ret);
-   }
-   for (auto it=destination_ips_.cbegin(); it!=destination_ips_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&it->first,
-                 sizeof(uint16_t), ret);
-      ret = hash_mix::mix((uint8_t *)&it->second,
-                 sizeof(ip_addr_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
-}
-
-inline std::string
-nexthop_group_t::to_string() const {
-   std::ostringstream ss;
-   ss << "nexthop_group_t(";
-   ss << "name='" << name_ << "'";
-   ss << ", type=" << type_;
-   ss << ", gre_key_type=" << gre_key_type_;
-   ss << ", ttl=" << ttl_;
-   ss << ", source_ip=" << source_ip_;
-   ss << ", source_intf=" << source_intf_;
-   ss << ", autosize=" << autosize_;
-   ss << ", nexthops=" <<"'";
+   return hash_mix::fields(name_, type_, gre_key_type_, ttl_, source_ip_,
+                           source_intf_, autosize_, nexthops_, destination_ips_);
+}
+
+inline char *
+nexthop_group_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "nexthop_group_t(";
+   out << "name='" << name_ << "'";
+   out << ", type=" << type_;
+   out << ", gre_key_type=" << gre_key_type_;
+   out << ", ttl=" << ttl_;
+   out << ", source_ip=" << source_ip_;
+   out << ", source_intf=" << source_intf_;
+   out << ", autosize=" << autosize_;
+   out << ", nexthops=" <<"'";
    bool first_nexthops = true;
    for (auto it=nexthops_.cbegin(); it!=nexthops_.cend(); ++it) {
       if (first_nexthops) {
-         ss << it->first << "=" << it->second;
+         out << it->first << "=" << it->second;
          first_nexthops = false;
       } else {
-         ss << "," << it->first << "=" << it->second;
+         out << "," << it->first << "=" << it->second;
       }
    }
-   ss << "'";
-   ss << ", destination_ips=" <<"'";
+   out << "'";
+   out << ", destination_ips=" <<"'";
    bool first_destination_ips = true;
    for (auto it=destination_ips_.cbegin(); it!=destination_ips_.cend(); ++it) {
       if (first_destination_ips) {
-         ss << it->first << "=" << it->second;
+         out << it->first << "=" << it->second;
          first_destination_ips = false;
       } else {
-         ss << "," << it->first << "=" << it->second;
+         out << "," << it->first << "=" << it->second;
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+nexthop_group_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -6,73 +6,97 @@
 
 namespace DA {
 
+inline char const *
+enum_name(policy_match_condition_t enum_val) {
+   switch (enum_val) {
+      case POLICY_MAP_CONDITION_NULL:
+         return "POLICY_MAP_CONDITION_NULL";
+      case POLICY_MAP_CONDITION_ANY:
+         return "POLICY_MAP_CONDITION_ANY";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const policy_match_condition_t & enum_val) {
-   if (enum_val==POLICY_MAP_CONDITION_NULL) {
-      os << "POLICY_MAP_CONDITION_NULL";
-   } else if (enum_val==POLICY_MAP_CONDITION_ANY) {
-      os << "POLICY_MAP_CONDITION_ANY";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(policy_feature_t enum_val) {
+   switch (enum_val) {
+      case POLICY_FEATURE_NULL:
+         return "POLICY_FEATURE_NULL";
+      case POLICY_FEATURE_PBR:
+         return "POLICY_FEATURE_PBR";
+      case POLICY_FEATURE_QOS:
+         return "POLICY_FEATURE_QOS";
+      case POLICY_FEATURE_TAP_AGG:
+         return "POLICY_FEATURE_TAP_AGG";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const policy_feature_t & enum_val) {
-   if (enum_val==POLICY_FEATURE_NULL) {
-      os << "POLICY_FEATURE_NULL";
-   } else if (enum_val==POLICY_FEATURE_PBR) {
-      os << "POLICY_FEATURE_PBR";
-   } else if (enum_val==POLICY_FEATURE_QOS) {
-      os << "POLICY_FEATURE_QOS";
-   } else if (enum_val==POLICY_FEATURE_TAP_AGG) {
-      os << "POLICY_FEATURE_TAP_AGG";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(policy_action_type_t enum_val) {
+   switch (enum_val) {
+      case POLICY_ACTION_NULL:
+         return "POLICY_ACTION_NULL";
+      case POLICY_ACTION_NONE:
+         return "POLICY_ACTION_NONE";
+      case POLICY_ACTION_DROP:
+         return "POLICY_ACTION_DROP";
+      case POLICY_ACTION_NEXTHOP:
+         return "POLICY_ACTION_NEXTHOP";
+      case POLICY_ACTION_NEXTHOP_GROUP:
+         return "POLICY_ACTION_NEXTHOP_GROUP";
+      case POLICY_ACTION_DSCP:
+         return "POLICY_ACTION_DSCP";
+      case POLICY_ACTION_TRAFFIC_CLASS:
+         return "POLICY_ACTION_TRAFFIC_CLASS";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const policy_action_type_t & enum_val) {
-   if (enum_val==POLICY_ACTION_NULL) {
-      os << "POLICY_ACTION_NULL";
-   } else if (enum_val==POLICY_ACTION_NONE) {
-      os << "POLICY_ACTION_NONE";
-   } else if (enum_val==POLICY_ACTION_DROP) {
-      os << "POLICY_ACTION_DROP";
-   } else if (enum_val==POLICY_ACTION_NEXTHOP) {
-      os << "POLICY_ACTION_NEXTHOP";
-   } else if (enum_val==POLICY_ACTION_NEXTHOP_GROUP) {
-      os << "POLICY_ACTION_NEXTHOP_GROUP";
-   } else if (enum_val==POLICY_ACTION_DSCP) {
-      os << "POLICY_ACTION_DSCP";
-   } else if (enum_val==POLICY_ACTION_TRAFFIC_CLASS) {
-      os << "POLICY_ACTION_TRAFFIC_CLASS";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
 
 
+inline char const *
+enum_name(policy_map_rule_type_t enum_val) {
+   switch (enum_val) {
+      case POLICY_RULE_TYPE_CLASSMAP:
+         return "POLICY_RULE_TYPE_CLASSMAP";
+      case POLICY_RULE_TYPE_IPV4:
+         return "POLICY_RULE_TYPE_IPV4";
+      case POLICY_RULE_TYPE_IPV6:
+         return "POLICY_RULE_TYPE_IPV6";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const policy_map_rule_type_t & enum_val) {
-   if (enum_val==POLICY_RULE_TYPE_CLASSMAP) {
-      os << "POLICY_RULE_TYPE_CLASSMAP";
-   } else if (enum_val==POLICY_RULE_TYPE_IPV4) {
-      os << "POLICY_RULE_TYPE_IPV4";
-   } else if (enum_val==POLICY_RULE_TYPE_IPV6) {
-      os << "POLICY_RULE_TYPE_IPV6";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -130,22 +154,22 @@ policy_map_key_t::operator<(policy_map_key_t const & other) const {
 
 inline uint32_t
 policy_map_key_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(name_);
-   ret = hash_mix::mix((uint8_t *)&feature_,
-              sizeof(policy_feature_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(name_, feature_);
+}
+
+inline char *
+policy_map_key_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "policy_map_key_t(";
+   out << "name='" << name_ << "'";
+   out << ", feature=" << feature_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 policy_map_key_t::to_string() const {
-   std::ostringstream ss;
-   ss << "policy_map_key_t(";
-   ss << "name='" << name_ << "'";
-   ss << ", feature=" << feature_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -202,6 +226,13 @@ policy_map_action_t::nexthops_is(std::unordered_set<ip_addr_t> const & nexthops)
    nexthops_ = nexthops;
 }
 
+#ifndef SWIG
+inline void
+policy_map_action_t::nexthops_is(std::unordered_set<ip_addr_t> && nexthops) {
+   nexthops_ = std::move(nexthops);
+}
+#endif
+
 inline void
 policy_map_action_t::nexthop_set(ip_addr_t const & value) {
    nexthops_.insert(value);
@@ -275,45 +306,37 @@ policy_map_action_t::operator<(policy_map_action_t const & other) const {
 
 inline uint32_t
 policy_map_action_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&action_type_,
-              sizeof(policy_action_type_t), ret);
-   ret ^= std::hash<std::string>()(nexthop_group_name_);
-   for (auto it=nexthops_.cbegin(); it!=nexthops_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(ip_addr_t), ret);
-   }
-   ret ^= std::hash<std::string>()(vrf_);
-   ret = hash_mix::mix((uint8_t *)&dscp_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::mix((uint8_t *)&traffic_class_,
-              sizeof(uint8_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(action_type_, nexthop_group_name_, nexthops_, vrf_, dscp_,
+                           traffic_class_);
 }
 
-inline std::string
-policy_map_action_t::to_string() const {
-   std::ostringstream ss;
-   ss << "policy_map_action_t(";
-   ss << "action_type=" << action_type_;
-   ss << ", nexthop_group_name='" << nexthop_group_name_ << "'";
-   ss << ", nexthops=" <<"'";
+inline char *
+policy_map_action_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "policy_map_action_t(";
+   out << "action_type=" << action_type_;
+   out << ", nexthop_group_name='" << nexthop_group_name_ << "'";
+   out << ", nexthops=" <<"'";
    bool first_nexthops = true;
    for (auto it=nexthops_.cbegin(); it!=nexthops_.cend(); ++it) {
       if (first_nexthops) {
-         ss << (*it);
+         out << (*it);
          first_nexthops = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ", vrf='" << vrf_ << "'";
-   ss << ", dscp=" << dscp_;
-   ss << ", traffic_class=" << traffic_class_;
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ", vrf='" << vrf_ << "'";
+   out << ", dscp=" << dscp_;
+   out << ", traffic_class=" << traffic_class_;
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+policy_map_action_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -375,6 +398,13 @@ policy_map_rule_t::actions_is(std::set<policy_map_action_t> const & actions) {
    actions_ = actions;
 }
 
+#ifndef SWIG
+inline void
+policy_map_rule_t::actions_is(std::set<policy_map_action_t> && actions) {
+   actions_ = std::move(actions);
+}
+#endif
+
 inline void
 policy_map_rule_t::action_set(policy_map_action_t const & value) {
    actions_.insert(value);
@@ -433,41 +463,35 @@ policy_map_rule_t::operator<(policy_map_rule_t const & other) const {
 
 inline uint32_t
 policy_map_rule_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&class_map_key_,
-              sizeof(class_map_key_t), ret);
-   ret = hash_mix::mix((uint8_t *)&policy_map_rule_type_,
-              sizeof(policy_map_rule_type_t), ret);
-   ret = hash_mix::mix((uint8_t *)&raw_rule_,
-              sizeof(acl_rule_ip_t), ret);
-   for (auto it=actions_.cbegin(); it!=actions_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&(*it),
-            sizeof(policy_map_action_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
-}
-
-inline std::string
-policy_map_rule_t::to_string() const {
-   std::ostringstream ss;
-   ss << "policy_map_rule_t(";
-   ss << "class_map_key=" << class_map_key_;
-   ss << ", policy_map_rule_type=" << policy_map_rule_type_;
-   ss << ", raw_rule=" << raw_rule_;
-   ss << ", actions=" <<"'";
+   return hash_mix::fields(class_map_key_, policy_map_rule_type_, raw_rule_,
+                           actions_);
+}
+
+inline char *
+policy_map_rule_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "policy_map_rule_t(";
+   out << "class_map_key=" << class_map_key_;
+   out << ", policy_map_rule_type=" << policy_map_rule_type_;
+   out << ", raw_rule=" << raw_rule_;
+   out << ", actions=" <<"'";
    bool first_actions = true;
    for (auto it=actions_.cbegin(); it!=actions_.cend(); ++it) {
       if (first_actions) {
-         ss << (*it);
+         out << (*it);
          first_actions = false;
       } else {
-         ss << "," << (*it);
+         out << "," << (*it);
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+policy_map_rule_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -529,37 +553,32 @@ policy_map_t::operator<(policy_map_t const & other) const {
 
 inline uint32_t
 policy_map_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&key_,
-              sizeof(policy_map_key_t), ret);
-   for (auto it=rules_.cbegin(); it!=rules_.cend(); ++it) {
-      ret = hash_mix::mix((uint8_t *)&it->first,
-                 sizeof(uint32_t), ret);
-      ret = hash_mix::mix((uint8_t *)&it->second,
-                 sizeof(policy_map_rule_t), ret);
-   }
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(key_, rules_);
 }
 
-inline std::string
-policy_map_t::to_string() const {
-   std::ostringstream ss;
-   ss << "policy_map_t(";
-   ss << "key=" << key_;
-   ss << ", rules=" <<"'";
+inline char *
+policy_map_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "policy_map_t(";
+   out << "key=" << key_;
+   out << ", rules=" <<"'";
    bool first_rules = true;
    for (auto it=rules_.cbegin(); it!=rules_.cend(); ++it) {
       if (first_rules) {
-         ss << it->first << "=" << it->second;
+         out << it->first << "=" << it->second;
          first_rules = false;
       } else {
-         ss << "," << it->first << "=" << it->second;
+         out << "," << it->first << "=" << it->second;
       }
    }
-   ss << "'";
-   ss << ")";
-   return ss.str();
+   out << "'";
+   out << ")";
+   return out.end();
+}
+
+inline std::string
+policy_map_t::to_string() const {
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
@@ -594,20 +613,21 @@ unsupported_policy_feature_error::raise() const {
 
 inline uint32_t
 unsupported_policy_feature_error::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&policy_feature_,
-              sizeof(policy_feature_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(policy_feature_);
+}
+
+inline char *
+unsupported_policy_feature_error::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "unsupported_policy_feature_error(";
+   out << "policy_feature=" << policy_feature_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 unsupported_policy_feature_error::to_string() const {
-   std::ostringstream ss;
-   ss << "unsupported_policy_feature_error(";
-   ss << "policy_feature=" << policy_feature_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
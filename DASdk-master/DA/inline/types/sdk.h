@@ -6,17 +6,23 @@
 
 namespace DA {
 
+inline char const *
+enum_name(mgr_mode_type_t enum_val) {
+   switch (enum_val) {
+      case MODE_TYPE_READ_ONLY:
+         return "MODE_TYPE_READ_ONLY";
+      case MODE_TYPE_READ_NOTIFYING:
+         return "MODE_TYPE_READ_NOTIFYING";
+      case MODE_TYPE_WRITE:
+         return "MODE_TYPE_WRITE";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const mgr_mode_type_t & enum_val) {
-   if (enum_val==MODE_TYPE_READ_ONLY) {
-      os << "MODE_TYPE_READ_ONLY";
-   } else if (enum_val==MODE_TYPE_READ_NOTIFYING) {
-      os << "MODE_TYPE_READ_NOTIFYING";
-   } else if (enum_val==MODE_TYPE_WRITE) {
-      os << "MODE_TYPE_WRITE";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
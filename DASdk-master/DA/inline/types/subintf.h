@@ -43,23 +43,22 @@ subintf_t::operator!=(subintf_t const & other) const {
 
 inline uint32_t
 subintf_t::hash() const {
-   uint32_t ret = 0;
-   ret = hash_mix::mix((uint8_t *)&intf_id_,
-              sizeof(intf_id_t), ret);
-   ret = hash_mix::mix((uint8_t *)&vlan_id_,
-              sizeof(vlan_id_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(intf_id_, vlan_id_);
+}
+
+inline char *
+subintf_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "subintf_t(";
+   out << "intf_id=" << intf_id_;
+   out << ", vlan_id=" << vlan_id_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 subintf_t::to_string() const {
-   std::ostringstream ss;
-   ss << "subintf_t(";
-   ss << "intf_id=" << intf_id_;
-   ss << ", vlan_id=" << vlan_id_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
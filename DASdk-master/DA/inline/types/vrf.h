@@ -6,19 +6,25 @@
 
 namespace DA {
 
+inline char const *
+enum_name(vrf_state_t enum_val) {
+   switch (enum_val) {
+      case VRF_NULL:
+         return "VRF_NULL";
+      case VRF_INITIALIZING:
+         return "VRF_INITIALIZING";
+      case VRF_ACTIVE:
+         return "VRF_ACTIVE";
+      case VRF_DELETING:
+         return "VRF_DELETING";
+      default:
+         return "Unknown value";
+   }
+}
+
 inline std::ostream&
 operator<<(std::ostream& os, const vrf_state_t & enum_val) {
-   if (enum_val==VRF_NULL) {
-      os << "VRF_NULL";
-   } else if (enum_val==VRF_INITIALIZING) {
-      os << "VRF_INITIALIZING";
-   } else if (enum_val==VRF_ACTIVE) {
-      os << "VRF_ACTIVE";
-   } else if (enum_val==VRF_DELETING) {
-      os << "VRF_DELETING";
-   } else {
-      os << "Unknown value";
-   }
+   os << enum_name(enum_val);
    return os;
 }
 
@@ -30,7 +36,7 @@ inline vrf_t::vrf_t() :
 }
 
 inline vrf_t::vrf_t(std::string name, vrf_state_t state, uint64_t rd) :
-      name_(name), state_(state), rd_(rd) {
+      name_(std::move(name)), state_(state), rd_(rd) {
 }
 
 inline std::string
@@ -74,25 +80,23 @@ vrf_t::operator<(vrf_t const & other) const {
 
 inline uint32_t
 vrf_t::hash() const {
-   uint32_t ret = 0;
-   ret ^= std::hash<std::string>()(name_);
-   ret = hash_mix::mix((uint8_t *)&state_,
-              sizeof(vrf_state_t), ret);
-   ret = hash_mix::mix((uint8_t *)&rd_,
-              sizeof(uint64_t), ret);
-   ret = hash_mix::final_mix(ret);
-   return ret;
+   return hash_mix::fields(name_, state_, rd_);
+}
+
+inline char *
+vrf_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   out << "vrf_t(";
+   out << "name='" << name_ << "'";
+   out << ", state=" << state_;
+   out << ", rd=" << rd_;
+   out << ")";
+   return out.end();
 }
 
 inline std::string
 vrf_t::to_string() const {
-   std::ostringstream ss;
-   ss << "vrf_t(";
-   ss << "name='" << name_ << "'";
-   ss << ", state=" << state_;
-   ss << ", rd=" << rd_;
-   ss << ")";
-   return ss.str();
+   return chars_writer::to_string(*this);
 }
 
 inline std::ostream&
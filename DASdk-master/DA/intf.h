@@ -4,6 +4,7 @@
 #ifndef DA_INTF_H
 #define DA_INTF_H
 
+#include <functional>
 #include <string>
 #include <stddef.h>
 
@@ -188,4 +189,17 @@ class DA_SDK_PUBLIC intf_counter_mgr {
 
 #include <DA/inline/intf.h>
 
+// Provide the hash functor for intf_id_t, so that it can be used as the key
+// of unordered containers without explicitly supplying the functor.
+namespace std {
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::intf_id_t> {
+   size_t operator() (DA::intf_id_t const & intf_id) const {
+      return intf_id.hash();
+   }
+};
+
+}
+
 #endif // DA_INTF_H
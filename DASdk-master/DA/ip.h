@@ -23,6 +23,10 @@
  * the DA::ip_addr_t IP address type has an af() accessor to inspect
  * the address family.
  *
+ * The exceptions are DA::ip4_addr_t and DA::ip4_prefix_t, compact IPv4-only
+ * counterparts of the address and prefix for large tables of IPv4 routes,
+ * which convert implicitly to the generic types.
+ *
  * Utility functions are provided to parse or validate string format
  * IP addresses and CIDR-style IP prefixes.
  *
@@ -65,18 +69,43 @@
  * @endcode
  */
 
-namespace DA {
-// Forward declarations used by std::hash specializations below
-class ip_addr_t;
-
-}
-
-// Declaration of hash specialization for ip_addr_t
+// Provide the hash functors for the IP types, so that they can be used as
+// keys of unordered containers without explicitly supplying the functor.
 namespace std {
 
+// Defined out of line, in ip.cpp, since agents built against older releases
+// of the SDK call the exported symbol.
 template <>
 struct DA_SDK_PUBLIC hash<DA::ip_addr_t> {
-   size_t operator() (DA::ip_addr_t const &) const;
+   size_t operator() (DA::ip_addr_t const & addr) const;
+};
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::ip_prefix_t> {
+   size_t operator() (DA::ip_prefix_t const & prefix) const {
+      return prefix.hash();
+   }
+};
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::ip4_addr_t> {
+   size_t operator() (DA::ip4_addr_t const & addr) const {
+      return addr.hash();
+   }
+};
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::ip4_prefix_t> {
+   size_t operator() (DA::ip4_prefix_t const & prefix) const {
+      return prefix.hash();
+   }
+};
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::ip_addr_mask_t> {
+   size_t operator() (DA::ip_addr_mask_t const & addr_mask) const {
+      return addr_mask.hash();
+   }
 };
 
 }
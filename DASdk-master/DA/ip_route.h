@@ -87,6 +87,13 @@ class DA_SDK_PUBLIC ip_route_mgr {
    virtual ip_route_via_iter_t ip_route_via_iter(ip_route_key_t const &) const = 0;
    virtual ip_route_via_iter_t ip_route_via_iter(ip_route_key_t const &,
                                                  std::string vrfName) const = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   ip_route_via_iter_t ip_route_via_iter(ip_route_key_t const & key,
+                                         char const * vrfName) const {
+      return ip_route_via_iter_in_vrf(key, vrfName);
+   }
+#endif
 
    /**
     * Tests for existence of any routes matching the route key in the config.
@@ -95,9 +102,21 @@ class DA_SDK_PUBLIC ip_route_mgr {
     */
    virtual bool exists(ip_route_key_t const &) const = 0;
    virtual bool exists(ip_route_key_t const &, std::string vrfName) const = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   bool exists(ip_route_key_t const & key, char const * vrfName) const {
+      return exists_in_vrf(key, vrfName);
+   }
+#endif
    /// Tests if the given via exists.
    virtual bool exists(ip_route_via_t const &) const = 0;
    virtual bool exists(ip_route_via_t const &, std::string vrfName) const = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   bool exists(ip_route_via_t const & via, char const * vrfName) const {
+      return exists_in_vrf(via, vrfName);
+   }
+#endif
 
    // Route management functions
 
@@ -107,10 +126,22 @@ class DA_SDK_PUBLIC ip_route_mgr {
     */
    virtual ip_route_t ip_route(ip_route_key_t const &) = 0;
    virtual ip_route_t ip_route(ip_route_key_t const &, std::string vrfName) = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   ip_route_t ip_route(ip_route_key_t const & key, char const * vrfName) {
+      return ip_route_in_vrf(key, vrfName);
+   }
+#endif
    /**
     * Inserts or updates a static route into the switch configuration.
     */
    virtual void ip_route_set(ip_route_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed route.
+   void ip_route_set(ip_route_t && route) {
+      ip_route_set_moved(route);
+   }
+#endif
    /**
     * Performs the same operation as `ip_route_set`, but lets an agent
     * hint what type of vias will be attached to this route. For
@@ -128,12 +159,24 @@ class DA_SDK_PUBLIC ip_route_mgr {
     */
    virtual void ip_route_set(ip_route_t const &,
                              std::string vrfName) = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   void ip_route_set(ip_route_t const & route, char const * vrfName) {
+      ip_route_set_in_vrf(route, vrfName);
+   }
+#endif
    /**
     * Delete an existing static route for a given vrf from the
     * switch configuration.
     */
    virtual void ip_route_del(ip_route_key_t const &,
                              std::string vrfName) = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   void ip_route_del(ip_route_key_t const & key, char const * vrfName) {
+      ip_route_del_in_vrf(key, vrfName);
+   }
+#endif
    /// Removes all ECMP vias matching the route key, and the route itself.
    virtual void ip_route_del(ip_route_key_t const &) = 0;
 
@@ -155,7 +198,19 @@ class DA_SDK_PUBLIC ip_route_mgr {
     * address, interface or nexthop group set.
     */
    virtual void ip_route_via_set(ip_route_via_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed via.
+   void ip_route_via_set(ip_route_via_t && via) {
+      ip_route_via_set_moved(via);
+   }
+#endif
    virtual void ip_route_via_set(ip_route_via_t const &, std::string vrfName) = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   void ip_route_via_set(ip_route_via_t const & via, char const * vrfName) {
+      ip_route_via_set_in_vrf(via, vrfName);
+   }
+#endif
    /**
     * Removes a via from an ip_route_t.
     * When all vias are removed, the route still exists with no
@@ -163,9 +218,37 @@ class DA_SDK_PUBLIC ip_route_mgr {
     */
    virtual void ip_route_via_del(ip_route_via_t const &) = 0;
    virtual void ip_route_via_del(ip_route_via_t const &, std::string vrfName) = 0;
+#ifndef SWIG
+   /// Same as above, without making a string of the VRF name.
+   void ip_route_via_del(ip_route_via_t const & via, char const * vrfName) {
+      ip_route_via_del_in_vrf(via, vrfName);
+   }
+#endif
 
  protected:
    ip_route_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs ip_route_set(ip_route_t &&), copies the route by default.
+   virtual void ip_route_set_moved(ip_route_t & route);
+   /// Backs ip_route_via_set(ip_route_via_t &&), copies the via by default.
+   virtual void ip_route_via_set_moved(ip_route_via_t & via);
+   /**
+    * Back the overloads taking the VRF name as a C string.  They make a
+    * std::string of it for the overloads above by default.
+    */
+   virtual ip_route_via_iter_t ip_route_via_iter_in_vrf(ip_route_key_t const &,
+                                                        char const * vrfName) const;
+   virtual bool exists_in_vrf(ip_route_key_t const &, char const * vrfName) const;
+   virtual bool exists_in_vrf(ip_route_via_t const &, char const * vrfName) const;
+   virtual ip_route_t ip_route_in_vrf(ip_route_key_t const &,
+                                      char const * vrfName);
+   virtual void ip_route_set_in_vrf(ip_route_t const &, char const * vrfName);
+   virtual void ip_route_del_in_vrf(ip_route_key_t const &, char const * vrfName);
+   virtual void ip_route_via_set_in_vrf(ip_route_via_t const &,
+                                        char const * vrfName);
+   virtual void ip_route_via_del_in_vrf(ip_route_via_t const &,
+                                        char const * vrfName);
+#endif
  private:
    DA_SDK_DISALLOW_COPY_CTOR(ip_route_mgr);
 };
@@ -4,6 +4,8 @@
 #ifndef DA_ITERATOR_H
 #define DA_ITERATOR_H
 
+#include <stddef.h>
+
 #include <iterator>
 #include <DA/base.h>
 
@@ -24,6 +26,24 @@ class DA_SDK_PUBLIC iter_base : public std::iterator<std::input_iterator_tag, T>
    T const * operator->() const;
    T * operator->();
 
+   /**
+    * Copies the next elements, starting with the current one, into `buf',
+    * which holds `len' of them, and moves past them.  Returns how many were
+    * copied, which is less than `len' only at the end.
+    *
+    * Walking a large table in batches costs a call per batch instead of
+    * one per element:
+    *
+    * @code
+    * DA::fib_route_t routes[256];
+    * auto i = fib_mgr->fib_route_iter();
+    * while (size_t n = i.next_batch(routes, 256)) {
+    *    for (size_t j = 0; j < n; ++j) { ... routes[j] ... }
+    * }
+    * @endcode
+    */
+   size_t next_batch(T * buf, size_t len);
+
  protected:
    Impl * impl;
    explicit iter_base(Impl * const) DA_SDK_PRIVATE;
@@ -17,6 +17,8 @@
 #ifndef DA_MAC_TABLE_H
 #define DA_MAC_TABLE_H
 
+#include <vector>
+
 #include <DA/base.h>
 #include <DA/eth.h>
 #include <DA/intf.h>
@@ -67,6 +69,47 @@ class DA_SDK_PUBLIC mac_table_handler :
      * table.
      */
     virtual void on_mac_entry_del(mac_key_t const & key);
+
+#ifndef SWIG
+    /**
+     * Sets whether the changes to all MAC entries are delivered to this
+     * handler in batches, through on_mac_entry_set_batch() and
+     * on_mac_entry_del_batch(), instead of one at a time.  The batches are
+     * delivered once per event loop iteration.  Only applies while watching
+     * all MAC entries: entries watched one by one are always notified one at
+     * a time, and the setting is turned off when the handler stops watching
+     * all of them.  Turned on or off while changes are held back, it takes
+     * effect once they are delivered.  Off by default.
+     */
+    void mac_entry_batches_is(bool);
+    bool mac_entry_batches() const;
+
+    /**
+     * Handler called with the MAC entries set in a row, if
+     * mac_entry_batches() is on.  Calls on_mac_entry_set() for each one by
+     * default.
+     */
+    virtual void on_mac_entry_set_batch(mac_entry_t const * entries,
+                                        size_t count);
+    /**
+     * Handler called with the MAC entries removed in a row, if
+     * mac_entry_batches() is on.  Calls on_mac_entry_del() for each one by
+     * default.
+     */
+    virtual void on_mac_entry_del_batch(mac_key_t const * keys, size_t count);
+
+    /**
+     * Sets whether this handler only gets the latest change of each MAC
+     * entry, once per event loop iteration, through the batch handlers.  An
+     * entry set then removed in the same iteration is only seen removed.
+     * Like mac_entry_batches_is(), only applies while watching all MAC
+     * entries.  Off by default.
+     */
+    void mac_entry_conflation_is(bool);
+    bool mac_entry_conflation() const;
+    /// Returns how many changes mac_entry_conflation() spared this handler.
+    uint64_t mac_entry_changes_conflated() const;
+#endif
 };
 
 /**
@@ -155,15 +198,49 @@ class DA_SDK_PUBLIC mac_table_mgr : public base_mgr<mac_table_handler, mac_key_t
     * of interfaces for multicast MAC entries).
     */
    virtual void mac_entry_set(mac_entry_t const & entry) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed entry.
+   void mac_entry_set(mac_entry_t && entry) {
+      mac_entry_set_moved(entry);
+   }
+#endif
    /**
     * Remove a MAC entry with the given key from the collection of entries that 
     * were either learned dynamically or configured explicitly.
     */
    virtual void mac_entry_del(mac_key_t const & key) = 0;
 
+#ifndef SWIG
+   /**
+    * Splits the configured MAC addresses into at most `count' iterators
+    * over disjoint slices of one snapshot of them, which can each be walked
+    * on its own thread.  Returns a single iterator by default.
+    */
+   virtual std::vector<mac_table_iter_t> mac_table_iters(size_t count) const;
+#endif
 
  protected:
    mac_table_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs mac_entry_set(mac_entry_t &&), copies the entry by default.
+   virtual void mac_entry_set_moved(mac_entry_t & entry);
+   /**
+    * Back mac_table_handler::mac_entry_batches_is(),
+    * mac_entry_conflation_is() and their getters: the manager keeps how
+    * each handler gets the changes, and how many of them conflation spared
+    * it.  Managers that don't hold changes back deliver them one at a
+    * time.
+    */
+   virtual void mac_entry_batches_is(mac_table_handler * handler,
+                                     bool batches);
+   virtual bool mac_entry_batches(mac_table_handler const * handler) const;
+   virtual void mac_entry_conflation_is(mac_table_handler * handler,
+                                        bool conflation);
+   virtual bool mac_entry_conflation(
+         mac_table_handler const * handler) const;
+   virtual uint64_t mac_entry_changes_conflated(
+         mac_table_handler const * handler) const;
+#endif
    friend class mac_table_handler;
  private:
    DA_SDK_DISALLOW_COPY_CTOR(mac_table_mgr);
@@ -174,4 +251,17 @@ class DA_SDK_PUBLIC mac_table_mgr : public base_mgr<mac_table_handler, mac_key_t
 
 #include <DA/inline/mac_table.h>
 
+// Provide the hash functor for mac_key_t, so that it can be used as the key
+// of unordered containers without explicitly supplying the functor.
+namespace std {
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::mac_key_t> {
+   size_t operator() (DA::mac_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+}
+
 #endif // DA_MAC_TABLE_H
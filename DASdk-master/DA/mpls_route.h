@@ -151,6 +151,12 @@ class DA_SDK_PUBLIC mpls_route_mgr : public base_mgr<mpls_route_handler,
 
    /// Adds a via to an mpls_route_t
    virtual void mpls_route_via_set(mpls_route_via_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed via.
+   void mpls_route_via_set(mpls_route_via_t && via) {
+      mpls_route_via_set_moved(via);
+   }
+#endif
 
    /**
     * Removes a via from an mpls_route_t.
@@ -174,6 +180,10 @@ class DA_SDK_PUBLIC mpls_route_mgr : public base_mgr<mpls_route_handler,
 
  protected:
    mpls_route_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs mpls_route_via_set(mpls_route_via_t &&), copies the via by default.
+   virtual void mpls_route_via_set_moved(mpls_route_via_t & via);
+#endif
    friend class mpls_route_handler;
  private:
    DA_SDK_DISALLOW_COPY_CTOR(mpls_route_mgr);
@@ -19,6 +19,8 @@
 #ifndef DA_NEIGHBOR_TABLE_H
 #define DA_NEIGHBOR_TABLE_H
 
+#include <vector>
+
 #include <DA/eth.h>
 #include <DA/base_handler.h>
 #include <DA/intf.h>
@@ -68,6 +70,41 @@ class DA_SDK_PUBLIC neighbor_table_handler :
 
    // Handler when an entry disappears from ARP table or Neighbor Discovery table.
    virtual void on_neighbor_entry_del(neighbor_key_t const & key);
+
+#ifndef SWIG
+   /**
+    * Sets whether the changes to all neighbor entries are delivered to this
+    * handler in batches, through on_neighbor_entry_set_batch() and
+    * on_neighbor_entry_del_batch(), instead of one at a time.  The batches
+    * are delivered once per event loop iteration.  Only applies while
+    * watching all neighbor entries, and is turned off when the handler stops
+    * watching them.  Turned on or off while changes are held back, it takes
+    * effect once they are delivered.  Off by default.
+    */
+   void neighbor_entry_batches_is(bool);
+   bool neighbor_entry_batches() const;
+
+   // Handler called with the entries set in a row, if neighbor_entry_batches()
+   // is on.  Calls on_neighbor_entry_set() for each one by default.
+   virtual void on_neighbor_entry_set_batch(neighbor_entry_t const * entries,
+                                            size_t count);
+   // Handler called with the entries deleted in a row, if
+   // neighbor_entry_batches() is on.  Calls on_neighbor_entry_del() for each
+   // one by default.
+   virtual void on_neighbor_entry_del_batch(neighbor_key_t const * keys,
+                                            size_t count);
+
+   /**
+    * Sets whether this handler only gets the latest change of each neighbor
+    * entry, once per event loop iteration, through the batch handlers.  An
+    * entry set then deleted in the same iteration is only seen deleted.
+    * Only applies while watching all neighbor entries.  Off by default.
+    */
+   void neighbor_entry_conflation_is(bool);
+   bool neighbor_entry_conflation() const;
+   /// Returns how many changes neighbor_entry_conflation() spared this handler.
+   uint64_t neighbor_entry_changes_conflated() const;
+#endif
 };
 
 /**
@@ -139,8 +176,37 @@ class DA_SDK_PUBLIC neighbor_table_mgr : public base_mgr<neighbor_table_handler,
    /// Looks up a configured neighbor entry for a given L3 interface and IP address.
    virtual neighbor_entry_t neighbor_entry(neighbor_key_t const & key) const = 0;
 
+#ifndef SWIG
+   /**
+    * Splits the configured entries into at most `count' iterators over
+    * disjoint slices of one snapshot of them, which can each be walked on
+    * its own thread.  Returns a single iterator by default.
+    */
+   virtual std::vector<neighbor_table_iter_t> neighbor_table_iters(
+         size_t count) const;
+#endif
+
  protected:
    neighbor_table_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /**
+    * Back neighbor_table_handler::neighbor_entry_batches_is(),
+    * neighbor_entry_conflation_is() and their getters: the manager keeps
+    * how each handler gets the changes, and how many of them conflation
+    * spared it.  Managers that don't hold changes back deliver them one at
+    * a time.
+    */
+   virtual void neighbor_entry_batches_is(neighbor_table_handler * handler,
+                                          bool batches);
+   virtual bool neighbor_entry_batches(
+         neighbor_table_handler const * handler) const;
+   virtual void neighbor_entry_conflation_is(
+         neighbor_table_handler * handler, bool conflation);
+   virtual bool neighbor_entry_conflation(
+         neighbor_table_handler const * handler) const;
+   virtual uint64_t neighbor_entry_changes_conflated(
+         neighbor_table_handler const * handler) const;
+#endif
    friend class neighbor_table_handler;
 
  private:
@@ -151,4 +217,17 @@ class DA_SDK_PUBLIC neighbor_table_mgr : public base_mgr<neighbor_table_handler,
 
 } // end namespace DA
 
+// Provide the hash functor for neighbor_key_t, so that it can be used as the
+// key of unordered containers without explicitly supplying the functor.
+namespace std {
+
+template <>
+struct DA_SDK_PUBLIC hash<DA::neighbor_key_t> {
+   size_t operator() (DA::neighbor_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+}
+
 #endif // DA_NEIGHBOR_TABLE_H
@@ -161,10 +161,20 @@ class DA_SDK_PUBLIC nexthop_group_mgr :
 
    /// Creates or updates a nexthop group.
    virtual void nexthop_group_set(nexthop_group_t const &) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed nexthop group.
+   void nexthop_group_set(nexthop_group_t && group) {
+      nexthop_group_set_moved(group);
+   }
+#endif
    /// Removes the named nexthop group from the configuration if it exists
    virtual void nexthop_group_del(std::string const & nexthop_group_name) = 0;
  protected:
    nexthop_group_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs nexthop_group_set(nexthop_group_t &&), copies the nexthop group by default.
+   virtual void nexthop_group_set_moved(nexthop_group_t & group);
+#endif
    friend class nexthop_group_handler;
  private:
    DA_SDK_DISALLOW_COPY_CTOR(nexthop_group_mgr);
@@ -208,6 +208,12 @@ class DA_SDK_PUBLIC policy_map_mgr : public base_mgr<policy_map_handler,
 
    virtual policy_map_t policy_map(policy_map_key_t const & key) const = 0;
    virtual void policy_map_is(policy_map_t const & policy_map) = 0;
+#ifndef SWIG
+   /// Same as above, but the manager may move from the passed policy map.
+   void policy_map_is(policy_map_t && policy_map) {
+      policy_map_is_moved(policy_map);
+   }
+#endif
    virtual void policy_map_del(policy_map_key_t const & key) = 0;
 
    /**
@@ -221,6 +227,10 @@ class DA_SDK_PUBLIC policy_map_mgr : public base_mgr<policy_map_handler,
 
  protected:
    policy_map_mgr() DA_SDK_PRIVATE;
+#ifndef SWIG
+   /// Backs policy_map_is(policy_map_t &&), copies the policy map by default.
+   virtual void policy_map_is_moved(policy_map_t & policy_map);
+#endif
    friend class policy_map_handler;
 
  private:
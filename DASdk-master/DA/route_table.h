@@ -0,0 +1,83 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+/**
+ * @file
+ * Bulk operations on tables of routes
+ *
+ * An agent that resyncs its routes compares the routes it wants with the
+ * ones that are programmed, and only changes the difference.  This module
+ * sorts arrays of prefixes or FIB routes into a canonical order, and
+ * diffs two sorted tables of FIB routes into the routes to add, update
+ * and delete.
+ *
+ * @code
+ * std::vector<DA::fib_route_t> current = ...;  // e.g. read from the fib_mgr
+ * std::vector<DA::fib_route_t> desired = ...;
+ * DA::sort_routes(current.data(), current.data() + current.size());
+ * DA::sort_routes(desired.data(), desired.data() + desired.size());
+ *
+ * std::vector<DA::fib_route_t> added, updated;
+ * std::vector<DA::fib_route_key_t> deleted;
+ * DA::diff_routes(current.data(), current.size(),
+ *                 desired.data(), desired.size(),
+ *                 &added, &updated, &deleted);
+ * @endcode
+ */
+
+#ifndef DA_ROUTE_TABLE_H
+#define DA_ROUTE_TABLE_H
+
+#include <stddef.h>
+
+#include <vector>
+
+#include <DA/base.h>
+#include <DA/fib.h>
+#include <DA/ip.h>
+
+namespace DA {
+
+/**
+ * The order the functions of this module sort prefixes into: by address
+ * family, then network address, then prefix length.  It can be used to
+ * binary search the sorted arrays.
+ */
+bool prefix_less(ip_prefix_t const & a, ip_prefix_t const & b) DA_SDK_PUBLIC;
+
+/**
+ * Sorts the prefixes of [first, last) in prefix_less() order.
+ *
+ * This is a radix sort of the prefixes' bits, which doesn't compare them
+ * and takes linear time, and which skips the bits all the prefixes have
+ * in common, e.g. the 96 bits IPv4 addresses don't use.  The sort is
+ * stable.
+ */
+void sort_prefixes(ip_prefix_t * first, ip_prefix_t * last) DA_SDK_PUBLIC;
+
+/**
+ * Sorts the routes of [first, last) by the prefix of their route key, in
+ * prefix_less() order, the same way sort_prefixes() does.
+ */
+void sort_routes(fib_route_t * first, fib_route_t * last) DA_SDK_PUBLIC;
+
+/**
+ * Compares the routes of a table with the ones they should be replaced
+ * with, in a single pass over both.
+ *
+ * Both tables must be sorted by sort_routes(), and hold at most one route
+ * per prefix.  The routes of `desired' whose prefix isn't in `current' are
+ * appended to `added', the ones whose prefix is in `current' but with
+ * other values to `updated', and the keys of the routes of `current'
+ * whose prefix isn't in `desired' to `deleted', all in prefix_less()
+ * order.  Any of the three may be null, to leave out those changes.
+ */
+void diff_routes(fib_route_t const * current, size_t current_len,
+                 fib_route_t const * desired, size_t desired_len,
+                 std::vector<fib_route_t> * added,
+                 std::vector<fib_route_t> * updated,
+                 std::vector<fib_route_key_t> * deleted) DA_SDK_PUBLIC;
+
+}
+
+#endif // DA_ROUTE_TABLE_H
@@ -4,6 +4,8 @@
 #ifndef DA_SDK_H
 #define DA_SDK_H
 
+#include <map>
+
 #include <DA/agent.h>
 #include <DA/base.h>
 #include <DA/types/sdk.h>
@@ -66,6 +68,10 @@ class vrf_mgr;
  *      sdk.get_agent_mgr()->status_set("Look", "I can interact with Sysdb!");
  *    } // End the scope, causing the sdk_scoped_lock to be destructed and released
  *
+ * Threads that only need to hand work over to the SDK can avoid the lock
+ * altogether by posting a callback to the main loop with
+ * event_loop::post(0, ...): posting never blocks, neither the caller nor
+ * the event loop, and the callback then runs on the main loop's thread.
  */
 class DA_SDK_PUBLIC sdk_scoped_lock {
   public:
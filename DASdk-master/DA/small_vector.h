@@ -0,0 +1,100 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef DA_SMALL_VECTOR_H
+#define DA_SMALL_VECTOR_H
+
+#include <stddef.h>
+
+#include <initializer_list>
+#include <type_traits>
+
+#include <DA/base.h>
+
+namespace DA {
+
+/**
+ * A sequence of values that keeps up to N of them inside the object
+ * itself, and only moves them to the heap when it grows past that.
+ *
+ * It's used for the short lists of the SDK's value types, such as the vias
+ * of a FEC or the labels of an MPLS action, so that copying these types
+ * doesn't allocate in the common case.  The elements are contiguous, and
+ * the container supports a subset of the std::vector interface.
+ */
+template <typename T, size_t N>
+class DA_SDK_PUBLIC small_vector {
+ public:
+   typedef T value_type;
+   typedef size_t size_type;
+   typedef T & reference;
+   typedef T const & const_reference;
+   typedef T * iterator;
+   typedef T const * const_iterator;
+
+   small_vector();
+   small_vector(small_vector const & other);
+   small_vector(small_vector && other) noexcept;
+   small_vector(std::initializer_list<T> values);
+   /// Copies the values of [first, last), e.g. the elements of another container.
+   template <typename InputIterator>
+   small_vector(InputIterator first, InputIterator last);
+   ~small_vector();
+
+   small_vector & operator=(small_vector const & other);
+   small_vector & operator=(small_vector && other) noexcept;
+
+   iterator begin();
+   iterator end();
+   const_iterator begin() const;
+   const_iterator end() const;
+   const_iterator cbegin() const;
+   const_iterator cend() const;
+
+   size_t size() const;
+   bool empty() const;
+   /// The number of elements that fit before the storage grows.
+   size_t capacity() const;
+
+   T & operator[](size_t index);
+   T const & operator[](size_t index) const;
+   T & front();
+   T const & front() const;
+
+   void push_back(T const & value);
+   void push_back(T && value);
+   /// Inserts a value before `pos', and returns where it was inserted.
+   iterator insert(const_iterator pos, T const & value);
+   /// Removes the elements of [first, last), and returns where they were.
+   iterator erase(const_iterator first, const_iterator last);
+   /// Removes all the elements equal to `value'.
+   void remove(T const & value);
+   void clear();
+   void reserve(size_t capacity);
+
+   bool operator==(small_vector const & other) const;
+   bool operator!=(small_vector const & other) const;
+   /// Compares the elements lexicographically.
+   bool operator<(small_vector const & other) const;
+
+ private:
+   T * inline_data();
+   bool is_inline() const;
+   // Moves the elements to a heap array of the given capacity.
+   void grow(size_t capacity);
+   // Destroys the elements, and frees their storage if it's on the heap.
+   void release();
+   // Takes the elements of `other', which is left empty.
+   void steal(small_vector & other);
+
+   T * data_;
+   size_t size_;
+   size_t capacity_;
+   typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type storage_;
+};
+
+}
+
+#include <DA/inline/small_vector.h>
+
+#endif // DA_SMALL_VECTOR_H
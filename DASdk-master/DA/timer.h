@@ -4,6 +4,8 @@
 #ifndef DA_TIMER_H
 #define DA_TIMER_H
 
+#include <functional>
+
 #include <DA/base.h>
 #include <DA/base_handler.h>
 #include <DA/base_mgr.h>
@@ -14,6 +16,11 @@
  *
  * This module allows timeouts to be set for a callback to be called
  * as soon as possible after some future time.
+ *
+ * A timeout_handler manages a single deadline.  Code that needs to track
+ * many independent deadlines (one per key, for instance) can instead ask
+ * the timeout_mgr for lightweight timers, each with its own callback, which
+ * are identified by a timer_handle_t and can be cancelled in O(1).
  */
 
 namespace DA {
@@ -33,6 +40,42 @@ seconds_t now() DA_SDK_PUBLIC;
 /// 'never' represents a future time that now() can never reach.
 static const seconds_t never = 0;
 
+/**
+ * The time at which the current event loop iteration started.
+ *
+ * The loop reads the clock once when it wakes up, and handlers can use
+ * that time instead of calling now() again, e.g. to re-arm a timer
+ * relative to the event they are handling, much like libuv's uv_now().
+ * The value doesn't advance while handlers run, so it lags behind now()
+ * by however long the current iteration has taken so far.
+ *
+ * Outside of the event loop of the calling thread's shard, this is the
+ * same as now().
+ */
+seconds_t loop_now() DA_SDK_PUBLIC;
+
+/// The clocks now() can be backed by.
+enum clock_source_t {
+   /** clock_gettime(CLOCK_MONOTONIC), the default. */
+   CLOCK_SOURCE_MONOTONIC,
+   /**
+    * The CPU's time stamp counter, calibrated against CLOCK_MONOTONIC and
+    * re-synchronized with it several times per second.  Only available on
+    * x86 CPUs with an invariant TSC.
+    */
+   CLOCK_SOURCE_TSC,
+};
+
+/**
+ * Selects the clock behind now().  Either way, now() returns the same
+ * monotonic, per-thread non-decreasing time base.  Selecting a clock the
+ * machine doesn't support panics with an unsupported_error.  This must be
+ * called before starting event loop shards or other threads calling now().
+ */
+void clock_source_is(clock_source_t source) DA_SDK_PUBLIC;
+/// Returns the clock behind now().
+clock_source_t clock_source() DA_SDK_PUBLIC;
+
 class timer_internal;
 class timeout_mgr;
 
@@ -69,6 +112,37 @@ class DA_SDK_PUBLIC timeout_handler : public base_handler<timeout_mgr,
    timer_internal * timer_;
 };
 
+/// Callback invoked when a timer created by the timeout_mgr fires.
+typedef std::function<void()> timer_callback_t;
+
+/**
+ * Identifies a timer created by timeout_mgr::timer_once() or
+ * timeout_mgr::timer_periodic().
+ *
+ * Handles are plain values that are cheap to copy.  A handle becomes stale
+ * once its timer has fired (for one-shot timers) or has been deleted, and
+ * stale handles are safely ignored by the timeout_mgr.  A default
+ * constructed handle doesn't refer to any timer.
+ *
+ * Timers belong to the event loop shard of the thread that created them
+ * (see event_loop::shards_is()), and their handles must only be passed to
+ * the timeout_mgr from that same shard.
+ */
+class DA_SDK_PUBLIC timer_handle_t {
+ public:
+   timer_handle_t();
+
+   bool operator==(timer_handle_t const & other) const;
+   bool operator!=(timer_handle_t const & other) const;
+
+ private:
+   friend class Impl;
+   timer_handle_t(uint32_t slot, uint32_t generation) DA_SDK_PRIVATE;
+
+   uint32_t slot_;
+   uint32_t generation_;
+};
+
 class DA_SDK_PUBLIC timeout_mgr : public base_mgr<timeout_handler> {
  public:
    virtual ~timeout_mgr();
@@ -78,10 +152,43 @@ class DA_SDK_PUBLIC timeout_mgr : public base_mgr<timeout_handler> {
    timeout_mgr() DA_SDK_PRIVATE;
    friend class timeout_handler;
 
+   // The timer methods are declared after init_handler(), so that it keeps
+   // its vtable slot from earlier releases.  By default they run the timers
+   // on the calling thread's event loop shard.
+ public:
+   /**
+    * Schedules `callback' to be called once, as soon as possible after the
+    * absolute time `deadline'.  Returns a handle to the new timer.
+    */
+   virtual timer_handle_t timer_once(seconds_t deadline,
+                                     timer_callback_t const & callback);
+
+   /**
+    * Schedules `callback' to be called as soon as possible after the
+    * absolute time `first_deadline', and then every `interval' seconds until
+    * the timer is deleted.  If the loop falls behind by more than one
+    * interval, the missed calls are skipped rather than delivered in a burst.
+    * Returns a handle to the new timer.
+    */
+   virtual timer_handle_t timer_periodic(seconds_t first_deadline,
+                                         seconds_t interval,
+                                         timer_callback_t const & callback);
+
+   /**
+    * Cancels the given timer in O(1).  Does nothing if the handle is stale.
+    * A periodic timer may delete itself from within its own callback.
+    */
+   virtual void timer_del(timer_handle_t const & handle);
+
+   /// Returns true if the given timer is still scheduled.
+   virtual bool timer_exists(timer_handle_t const & handle) const;
+
  private:
    DA_SDK_DISALLOW_COPY_CTOR(timeout_mgr);
 };
 
 }
 
+#include <DA/inline/timer.h>
+
 #endif // DA_TIMER_H
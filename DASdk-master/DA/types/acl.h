@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_ACL_H
 #define DA_TYPES_ACL_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <list>
@@ -27,6 +28,8 @@ enum acl_type_t {
 };
 /** Appends a string representation of enum acl_type_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const acl_type_t & enum_val);
+/** The name of enum acl_type_t value, or "Unknown value". */
+char const * enum_name(acl_type_t enum_val);
 
 /**
  * The direction in which an ACL is applied.
@@ -39,6 +42,8 @@ enum acl_direction_t {
 };
 /** Appends a string representation of enum acl_direction_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const acl_direction_t & enum_val);
+/** The name of enum acl_direction_t value, or "Unknown value". */
+char const * enum_name(acl_direction_t enum_val);
 
 /** The type of range operator for TTL and port specifications below. */
 enum acl_range_operator_t {
@@ -55,6 +60,8 @@ enum acl_range_operator_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const acl_range_operator_t & enum_val);
+/** The name of enum acl_range_operator_t value, or "Unknown value". */
+char const * enum_name(acl_range_operator_t enum_val);
 
 /** The action to take for an individual ACL rule. */
 enum acl_action_t {
@@ -64,6 +71,8 @@ enum acl_action_t {
 };
 /** Appends a string representation of enum acl_action_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const acl_action_t & enum_val);
+/** The name of enum acl_action_t value, or "Unknown value". */
+char const * enum_name(acl_action_t enum_val);
 
 /** TCP flags used in IP rules to specify which TCP flags to match. */
 enum acl_tcp_flag_t {
@@ -77,6 +86,8 @@ enum acl_tcp_flag_t {
 };
 /** Appends a string representation of enum acl_tcp_flag_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const acl_tcp_flag_t & enum_val);
+/** The name of enum acl_tcp_flag_t value, or "Unknown value". */
+char const * enum_name(acl_tcp_flag_t enum_val);
 
 /**
  * A TTL specifier, used in an IP ACL rule to define TTLs to match.
@@ -106,6 +117,12 @@ class DA_SDK_PUBLIC acl_ttl_spec_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of acl_ttl_spec_t
     * to the ostream.
@@ -139,6 +156,10 @@ class DA_SDK_PUBLIC acl_port_spec_t {
 
    std::list<uint16_t> const & ports() const;
    void ports_is(std::list<uint16_t> const & ports);
+#ifndef SWIG
+   /** Setter for 'ports', moving from the passed container. */
+   void ports_is(std::list<uint16_t> && ports);
+#endif
    /** Prepend one port to the list. */
    void port_set(uint16_t const & ports);
    /** Remove all matching port elements. */
@@ -151,6 +172,12 @@ class DA_SDK_PUBLIC acl_port_spec_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * acl_port_spec_t to the ostream.
@@ -196,6 +223,12 @@ class DA_SDK_PUBLIC acl_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of acl_key_t to
     * the ostream.
@@ -241,6 +274,12 @@ class DA_SDK_PUBLIC acl_rule_base_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * acl_rule_base_t to the ostream.
@@ -352,6 +391,12 @@ class DA_SDK_PUBLIC acl_rule_ip_t : public acl_rule_base_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of acl_rule_ip_t
     * to the ostream.
@@ -415,6 +460,12 @@ class DA_SDK_PUBLIC acl_rule_eth_t : public acl_rule_base_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of acl_rule_eth_t
     * to the ostream.
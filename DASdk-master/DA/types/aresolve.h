@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_ARESOLVE_H
 #define DA_TYPES_ARESOLVE_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/ip.h>
 #include <DA/utility.h>
@@ -50,6 +51,12 @@ class DA_SDK_PUBLIC aresolve_record_base {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * aresolve_record_base to the ostream.
@@ -89,6 +96,12 @@ class DA_SDK_PUBLIC aresolve_record_host : public aresolve_record_base {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * aresolve_record_host to the ostream.
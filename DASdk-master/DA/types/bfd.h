@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_BFD_H
 #define DA_TYPES_BFD_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <sstream>
@@ -23,6 +24,8 @@ enum bfd_session_status_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const bfd_session_status_t & enum_val);
+/** The name of enum bfd_session_status_t value, or "Unknown value". */
+char const * enum_name(bfd_session_status_t enum_val);
 
 /** BFD session type. */
 enum bfd_session_type_t {
@@ -38,6 +41,8 @@ enum bfd_session_type_t {
  * Appends a string representation of enum bfd_session_type_t value to the ostream.
  */
 std::ostream& operator<<(std::ostream& os, const bfd_session_type_t & enum_val);
+/** The name of enum bfd_session_type_t value, or "Unknown value". */
+char const * enum_name(bfd_session_type_t enum_val);
 
 /**
  * BFD session key class.
@@ -68,6 +73,12 @@ class DA_SDK_PUBLIC bfd_session_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * bfd_session_key_t to the ostream.
@@ -105,6 +116,12 @@ class DA_SDK_PUBLIC bfd_interval_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of bfd_interval_t
     * to the ostream.
@@ -136,6 +153,12 @@ class DA_SDK_PUBLIC bfd_session_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of bfd_session_t
     * to the ostream.
@@ -5,6 +5,7 @@
 #define DA_TYPES_CLASS_MAP_H
 
 #include <DA/acl.h>
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/policy_map.h>
 #include <DA/utility.h>
@@ -52,6 +53,12 @@ class DA_SDK_PUBLIC class_map_rule_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * class_map_rule_t to the ostream.
@@ -82,6 +89,10 @@ class DA_SDK_PUBLIC class_map_t {
    std::map<uint32_t, class_map_rule_t> const & rules() const;
    /** Setter for 'rules'. */
    void rules_is(std::map<uint32_t, class_map_rule_t> const & rules);
+#ifndef SWIG
+   /** Setter for 'rules', moving from the passed container. */
+   void rules_is(std::map<uint32_t, class_map_rule_t> && rules);
+#endif
    /** Inserts key/value pair to the map. */
    void rule_set(uint32_t key, class_map_rule_t const & value);
    /** Deletes the key/value pair from the map. */
@@ -93,6 +104,12 @@ class DA_SDK_PUBLIC class_map_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of class_map_t to
     * the ostream.
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_DECAP_GROUP_H
 #define DA_TYPES_DECAP_GROUP_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/ip.h>
 #include <DA/utility.h>
@@ -24,6 +25,8 @@ enum decap_protocol_type_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const decap_protocol_type_t & enum_val);
+/** The name of enum decap_protocol_type_t value, or "Unknown value". */
+char const * enum_name(decap_protocol_type_t enum_val);
 
 /**
  * An IP decap group configuration model. At this time, all decap  groups are
@@ -65,6 +68,12 @@ class DA_SDK_PUBLIC decap_group_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of decap_group_t
     * to the ostream.
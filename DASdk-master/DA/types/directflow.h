@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_DIRECTFLOW_H
 #define DA_TYPES_DIRECTFLOW_H
 
+#include <DA/chars_writer.h>
 #include <DA/eth.h>
 #include <DA/exception.h>
 #include <DA/hash_mix.h>
@@ -49,6 +50,12 @@ class DA_SDK_PUBLIC flow_match_field_set_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * flow_match_field_set_t to the ostream.
@@ -75,6 +82,10 @@ class DA_SDK_PUBLIC flow_match_t {
    std::set<intf_id_t> const & input_intfs() const;
    /** Setter for 'input_intfs'. */
    void input_intfs_is(std::set<intf_id_t> const & input_intfs);
+#ifndef SWIG
+   /** Setter for 'input_intfs', moving from the passed container. */
+   void input_intfs_is(std::set<intf_id_t> && input_intfs);
+#endif
    /** Inserts one input_intf of 'value' to the set. */
    void input_intf_set(intf_id_t const & value);
    /** Deletes one input_intf of 'value' from the set. */
@@ -150,6 +161,12 @@ class DA_SDK_PUBLIC flow_match_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of flow_match_t
     * to the ostream.
@@ -205,6 +222,12 @@ class DA_SDK_PUBLIC flow_action_set_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * flow_action_set_t to the ostream.
@@ -233,6 +256,10 @@ class DA_SDK_PUBLIC flow_action_t {
    std::set<intf_id_t> const & output_intfs() const;
    /** Setter for 'output_intfs'. */
    void output_intfs_is(std::set<intf_id_t> const & output_intfs);
+#ifndef SWIG
+   /** Setter for 'output_intfs', moving from the passed container. */
+   void output_intfs_is(std::set<intf_id_t> && output_intfs);
+#endif
    /** Inserts one output_intf of 'value' to the set. */
    void output_intf_set(intf_id_t const & value);
    /** Deletes one output_intf of 'value' from the set. */
@@ -272,6 +299,12 @@ class DA_SDK_PUBLIC flow_action_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of flow_action_t
     * to the ostream.
@@ -310,6 +343,12 @@ class DA_SDK_PUBLIC flow_entry_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of flow_entry_t
     * to the ostream.
@@ -338,6 +377,12 @@ class DA_SDK_PUBLIC flow_counters_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * flow_counters_t to the ostream.
@@ -364,6 +409,8 @@ enum flow_status_t {
 };
 /** Appends a string representation of enum flow_status_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const flow_status_t & enum_val);
+/** The name of enum flow_status_t value, or "Unknown value". */
+char const * enum_name(flow_status_t enum_val);
 
 /** Reason why a flow was not successfully created in hardware. */
 enum flow_rejected_reason_t {
@@ -385,6 +432,8 @@ enum flow_rejected_reason_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const flow_rejected_reason_t & enum_val);
+/** The name of enum flow_rejected_reason_t value, or "Unknown value". */
+char const * enum_name(flow_rejected_reason_t enum_val);
 }
 
 #include <DA/inline/types/directflow.h>
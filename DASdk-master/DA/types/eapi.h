@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_EAPI_H
 #define DA_TYPES_EAPI_H
 
+#include <DA/chars_writer.h>
 #include <DA/utility.h>
 #include <sstream>
 #include <vector>
@@ -39,6 +40,12 @@ class eapi_response_t {
 
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * eapi_response_t to the ostream.
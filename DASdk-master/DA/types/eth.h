@@ -7,6 +7,7 @@
 #include <assert.h>
 #include <bitset>
 #include <DA/base.h>
+#include <DA/chars_writer.h>
 #include <DA/exception.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
@@ -14,6 +15,7 @@
 #include <sstream>
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 
 namespace DA {
 
@@ -56,6 +58,12 @@ class DA_SDK_PUBLIC eth_addr_t {
 
    /** String representation of a Ethernet address, e.g "xx:xx:xx:xx:xx:xx". */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
 
    /** Only the default MAC address (all zeros) evaluates to false. */
    bool operator!() const;
@@ -84,8 +92,33 @@ class DA_SDK_PUBLIC eth_addr_t {
 
  private:
    uint8_t bytes_[6];
+   friend bool parse_eth_addr(char const *, size_t, eth_addr_t * result);
 };
 
+/**
+ * Parses an Ethernet address, returning true if the address is valid.
+ * Supported formats are xx:xx:xx:xx:xx:xx, xx-xx-xx-xx-xx-xx, where a
+ * group may also be a single digit, xxxx.xxxx.xxxx, where a group may also
+ * have fewer digits, and xxxxxxxxxxxx.
+ *
+ * @param[in] addr Pointer to a C string containing an address to parse.
+ * @param[out] result Mutable argument to place a successfully parsed result into.
+ * @return true if the address parsed successfully, false otherwise.
+ */
+bool parse_eth_addr(char const * addr, eth_addr_t * result) DA_SDK_PUBLIC;
+
+/**
+ * Parses an Ethernet address of `len' characters, which needs no terminating
+ * null character, e.g. a field of a larger buffer.  Doesn't allocate memory.
+ *
+ * @param[in] addr Pointer to the characters of the address to parse.
+ * @param[in] len The number of characters of the address.
+ * @param[out] result Mutable argument to place a successfully parsed result into.
+ * @return true if the address parsed successfully, false otherwise.
+ */
+bool parse_eth_addr(char const * addr, size_t len, eth_addr_t * result)
+   DA_SDK_PUBLIC;
+
 /** The given VLAN number was invalid (for example 0 or 4095). */
 class DA_SDK_PUBLIC invalid_vlan_error : public error {
  public:
@@ -99,6 +132,12 @@ class DA_SDK_PUBLIC invalid_vlan_error : public error {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * invalid_vlan_error to the ostream.
@@ -123,6 +162,12 @@ class DA_SDK_PUBLIC internal_vlan_error : public configuration_error {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * internal_vlan_error to the ostream.
@@ -26,6 +26,8 @@ enum switchport_mode_t {
  * Appends a string representation of enum switchport_mode_t value to the ostream.
  */
 std::ostream& operator<<(std::ostream& os, const switchport_mode_t & enum_val);
+/** The name of enum switchport_mode_t value, or "Unknown value". */
+char const * enum_name(switchport_mode_t enum_val);
 }
 
 #include <DA/inline/types/eth_intf.h>
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_ETH_LAG_INTF_H
 #define DA_TYPES_ETH_LAG_INTF_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/intf.h>
 #include <DA/utility.h>
@@ -28,6 +29,8 @@ enum eth_lag_intf_fallback_type_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const eth_lag_intf_fallback_type_t & enum_val);
+/** The name of enum eth_lag_intf_fallback_type_t value, or "Unknown value". */
+char const * enum_name(eth_lag_intf_fallback_type_t enum_val);
 
 /** How long to wait for LACP before fallback. */
 enum eth_lag_intf_fallback_timeout_default_t {
@@ -39,6 +42,8 @@ enum eth_lag_intf_fallback_timeout_default_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const eth_lag_intf_fallback_timeout_default_t & enum_val);
+/** The name of enum eth_lag_intf_fallback_timeout_default_t value, or "Unknown value". */
+char const * enum_name(eth_lag_intf_fallback_timeout_default_t enum_val);
 
 enum eth_lag_intf_member_priority_t {
    ETH_LAG_INTF_PORT_PRIORITY_DEFAULT = 0x8000,
@@ -49,6 +54,8 @@ enum eth_lag_intf_member_priority_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const eth_lag_intf_member_priority_t & enum_val);
+/** The name of enum eth_lag_intf_member_priority_t value, or "Unknown value". */
+char const * enum_name(eth_lag_intf_member_priority_t enum_val);
 
 /** LAG interface mebmer LACP mode. */
 enum eth_lag_intf_member_lacp_mode_t {
@@ -63,6 +70,8 @@ enum eth_lag_intf_member_lacp_mode_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const eth_lag_intf_member_lacp_mode_t & enum_val);
+/** The name of enum eth_lag_intf_member_lacp_mode_t value, or "Unknown value". */
+char const * enum_name(eth_lag_intf_member_lacp_mode_t enum_val);
 
 /** LAG interface mebmer timeout values. */
 enum eth_lag_intf_member_lacp_timeout_t {
@@ -76,6 +85,8 @@ enum eth_lag_intf_member_lacp_timeout_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const eth_lag_intf_member_lacp_timeout_t & enum_val);
+/** The name of enum eth_lag_intf_member_lacp_timeout_t value, or "Unknown value". */
+char const * enum_name(eth_lag_intf_member_lacp_timeout_t enum_val);
 
 /**
  * This data structure is used to describe the operational status
@@ -125,6 +136,12 @@ class DA_SDK_PUBLIC eth_lag_intf_membership_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * eth_lag_intf_membership_t to the ostream.
@@ -189,6 +206,12 @@ class DA_SDK_PUBLIC eth_lag_intf_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of eth_lag_intf_t
     * to the ostream.
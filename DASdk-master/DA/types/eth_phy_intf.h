@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_ETH_PHY_INTF_H
 #define DA_TYPES_ETH_PHY_INTF_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <sstream>
@@ -29,6 +30,8 @@ enum eth_link_speed_t {
 };
 /** Appends a string representation of enum eth_link_speed_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const eth_link_speed_t & enum_val);
+/** The name of enum eth_link_speed_t value, or "Unknown value". */
+char const * enum_name(eth_link_speed_t enum_val);
 
 /**
  * Ethernet interface counter class.
@@ -138,6 +141,12 @@ class DA_SDK_PUBLIC eth_phy_intf_counters_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * eth_phy_intf_counters_t to the ostream.
@@ -275,6 +284,12 @@ class DA_SDK_PUBLIC eth_phy_intf_bin_counters_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * eth_phy_intf_bin_counters_t to the ostream.
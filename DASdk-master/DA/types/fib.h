@@ -4,13 +4,16 @@
 #ifndef DA_TYPES_FIB_H
 #define DA_TYPES_FIB_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/ip.h>
 #include <DA/ip_route.h>
 #include <DA/mpls.h>
 #include <DA/utility.h>
+#include <algorithm>
 #include <forward_list>
 #include <sstream>
+#include <vector>
 
 namespace DA {
 
@@ -31,6 +34,12 @@ class DA_SDK_PUBLIC fib_route_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * fib_route_key_t to the ostream.
@@ -76,6 +85,8 @@ enum fib_route_type_t {
 };
 /** Appends a string representation of enum fib_route_type_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const fib_route_type_t & enum_val);
+/** The name of enum fib_route_type_t value, or "Unknown value". */
+char const * enum_name(fib_route_type_t enum_val);
 
 /**
  * An IP route that goes in FIB.
@@ -114,6 +125,12 @@ class DA_SDK_PUBLIC fib_route_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of fib_route_t to
     * the ostream.
@@ -148,6 +165,12 @@ class DA_SDK_PUBLIC fib_fec_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of fib_fec_key_t
     * to the ostream.
@@ -179,6 +202,12 @@ class DA_SDK_PUBLIC fib_via_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of fib_via_t to
     * the ostream.
@@ -203,6 +232,8 @@ enum fib_fec_type_t {
 };
 /** Appends a string representation of enum fib_fec_type_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const fib_fec_type_t & enum_val);
+/** The name of enum fib_fec_type_t value, or "Unknown value". */
+char const * enum_name(fib_fec_type_t enum_val);
 
 /**
  * FEC (Forwarding Equivalence Class),
@@ -231,10 +262,25 @@ class DA_SDK_PUBLIC fib_fec_t {
 
    /**
     * Getter for 'via': A list of vias that traffic will be distributed amongst.
-    * Duplicate vias will be weighted heavily.
+    * Duplicate vias will be weighted heavily.  The vias are kept in one
+    * block, so copying a FEC allocates once for them rather than once per
+    * via.
+    *
+    * Breaking change: this used to return a std::forward_list const &.  The
+    * std::vector iterates the same way, through begin() and end(), but code
+    * that names the return type or calls list-only methods on it must use
+    * via_list() instead.
     */
-   std::forward_list<fib_via_t> const & via() const;
+   std::vector<fib_via_t> const & via() const;
+   /** Returns a copy of 'via' as a list, like via() used to. */
+   std::forward_list<fib_via_t> via_list() const;
    /** Setter for 'via'. */
+   void via_is(std::vector<fib_via_t> const & via);
+#ifndef SWIG
+   /** Setter for 'via', moving from the passed vector. */
+   void via_is(std::vector<fib_via_t> && via);
+#endif
+   /** Setter for 'via', from a list. */
    void via_is(std::forward_list<fib_via_t> const & via);
    /** Prepend one via to the list. */
    void via_set(fib_via_t const & via);
@@ -245,6 +291,12 @@ class DA_SDK_PUBLIC fib_fec_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of fib_fec_t to
     * the ostream.
@@ -255,7 +307,7 @@ class DA_SDK_PUBLIC fib_fec_t {
    fib_fec_key_t fec_key_;
    fib_fec_type_t fec_type_;
    std::string nexthop_group_name_;
-   std::forward_list<fib_via_t> via_;
+   std::vector<fib_via_t> via_;
 };
 }
 
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_HARDWARE_TABLE_H
 #define DA_TYPES_HARDWARE_TABLE_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <sstream>
@@ -45,6 +46,12 @@ class DA_SDK_PUBLIC hardware_table_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * hardware_table_key_t to the ostream.
@@ -77,6 +84,12 @@ class DA_SDK_PUBLIC hardware_table_high_watermark_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * hardware_table_high_watermark_t to the ostream.
@@ -123,6 +136,12 @@ class DA_SDK_PUBLIC hardware_table_usage_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * hardware_table_usage_t to the ostream.
@@ -163,6 +182,12 @@ class DA_SDK_PUBLIC hardware_table_entry_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * hardware_table_entry_t to the ostream.
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_INTF_H
 #define DA_TYPES_INTF_H
 
+#include <DA/chars_writer.h>
 #include <DA/exception.h>
 #include <DA/hash_mix.h>
 #include <DA/panic.h>
@@ -20,6 +21,8 @@ enum oper_status_t {
 };
 /** Appends a string representation of enum oper_status_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const oper_status_t & enum_val);
+/** The name of enum oper_status_t value, or "Unknown value". */
+char const * enum_name(oper_status_t enum_val);
 
 /** The interface's type. */
 enum intf_type_t {
@@ -36,6 +39,8 @@ enum intf_type_t {
 };
 /** Appends a string representation of enum intf_type_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const intf_type_t & enum_val);
+/** The name of enum intf_type_t value, or "Unknown value". */
+char const * enum_name(intf_type_t enum_val);
 
 /** Unique identifier for an interface. */
 class DA_SDK_PUBLIC intf_id_t {
@@ -65,6 +70,12 @@ class DA_SDK_PUBLIC intf_id_t {
 
    /** Returns the interface name as a string, e.g., 'Ethernet3/1'. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
 
    /**
     * Only the 'default interface' provided by the default constructor evaluates to
@@ -84,6 +95,21 @@ class DA_SDK_PUBLIC intf_id_t {
 
  private:
    friend struct IntfIdHelper;
+   /*
+    * Names are parsed into the id, so that converting between the two doesn't
+    * allocate, and the type and subinterface bits decode in a shift:
+    *
+    *   bits 63-56: the intf_type_t.
+    *   bit 55:     set if the name is interned, see below.
+    *   bits 51-16: up to three slash-separated numbers, e.g. 3 and 1 for
+    *               'Ethernet3/1', each plus one in 12 bits, 0 if absent.
+    *   bits 15-0:  the subinterface number plus one, 0 if not a subinterface.
+    *
+    * Names that don't have that shape, such as 'Tunnel5', are interned in a
+    * process-wide table instead: bit 54 then tells if the name is a
+    * subinterface, and bits 31-0 hold its index in the table.  Parsed ids
+    * compare like their numbers, i.e. 'Ethernet2' < 'Ethernet10'.
+    */
    uint64_t intfId_;
 };
 
@@ -172,6 +198,12 @@ class DA_SDK_PUBLIC intf_counters_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * intf_counters_t to the ostream.
@@ -223,6 +255,12 @@ class DA_SDK_PUBLIC intf_traffic_rates_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * intf_traffic_rates_t to the ostream.
@@ -252,6 +290,12 @@ class DA_SDK_PUBLIC no_such_interface_error : public error {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * no_such_interface_error to the ostream.
@@ -278,6 +322,12 @@ class DA_SDK_PUBLIC not_switchport_eligible_error : public error {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * not_switchport_eligible_error to the ostream.
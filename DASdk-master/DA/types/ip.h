@@ -7,6 +7,7 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <DA/base.h>
+#include <DA/chars_writer.h>
 #include <DA/exception.h>
 #include <DA/hash_mix.h>
 #include <DA/panic.h>
@@ -29,6 +30,8 @@ enum af_t {
 };
 /** Appends a string representation of enum af_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const af_t & enum_val);
+/** The name of enum af_t value, or "Unknown value". */
+char const * enum_name(af_t enum_val);
 
 /**
  * An IP address.
@@ -82,6 +85,12 @@ class DA_SDK_PUBLIC ip_addr_t {
 
    /** String representation of the IP address, e.g. "1.2.3.4" or "f00d::1". */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
 
    operator bool() const;
    /** The hash function for type ip_addr_t. */
@@ -98,7 +107,7 @@ class DA_SDK_PUBLIC ip_addr_t {
       uint8_t bytes[16];
       uint32_t words[4];
    } addr_;
-   friend bool parse_ip_addr(char const *, ip_addr_t * result);
+   friend bool parse_ip_addr(char const *, size_t, ip_addr_t * result);
 };
 
 /**
@@ -142,6 +151,12 @@ class DA_SDK_PUBLIC ip_prefix_t {
     * String representation of the IP prefix, e.g. "10.2.3.4/24" or "cafe::1/218".
     */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    bool operator==(ip_prefix_t const & other) const;
    bool operator!=(ip_prefix_t const & other) const;
    /** The hash function for type ip_prefix_t. */
@@ -155,7 +170,126 @@ class DA_SDK_PUBLIC ip_prefix_t {
  private:
    ip_addr_t addr_;
    uint8_t prefix_length_;
-   friend bool parse_ip_prefix(char const *, ip_prefix_t * result);
+   friend bool parse_ip_prefix(char const *, size_t, ip_prefix_t * result);
+};
+
+/**
+ * An IPv4 address, in 4 bytes.
+ *
+ * ip_addr_t holds either family, which takes 20 bytes per address.  This
+ * type is for large IPv4-only collections, and converts implicitly to an
+ * ip_addr_t wherever the SDK expects one.  It sorts, compares and hashes
+ * the same as the ip_addr_t it converts to.
+ */
+class DA_SDK_PUBLIC ip4_addr_t {
+ public:
+   /** The address 0.0.0.0. */
+   ip4_addr_t();
+   /** Takes a network order 32-bit unsigned integer. */
+   explicit ip4_addr_t(uint32_be_t addr_v4);
+   /** Creates an address from a POSIX in_addr. */
+   explicit ip4_addr_t(in_addr const & addr);
+   /** Narrows an address, calling panic() if it isn't an AF_IPV4 one. */
+   explicit ip4_addr_t(ip_addr_t const & addr);
+   /**
+    * Creates an address from a dotted-quad string, calling panic() if it
+    * isn't a valid IPv4 address.
+    */
+   explicit ip4_addr_t(char const * address_string);
+
+   /** The address as a big endian 32-bit integer. */
+   uint32_be_t addr_v4() const;
+   /** The AF_IPV4 ip_addr_t of this address. */
+   operator ip_addr_t() const;
+
+   bool operator==(ip4_addr_t const & other) const;
+   bool operator!=(ip4_addr_t const & other) const;
+   bool operator<(ip4_addr_t const & other) const;
+
+   /** String representation of the address, e.g. "192.0.2.1". */
+   std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
+   /** The hash function for type ip4_addr_t. */
+   uint32_t hash() const;
+   /**
+    * A utility stream operator that adds a string representation of
+    * ip4_addr_t to the ostream.
+    */
+   friend std::ostream& operator<<(std::ostream& os, const ip4_addr_t& obj);
+
+ private:
+   uint32_be_t addr_;
+   friend bool parse_ip4_addr(char const *, size_t, ip4_addr_t * result);
+};
+
+/**
+ * An IPv4 route prefix, in 5 bytes.
+ *
+ * The compact counterpart of ip_prefix_t, which takes 24 bytes, for large
+ * IPv4-only route tables: it's byte aligned, so an array of them has no
+ * padding.  It converts implicitly to an ip_prefix_t, and hashes the same
+ * as the ip_prefix_t it converts to.
+ */
+class DA_SDK_PUBLIC ip4_prefix_t {
+ public:
+   /** The prefix 0.0.0.0/0. */
+   ip4_prefix_t();
+   /**
+    * Constructs a prefix from a network address and prefix length in bits.
+    *
+    * panic() is called if the prefix length is more than 32, or if the
+    * address has bits set past the prefix length.
+    */
+   ip4_prefix_t(ip4_addr_t const & addr, uint8_t prefix_length);
+   /** Narrows a prefix, calling panic() if it isn't an AF_IPV4 one. */
+   explicit ip4_prefix_t(ip_prefix_t const & prefix);
+   /**
+    * Constructs a prefix from a string such as "10.1.2.0/24", calling
+    * panic() if it isn't a valid IPv4 network prefix.
+    */
+   explicit ip4_prefix_t(char const * prefix_string);
+
+   /** Getter for 'prefix_length': the prefix length in bits. */
+   uint8_t prefix_length() const;
+   /** The prefix's network address. */
+   ip4_addr_t network() const;
+   /** The prefix as a mask, e.g. 255.255.255.0 for a /24. */
+   ip4_addr_t mask() const;
+   /** The AF_IPV4 ip_prefix_t of this prefix. */
+   operator ip_prefix_t() const;
+
+   bool operator==(ip4_prefix_t const & other) const;
+   bool operator!=(ip4_prefix_t const & other) const;
+   /** Orders prefixes by network address, then by prefix length. */
+   bool operator<(ip4_prefix_t const & other) const;
+
+   /** String representation of the prefix, e.g. "10.1.2.0/24". */
+   std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
+   /** The hash function for type ip4_prefix_t. */
+   uint32_t hash() const;
+   /**
+    * A utility stream operator that adds a string representation of
+    * ip4_prefix_t to the ostream.
+    */
+   friend std::ostream& operator<<(std::ostream& os, const ip4_prefix_t& obj);
+
+ private:
+   // The network address in network byte order, as bytes so that the
+   // prefix needs no alignment.
+   uint8_t addr_[4];
+   uint8_t prefix_length_;
+   friend bool parse_ip4_prefix(char const *, size_t, ip4_prefix_t * result);
 };
 
 /**
@@ -186,6 +320,12 @@ class DA_SDK_PUBLIC ip_addr_mask_t {
    uint32_be_t mask() const;
    /** The IP address and mask as a string, e.g., "192.0.2.1/0xFFFFFF00". */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    bool operator==(ip_addr_mask_t const & other) const;
    bool operator!=(ip_addr_mask_t const & other) const;
    bool operator<(ip_addr_mask_t const & other) const;
@@ -213,6 +353,18 @@ class DA_SDK_PUBLIC ip_addr_mask_t {
  */
 bool parse_ip_addr(char const * addr, ip_addr_t * result) DA_SDK_PUBLIC;
 
+/**
+ * Parses an IP address of `len' characters, which needs no terminating null
+ * character, e.g. a field of a larger buffer.  Doesn't allocate memory.
+ *
+ * @param[in] addr Pointer to the characters of the address to parse.
+ * @param[in] len The number of characters of the address.
+ * @param[out] result Mutable argument to place a successfully parsed result into.
+ * @return true if the address parsed successfully, false otherwise.
+ */
+bool parse_ip_addr(char const * addr, size_t len, ip_addr_t * result)
+   DA_SDK_PUBLIC;
+
 /**
  *
  * Parses an IP route prefix, returns true if the prefix is valid.
@@ -229,6 +381,67 @@ bool parse_ip_addr(char const * addr, ip_addr_t * result) DA_SDK_PUBLIC;
  */
 bool parse_ip_prefix(char const * addr, ip_prefix_t * result) DA_SDK_PUBLIC;
 
+/**
+ * Parses an IP route prefix of `len' characters, which needs no terminating
+ * null character.  Doesn't allocate memory.
+ *
+ * @param[in] addr Pointer to the characters of the prefix to parse.
+ * @param[in] len The number of characters of the prefix.
+ * @param[out] result Mutable argument to place a successfully parsed result
+ * into.
+ * @return true if the route prefix parsed successfully, false otherwise.
+ */
+bool parse_ip_prefix(char const * addr, size_t len, ip_prefix_t * result)
+   DA_SDK_PUBLIC;
+
+/**
+ * Parses a buffer of IP route prefixes, one per line, such as the contents of
+ * a route file, without allocating memory.
+ *
+ * Lines end with "\n" or "\r\n", the last one may have no line ending, and
+ * empty lines are skipped.  Parsing stops at the end of the buffer, once
+ * `max_results' prefixes were parsed, or at the first line that isn't a valid
+ * prefix.  If fewer than `max_results' prefixes were parsed and `*consumed' is
+ * less than `len', the line starting at `buf + *consumed' is invalid.
+ *
+ * @param[in] buf The buffer to parse, which needs no terminating null character.
+ * @param[in] len The length of the buffer.
+ * @param[out] result Array of at least `max_results' prefixes to place the
+ * parsed prefixes into, in order.
+ * @param[in] max_results The maximum number of prefixes to parse.
+ * @param[out] consumed If not null, set to the number of bytes of `buf' that
+ * were parsed, which is where to resume parsing.
+ * @return The number of prefixes placed into `result'.
+ */
+size_t parse_ip_prefixes(char const * buf, size_t len, ip_prefix_t * result,
+                         size_t max_results, size_t * consumed) DA_SDK_PUBLIC;
+
+/**
+ * Parses a dotted-quad IPv4 address of `len' characters, the same ones
+ * parse_ip_addr() accepts for AF_IPV4.  IPv6 addresses are rejected.
+ *
+ * @return true if the address parsed successfully, false otherwise.
+ */
+bool parse_ip4_addr(char const * addr, size_t len, ip4_addr_t * result)
+   DA_SDK_PUBLIC;
+
+/**
+ * Parses an IPv4 route prefix of `len' characters, the same ones
+ * parse_ip_prefix() accepts for AF_IPV4.  IPv6 prefixes are rejected.
+ *
+ * @return true if the route prefix parsed successfully, false otherwise.
+ */
+bool parse_ip4_prefix(char const * addr, size_t len, ip4_prefix_t * result)
+   DA_SDK_PUBLIC;
+
+/**
+ * Parses a buffer of IPv4 route prefixes, one per line, like
+ * parse_ip_prefixes() does, into compact prefixes.  Parsing also stops at
+ * the first IPv6 prefix.
+ */
+size_t parse_ip4_prefixes(char const * buf, size_t len, ip4_prefix_t * result,
+                          size_t max_results, size_t * consumed) DA_SDK_PUBLIC;
+
 
 /** Tried to configure an internal VLAN on a trunk port. */
 class DA_SDK_PUBLIC address_overlap_error : public configuration_error {
@@ -243,6 +456,12 @@ class DA_SDK_PUBLIC address_overlap_error : public configuration_error {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * address_overlap_error to the ostream.
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_IP_ROUTE_H
 #define DA_TYPES_IP_ROUTE_H
 
+#include <DA/chars_writer.h>
 #include <DA/eth.h>
 #include <DA/hash_mix.h>
 #include <DA/intf.h>
@@ -34,6 +35,8 @@ enum ip_route_action_t {
  * Appends a string representation of enum ip_route_action_t value to the ostream.
  */
 std::ostream& operator<<(std::ostream& os, const ip_route_action_t & enum_val);
+/** The name of enum ip_route_action_t value, or "Unknown value". */
+char const * enum_name(ip_route_action_t enum_val);
 
 /** An IP route key, consisting of a prefix and preference. */
 class DA_SDK_PUBLIC ip_route_key_t {
@@ -58,6 +61,12 @@ class DA_SDK_PUBLIC ip_route_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of ip_route_key_t
     * to the ostream.
@@ -96,6 +105,12 @@ class DA_SDK_PUBLIC ip_route_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of ip_route_t to
     * the ostream.
@@ -179,6 +194,12 @@ class DA_SDK_PUBLIC ip_route_via_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of ip_route_via_t
     * to the ostream.
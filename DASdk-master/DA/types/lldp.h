@@ -5,6 +5,7 @@
 #define DA_TYPES_LLDP_H
 
 #include <arpa/inet.h>
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <netinet/ether.h>
@@ -38,6 +39,12 @@ class DA_SDK_PUBLIC lldp_tlv_type_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * lldp_tlv_type_t to the ostream.
@@ -69,6 +76,8 @@ enum lldp_std_tlv_type_bit_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const lldp_std_tlv_type_bit_t & enum_val);
+/** The name of enum lldp_std_tlv_type_bit_t value, or "Unknown value". */
+char const * enum_name(lldp_std_tlv_type_bit_t enum_val);
 
 /** Defines a set of remote TLVs (for which we have a value for). */
 class DA_SDK_PUBLIC lldp_std_tlv_type_t {
@@ -99,6 +108,12 @@ class DA_SDK_PUBLIC lldp_std_tlv_type_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * lldp_std_tlv_type_t to the ostream.
@@ -125,6 +140,8 @@ enum lldp_syscap_bits_t {
  * Appends a string representation of enum lldp_syscap_bits_t value to the ostream.
  */
 std::ostream& operator<<(std::ostream& os, const lldp_syscap_bits_t & enum_val);
+/** The name of enum lldp_syscap_bits_t value, or "Unknown value". */
+char const * enum_name(lldp_syscap_bits_t enum_val);
 
 /** Defines a set of remote system capabilities. */
 class DA_SDK_PUBLIC lldp_syscap_t {
@@ -144,6 +161,12 @@ class DA_SDK_PUBLIC lldp_syscap_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of lldp_syscap_t
     * to the ostream.
@@ -189,6 +212,12 @@ class DA_SDK_PUBLIC lldp_management_address_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * lldp_management_address_t to the ostream.
@@ -233,6 +262,12 @@ class DA_SDK_PUBLIC lldp_lacp_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of lldp_lacp_t to
     * the ostream.
@@ -269,6 +304,12 @@ class DA_SDK_PUBLIC lldp_phy_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of lldp_phy_t to
     * the ostream.
@@ -295,6 +336,8 @@ enum lldp_intf_enabled_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const lldp_intf_enabled_t & enum_val);
+/** The name of enum lldp_intf_enabled_t value, or "Unknown value". */
+char const * enum_name(lldp_intf_enabled_t enum_val);
 
 /** encoding format of the chassis name. */
 enum lldp_chassis_id_encoding_t {
@@ -314,6 +357,8 @@ enum lldp_chassis_id_encoding_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const lldp_chassis_id_encoding_t & enum_val);
+/** The name of enum lldp_chassis_id_encoding_t value, or "Unknown value". */
+char const * enum_name(lldp_chassis_id_encoding_t enum_val);
 
 /** The chassis name, as an encoding plus payload. */
 class DA_SDK_PUBLIC lldp_chassis_id_t {
@@ -334,6 +379,12 @@ class DA_SDK_PUBLIC lldp_chassis_id_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * lldp_chassis_id_t to the ostream.
@@ -363,6 +414,8 @@ enum lldp_intf_id_encoding_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const lldp_intf_id_encoding_t & enum_val);
+/** The name of enum lldp_intf_id_encoding_t value, or "Unknown value". */
+char const * enum_name(lldp_intf_id_encoding_t enum_val);
 
 /** The interface name, as an encoding plus payload. */
 class DA_SDK_PUBLIC lldp_intf_id_t {
@@ -383,6 +436,12 @@ class DA_SDK_PUBLIC lldp_intf_id_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of lldp_intf_id_t
     * to the ostream.
@@ -419,6 +478,12 @@ class DA_SDK_PUBLIC lldp_remote_system_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * lldp_remote_system_t to the ostream.
@@ -460,6 +525,12 @@ class DA_SDK_PUBLIC lldp_neighbor_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * lldp_neighbor_t to the ostream.
@@ -4,10 +4,12 @@
 #ifndef DA_TYPES_MAC_TABLE_H
 #define DA_TYPES_MAC_TABLE_H
 
+#include <DA/chars_writer.h>
 #include <DA/eth.h>
 #include <DA/hash_mix.h>
 #include <DA/intf.h>
 #include <DA/utility.h>
+#include <cstring>
 #include <set>
 #include <sstream>
 
@@ -48,6 +50,8 @@ enum mac_entry_type_t {
 };
 /** Appends a string representation of enum mac_entry_type_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const mac_entry_type_t & enum_val);
+/** The name of enum mac_entry_type_t value, or "Unknown value". */
+char const * enum_name(mac_entry_type_t enum_val);
 
 /**
  * The MAC entry key class.
@@ -74,6 +78,12 @@ class DA_SDK_PUBLIC mac_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of mac_key_t to
     * the ostream.
@@ -81,8 +91,15 @@ class DA_SDK_PUBLIC mac_key_t {
    friend std::ostream& operator<<(std::ostream& os, const mac_key_t& obj);
 
  private:
-   vlan_id_t vlan_id_;
-   eth_addr_t eth_addr_;
+   /// Returns the key as one word, see key_.
+   uint64_t word() const;
+   void word_is(uint64_t word);
+
+   // A word holding the VLAN in the top 16 bits, and the address in the low
+   // 48, most significant byte first, so that keys compare and hash as one
+   // word.  It's stored as 16-bit halves, so that the key keeps the 2-byte
+   // alignment of the VLAN and address fields it replaced.
+   uint16_t key_[4];
 };
 
 /** An entry from the MAC address table. */
@@ -118,6 +135,10 @@ class DA_SDK_PUBLIC mac_entry_t {
    std::set<intf_id_t> const & intfs() const;
    /** Setter for 'intfs'. */
    void intfs_is(std::set<intf_id_t> const & intfs);
+#ifndef SWIG
+   /** Setter for 'intfs', moving from the passed container. */
+   void intfs_is(std::set<intf_id_t> && intfs);
+#endif
    /** Inserts one intf of 'value' to the set. */
    void intf_set(intf_id_t const & value);
    /** Deletes one intf of 'value' from the set. */
@@ -145,6 +166,12 @@ class DA_SDK_PUBLIC mac_entry_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of mac_entry_t to
     * the ostream.
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_MACSEC_H
 #define DA_TYPES_MACSEC_H
 
+#include <DA/chars_writer.h>
 #include <DA/exception.h>
 #include <DA/hash_mix.h>
 #include <DA/panic.h>
@@ -25,6 +26,8 @@ enum macsec_cipher_suite_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const macsec_cipher_suite_t & enum_val);
+/** The name of enum macsec_cipher_suite_t value, or "Unknown value". */
+char const * enum_name(macsec_cipher_suite_t enum_val);
 
 /** Which key an interface is using if a profile is configured. */
 enum macsec_intf_key_status_t {
@@ -39,6 +42,8 @@ enum macsec_intf_key_status_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const macsec_intf_key_status_t & enum_val);
+/** The name of enum macsec_intf_key_status_t value, or "Unknown value". */
+char const * enum_name(macsec_intf_key_status_t enum_val);
 
 /** A connectivity association key. */
 class DA_SDK_PUBLIC macsec_key_t {
@@ -70,6 +75,12 @@ class DA_SDK_PUBLIC macsec_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of macsec_key_t
     * to the ostream.
@@ -150,6 +161,12 @@ class DA_SDK_PUBLIC macsec_profile_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * macsec_profile_t to the ostream.
@@ -182,6 +199,12 @@ class DA_SDK_PUBLIC macsec_intf_status_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * macsec_intf_status_t to the ostream.
@@ -219,6 +242,12 @@ class DA_SDK_PUBLIC macsec_intf_counters_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * macsec_intf_counters_t to the ostream.
@@ -16,6 +16,8 @@ enum mlag_state_t {
 };
 /** Appends a string representation of enum mlag_state_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const mlag_state_t & enum_val);
+/** The name of enum mlag_state_t value, or "Unknown value". */
+char const * enum_name(mlag_state_t enum_val);
 }
 
 #include <DA/inline/types/mlag.h>
@@ -5,6 +5,7 @@
 #define DA_TYPES_MPLS_H
 
 #include <DA/base.h>
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <sstream>
@@ -21,6 +22,8 @@ enum mpls_action_t {
 };
 /** Appends a string representation of enum mpls_action_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const mpls_action_t & enum_val);
+/** The name of enum mpls_action_t value, or "Unknown value". */
+char const * enum_name(mpls_action_t enum_val);
 
 /** Whether to use the pipe or uniform TTL inheritance mode. */
 enum mpls_ttl_mode_t {
@@ -32,6 +35,8 @@ enum mpls_ttl_mode_t {
 };
 /** Appends a string representation of enum mpls_ttl_mode_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const mpls_ttl_mode_t & enum_val);
+/** The name of enum mpls_ttl_mode_t value, or "Unknown value". */
+char const * enum_name(mpls_ttl_mode_t enum_val);
 
 /**
  * The inner payload type.
@@ -50,6 +55,8 @@ enum mpls_payload_type_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const mpls_payload_type_t & enum_val);
+/** The name of enum mpls_payload_type_t value, or "Unknown value". */
+char const * enum_name(mpls_payload_type_t enum_val);
 
 /**
  * An MPLS label, per RFC 3032. Note: label id 0 (default value) is the explicit
@@ -80,6 +87,12 @@ class DA_SDK_PUBLIC mpls_label_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of mpls_label_t
     * to the ostream.
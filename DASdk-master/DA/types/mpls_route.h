@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_MPLS_ROUTE_H
 #define DA_TYPES_MPLS_ROUTE_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/intf.h>
 #include <DA/ip.h>
@@ -50,6 +51,12 @@ class DA_SDK_PUBLIC mpls_route_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * mpls_route_key_t to the ostream.
@@ -80,6 +87,12 @@ class DA_SDK_PUBLIC mpls_route_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of mpls_route_t
     * to the ostream.
@@ -156,6 +169,12 @@ class DA_SDK_PUBLIC mpls_route_via_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * mpls_route_via_t to the ostream.
@@ -199,6 +218,12 @@ class DA_SDK_PUBLIC mpls_fec_id_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of mpls_fec_id_t
     * to the ostream.
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_NEIGHBOR_TABLE_H
 #define DA_TYPES_NEIGHBOR_TABLE_H
 
+#include <DA/chars_writer.h>
 #include <DA/eth.h>
 #include <DA/hash_mix.h>
 #include <DA/intf.h>
@@ -24,6 +25,8 @@ enum neighbor_entry_type_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const neighbor_entry_type_t & enum_val);
+/** The name of enum neighbor_entry_type_t value, or "Unknown value". */
+char const * enum_name(neighbor_entry_type_t enum_val);
 
 /**
  * The neighbor entry key class.
@@ -50,6 +53,12 @@ class DA_SDK_PUBLIC neighbor_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of neighbor_key_t
     * to the ostream.
@@ -87,6 +96,12 @@ class DA_SDK_PUBLIC neighbor_entry_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * neighbor_entry_t to the ostream.
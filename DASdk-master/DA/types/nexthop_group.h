@@ -4,8 +4,10 @@
 #ifndef DA_TYPES_NEXTHOP_GROUP_H
 #define DA_TYPES_NEXTHOP_GROUP_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/panic.h>
+#include <DA/small_vector.h>
 #include <DA/utility.h>
 #include <forward_list>
 #include <map>
@@ -38,6 +40,8 @@ enum nexthop_group_encap_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const nexthop_group_encap_t & enum_val);
+/** The name of enum nexthop_group_encap_t value, or "Unknown value". */
+char const * enum_name(nexthop_group_encap_t enum_val);
 
 /** How the GRE tunnel key is set for GRE nexthop groups. */
 enum nexthop_group_gre_key_t {
@@ -55,6 +59,8 @@ enum nexthop_group_gre_key_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const nexthop_group_gre_key_t & enum_val);
+/** The name of enum nexthop_group_gre_key_t value, or "Unknown value". */
+char const * enum_name(nexthop_group_gre_key_t enum_val);
 
 /**
  * An MPLS nexthop group switching operation.
@@ -69,6 +75,9 @@ class DA_SDK_PUBLIC nexthop_group_mpls_action_t {
    /** Constructs an MPLS action with a specific switching operation. */
    explicit nexthop_group_mpls_action_t(mpls_action_t action_type);
    /** Constructs a populated MPLS label stack for some switching action. */
+   nexthop_group_mpls_action_t(mpls_action_t action_type,
+                               small_vector<mpls_label_t, 3> const & label_stack);
+   /** Constructs a populated MPLS label stack from a list. */
    nexthop_group_mpls_action_t(mpls_action_t action_type,
                                std::forward_list<mpls_label_t> const & label_stack);
 
@@ -80,10 +89,24 @@ class DA_SDK_PUBLIC nexthop_group_mpls_action_t {
    /**
     * Getter for 'label_stack': the MPLS label stack.
     *
-    * The first element is the outermost label.
+    * The first element is the outermost label.  Up to 3 labels are stored in
+    * the action itself, so copying it doesn't allocate memory for them.
+    *
+    * Breaking change: this used to return a std::forward_list const &.  The
+    * small_vector iterates the same way, through begin() and end(), but code
+    * that names the return type or calls list-only methods on it must use
+    * label_stack_list() instead.
     */
-   std::forward_list<mpls_label_t> const & label_stack() const;
+   small_vector<mpls_label_t, 3> const & label_stack() const;
+   /** Returns a copy of 'label_stack' as a list, like label_stack() used to. */
+   std::forward_list<mpls_label_t> label_stack_list() const;
    /** Setter for 'label_stack'. */
+   void label_stack_is(small_vector<mpls_label_t, 3> const & label_stack);
+#ifndef SWIG
+   /** Setter for 'label_stack', moving from the passed container. */
+   void label_stack_is(small_vector<mpls_label_t, 3> && label_stack);
+#endif
+   /** Setter for 'label_stack', from a list. */
    void label_stack_is(std::forward_list<mpls_label_t> const & label_stack);
    /** Prepend one label_stack to the list. */
    void label_stack_set(mpls_label_t const & label_stack);
@@ -97,6 +120,12 @@ class DA_SDK_PUBLIC nexthop_group_mpls_action_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * nexthop_group_mpls_action_t to the ostream.
@@ -106,7 +135,7 @@ class DA_SDK_PUBLIC nexthop_group_mpls_action_t {
 
  private:
    mpls_action_t action_type_;
-   std::forward_list<mpls_label_t> label_stack_;
+   small_vector<mpls_label_t, 3> label_stack_;
 };
 
 /** Defines counter for a nexthop entry. */
@@ -126,6 +155,12 @@ class DA_SDK_PUBLIC nexthop_group_entry_counter_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * nexthop_group_entry_counter_t to the ostream.
@@ -166,6 +201,12 @@ class DA_SDK_PUBLIC nexthop_group_entry_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * nexthop_group_entry_t to the ostream.
@@ -234,6 +275,10 @@ class DA_SDK_PUBLIC nexthop_group_t {
    std::map<uint16_t, nexthop_group_entry_t> const & nexthops() const;
    /** Setter for 'nexthops'. */
    void nexthops_is(std::map<uint16_t, nexthop_group_entry_t> const & nexthops);
+#ifndef SWIG
+   /** Setter for 'nexthops', moving from the passed container. */
+   void nexthops_is(std::map<uint16_t, nexthop_group_entry_t> && nexthops);
+#endif
    /** Inserts key/value pair to the map. */
    void nexthop_set(uint16_t key, nexthop_group_entry_t const & value);
    /** Deletes the key/value pair from the map. */
@@ -246,6 +291,10 @@ class DA_SDK_PUBLIC nexthop_group_t {
    std::map<uint16_t, ip_addr_t> const & destination_ips() const;
    /** Setter for 'destination_ips'. */
    void destination_ips_is(std::map<uint16_t, ip_addr_t> const & destination_ips);
+#ifndef SWIG
+   /** Setter for 'destination_ips', moving from the passed container. */
+   void destination_ips_is(std::map<uint16_t, ip_addr_t> && destination_ips);
+#endif
    /** Inserts key/value pair to the map. */
    void destination_ip_set(uint16_t key, ip_addr_t const & value);
    /** Deletes the key/value pair from the map. */
@@ -258,6 +307,12 @@ class DA_SDK_PUBLIC nexthop_group_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * nexthop_group_t to the ostream.
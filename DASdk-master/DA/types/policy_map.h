@@ -5,6 +5,7 @@
 #define DA_TYPES_POLICY_MAP_H
 
 #include <DA/acl.h>
+#include <DA/chars_writer.h>
 #include <DA/exception.h>
 #include <DA/hash_mix.h>
 #include <DA/intf.h>
@@ -36,6 +37,8 @@ enum policy_match_condition_t {
  */
 std::ostream& operator<<(std::ostream& os,
                          const policy_match_condition_t & enum_val);
+/** The name of enum policy_match_condition_t value, or "Unknown value". */
+char const * enum_name(policy_match_condition_t enum_val);
 
 /** A hardware feature a policy map can be used with. */
 enum policy_feature_t {
@@ -46,6 +49,8 @@ enum policy_feature_t {
 };
 /** Appends a string representation of enum policy_feature_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const policy_feature_t & enum_val);
+/** The name of enum policy_feature_t value, or "Unknown value". */
+char const * enum_name(policy_feature_t enum_val);
 
 /** The actions a policy map rule may apply to classified packets. */
 enum policy_action_type_t {
@@ -68,6 +73,8 @@ enum policy_action_type_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const policy_action_type_t & enum_val);
+/** The name of enum policy_action_type_t value, or "Unknown value". */
+char const * enum_name(policy_action_type_t enum_val);
 
 /** The policy map rule type. Valid types are IPV4 IPV6 and CLASSMAP. */
 enum policy_map_rule_type_t {
@@ -80,6 +87,8 @@ enum policy_map_rule_type_t {
  * ostream.
  */
 std::ostream& operator<<(std::ostream& os, const policy_map_rule_type_t & enum_val);
+/** The name of enum policy_map_rule_type_t value, or "Unknown value". */
+char const * enum_name(policy_map_rule_type_t enum_val);
 
 /** The key used to uniquely identify both class and policy maps. */
 class DA_SDK_PUBLIC policy_map_key_t {
@@ -100,6 +109,12 @@ class DA_SDK_PUBLIC policy_map_key_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * policy_map_key_t to the ostream.
@@ -133,6 +148,13 @@ class DA_SDK_PUBLIC policy_map_action_t {
     */
    explicit policy_map_action_t(policy_action_type_t action_type);
    virtual ~policy_map_action_t();
+   policy_map_action_t(policy_map_action_t const &) = default;
+   policy_map_action_t & operator=(policy_map_action_t const &) = default;
+#ifndef SWIG
+   // Declared since the virtual destructor suppresses the implicit moves.
+   policy_map_action_t(policy_map_action_t &&) = default;
+   policy_map_action_t & operator=(policy_map_action_t &&) = default;
+#endif
 
    policy_action_type_t action_type() const;
    void action_type_is(policy_action_type_t action_type);
@@ -150,6 +172,10 @@ class DA_SDK_PUBLIC policy_map_action_t {
 
    std::unordered_set<ip_addr_t> const & nexthops() const;
    void nexthops_is(std::unordered_set<ip_addr_t> const & nexthops);
+#ifndef SWIG
+   /** Setter for 'nexthops', moving from the passed container. */
+   void nexthops_is(std::unordered_set<ip_addr_t> && nexthops);
+#endif
    /** Inserts one nexthop of 'value' to the set. */
    void nexthop_set(ip_addr_t const & value);
    /** Deletes one nexthop of 'value' from the set. */
@@ -188,6 +214,12 @@ class DA_SDK_PUBLIC policy_map_action_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * policy_map_action_t to the ostream.
@@ -254,6 +286,10 @@ class DA_SDK_PUBLIC policy_map_rule_t {
    std::set<policy_map_action_t> const & actions() const;
    /** Setter for 'actions'. */
    void actions_is(std::set<policy_map_action_t> const & actions);
+#ifndef SWIG
+   /** Setter for 'actions', moving from the passed container. */
+   void actions_is(std::set<policy_map_action_t> && actions);
+#endif
    /** Inserts one action of 'value' to the set. */
    void action_set(policy_map_action_t const & value);
    /** Deletes one action of 'value' from the set. */
@@ -268,6 +304,12 @@ class DA_SDK_PUBLIC policy_map_rule_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * policy_map_rule_t to the ostream.
@@ -298,6 +340,10 @@ class DA_SDK_PUBLIC policy_map_t {
    std::map<uint32_t, policy_map_rule_t> const & rules() const;
 
    void rules_is(std::map<uint32_t, policy_map_rule_t> const & rules);
+#ifndef SWIG
+   /** Setter for 'rules', moving from the passed container. */
+   void rules_is(std::map<uint32_t, policy_map_rule_t> && rules);
+#endif
    void rule_set(uint32_t key, policy_map_rule_t const & value);
    void rule_del(uint32_t key);
    bool operator==(policy_map_t const & other) const;
@@ -307,6 +353,12 @@ class DA_SDK_PUBLIC policy_map_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of policy_map_t
     * to the ostream.
@@ -332,6 +384,12 @@ class DA_SDK_PUBLIC unsupported_policy_feature_error : public unsupported_error
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of
     * unsupported_policy_feature_error to the ostream.
@@ -19,6 +19,8 @@ enum mgr_mode_type_t {
 };
 /** Appends a string representation of enum mgr_mode_type_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const mgr_mode_type_t & enum_val);
+/** The name of enum mgr_mode_type_t value, or "Unknown value". */
+char const * enum_name(mgr_mode_type_t enum_val);
 }
 
 #include <DA/inline/types/sdk.h>
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_SUBINTF_H
 #define DA_TYPES_SUBINTF_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/types/eth.h>
 #include <DA/types/intf.h>
@@ -32,6 +33,12 @@ class DA_SDK_PUBLIC subintf_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of subintf_t to
     * the ostream.
@@ -4,6 +4,7 @@
 #ifndef DA_TYPES_VRF_H
 #define DA_TYPES_VRF_H
 
+#include <DA/chars_writer.h>
 #include <DA/hash_mix.h>
 #include <DA/utility.h>
 #include <sstream>
@@ -23,6 +24,8 @@ enum vrf_state_t {
 };
 /** Appends a string representation of enum vrf_state_t value to the ostream. */
 std::ostream& operator<<(std::ostream& os, const vrf_state_t & enum_val);
+/** The name of enum vrf_state_t value, or "Unknown value". */
+char const * enum_name(vrf_state_t enum_val);
 
 /** @deprecated. This data structure is used to describe a VRF on a switch. */
 class DA_SDK_PUBLIC vrf_t {
@@ -46,6 +49,12 @@ class DA_SDK_PUBLIC vrf_t {
    uint32_t hash() const;
    /** Returns a string representation of the current object's values. */
    std::string to_string() const;
+   /**
+    * Writes the string representation of the current object's values into
+    * [first, last), without allocating, and returns the end of what was
+    * written, or null if it didn't fit.
+    */
+   char * to_chars(char * first, char * last) const;
    /**
     * A utility stream operator that adds a string representation of vrf_t to the
     * ostream.
@@ -125,6 +125,7 @@ typedef uint64_t uint64_be_t;
 #include "DA/nexthop_group.h"
 #include "DA/policy_map.h"
 #include "DA/sdk.h"
+#include "DA/small_vector.h"
 #include "DA/subintf.h"
 #include "DA/system.h"
 #include "DA/timer.h"
@@ -196,6 +197,8 @@ void throw_py_error(error const& err) {
   SWIG_fail;
 }
 
+// Python iterates one element at a time through next().
+%ignore DA::iter_base::next_batch;
 %include "DA/iterator.h"
 
 %define wrap_iterator(IteratorClass, IteratorImplClass, ReturnType)
@@ -243,6 +246,7 @@ void throw_py_error(error const& err) {
 %template() std::map<DA::lldp_tlv_type_t, std::string>;
 %template() std::list<DA::lldp_management_address_t>;
 %template() std::vector<std::string>;
+%template() std::map<std::string, DA::loop_histogram_t>;
 
 // For vlan_set_t
 %template(_BitSet4096) std::bitset<4096>;
@@ -258,6 +262,26 @@ void throw_py_error(error const& err) {
 // Python code should use Python exceptions, and not call panic().
 %ignore panic;
 %ignore vpanic;
+// Timers created through the timeout_mgr take a C++ callback, Python code
+// should subclass timeout_handler instead.
+%ignore DA::timeout_mgr::timer_once;
+%ignore DA::timeout_mgr::timer_periodic;
+// Same thing for callbacks posted to event loop shards.
+%ignore DA::event_loop::post;
+// Python code has no use for parsing into arrays of prefixes, or for
+// formatting into buffers: it has to_string().
+%ignore DA::parse_ip_prefixes;
+%ignore DA::chars_writer;
+%ignore *::to_chars;
+// Lists are passed to Python as tuples, through the vector overloads.
+%ignore DA::small_vector;
+%ignore DA::fib_fec_t::via_is(std::forward_list<DA::fib_via_t> const &);
+%ignore DA::fib_fec_t::via_list;
+%ignore DA::nexthop_group_mpls_action_t::label_stack_list;
+%ignore DA::nexthop_group_mpls_action_t::label_stack_is(
+   std::forward_list<DA::mpls_label_t> const &);
+%ignore DA::nexthop_group_mpls_action_t::nexthop_group_mpls_action_t(
+   DA::mpls_action_t, std::forward_list<DA::mpls_label_t> const &);
 %include "Includes.i"
 
 
@@ -55,18 +55,19 @@ namespace std {
    };
 }
 
-%define STD_FORWARD_LIST(data_type)
+// Passes a std::vector or small_vector of data_type as a tuple.
+%define VECTOR_TUPLE(vector_type, data_type)
 
 // Python --> C
-%typemap(in) std::forward_list<DA::##data_type> const & {
+%typemap(in) vector_type const & {
    PyObject *t = $input;
    if (PyTuple_Check(t) != true) {
       PyErr_SetString(PyExc_TypeError, "argument must be a tuple");
       return NULL;
    }
 
-   std::forward_list<DA::##data_type> *a = new std::forward_list<DA::##data_type>();
-   auto it = a->before_begin();
+   vector_type *a = new vector_type();
+   a->reserve(PyTuple_Size(t));
    for (int i=0; i<PyTuple_Size(t); i++) {
       PyObject *fv = PyTuple_GetItem(t, i);
       DA::##data_type *fv_c;
@@ -79,7 +80,7 @@ namespace std {
          SWIG_exception(SWIG_TypeError, buf);
          return NULL;
       } else {
-         it = a->insert_after(it, *fv_c);
+         a->push_back(*fv_c);
       }
    }
 
@@ -87,25 +88,18 @@ namespace std {
 }
 
 // C --> Python
-%typemap(out) std::forward_list<DA::##data_type> const & {
-   std::forward_list<DA::##data_type> *a = $1;
-   std::forward_list<DA::##data_type>::const_iterator it;
-   int count = 0;
-   for (it=a->cbegin(); it!=a->cend(); ++it) {
-      count += 1;
-   }
-   PyObject *t = PyTuple_New(count);
-   int i = 0;
-   for (it=a->cbegin(); it!=a->cend(); ++it) {
-      PyObject *fv = SWIG_NewPointerObj((void *)&(*it),
+%typemap(out) vector_type const & {
+   vector_type *a = $1;
+   PyObject *t = PyTuple_New(a->size());
+   for (size_t i = 0; i < a->size(); i++) {
+      PyObject *fv = SWIG_NewPointerObj((void *)&(*a)[i],
                                         SWIGTYPE_p_DA__##data_type,
                                         0);
       PyTuple_SetItem(t, i, fv);
-      i++;
    }
    $result = t;
 }
 %enddef
 
-STD_FORWARD_LIST(fib_via_t)
-STD_FORWARD_LIST(mpls_label_t)
+VECTOR_TUPLE(std::vector<DA::fib_via_t>, fib_via_t)
+VECTOR_TUPLE(%arg(DA::small_vector<DA::mpls_label_t, 3>), mpls_label_t)
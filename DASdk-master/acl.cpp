@@ -3,6 +3,7 @@
 
 #include "DA/acl.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 // TODO: an implementation that provides a mock Sysdb view
 // Current implmentation is mostly no-ops
@@ -32,42 +33,70 @@ acl_handler::on_acl_sync_fail(std::string const & linecard,
 
 class acl_mgr_impl : public acl_mgr {
  public:
+   using acl_mgr::acl_rule_set;
+
    acl_mgr_impl() {
    }
 
    acl_iter_t acl_iter() const {
-      acl_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return acl_iter_impl::iter(acls_.snapshot());
    }
 
-   acl_rule_ip_iter_t acl_rule_ip_iter(acl_key_t const &) const {
-      acl_rule_ip_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+   acl_rule_ip_iter_t acl_rule_ip_iter(acl_key_t const & key) const {
+      auto it = rules_.find(key);
+      if (it == rules_.end()) {
+         return acl_rule_ip_iter_impl::iter();
+      }
+      return acl_rule_ip_iter_impl::iter(it->second.ip.snapshot());
    }
 
-   acl_rule_eth_iter_t acl_rule_eth_iter(acl_key_t const &) const {
-      acl_rule_eth_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+   acl_rule_eth_iter_t acl_rule_eth_iter(acl_key_t const & key) const {
+      auto it = rules_.find(key);
+      if (it == rules_.end()) {
+         return acl_rule_eth_iter_impl::iter();
+      }
+      return acl_rule_eth_iter_impl::iter(it->second.eth.snapshot());
    }
 
    bool acl_exists(acl_key_t const & key) const {
-      return true;
+      return acls_.find(key);
    }
 
    void acl_apply(acl_key_t const & key, intf_id_t intf,
                   acl_direction_t direction, bool apply) {
    }
 
-   void acl_rule_set(acl_key_t const &, uint32_t, acl_rule_ip_t const &) {
+   void acl_rule_set(acl_key_t const & key, uint32_t seq,
+                     acl_rule_ip_t const & rule) {
+      acl_rules(key).ip.set(seq, rule);
+   }
+
+   void acl_rule_set_moved(acl_key_t const & key, uint32_t seq,
+                           acl_rule_ip_t & rule) {
+      acl_rules(key).ip.set(seq, std::move(rule));
    }
 
-   void acl_rule_set(acl_key_t const &, uint32_t, acl_rule_eth_t const &) {
+   void acl_rule_set(acl_key_t const & key, uint32_t seq,
+                     acl_rule_eth_t const & rule) {
+      acl_rules(key).eth.set(seq, rule);
    }
 
-   void acl_rule_del(acl_key_t const &, uint32_t seq) {
+   void acl_rule_set_moved(acl_key_t const & key, uint32_t seq,
+                           acl_rule_eth_t & rule) {
+      acl_rules(key).eth.set(seq, std::move(rule));
    }
 
-   void acl_del(acl_key_t const &) {
+   void acl_rule_del(acl_key_t const & key, uint32_t seq) {
+      auto it = rules_.find(key);
+      if (it != rules_.end()) {
+         it->second.ip.del(seq);
+         it->second.eth.del(seq);
+      }
+   }
+
+   void acl_del(acl_key_t const & key) {
+      acls_.del(key);
+      rules_.erase(key);
    }
 
    void acl_counters_enabled_set(acl_key_t const &, bool enabled) {
@@ -88,8 +117,36 @@ class acl_mgr_impl : public acl_mgr {
 
    void acl_commit() {
    }
+
+ private:
+   /// The rules of an ACL, in sequence number order.
+   struct acl_rules_t {
+      sorted_snapshot_table<uint32_t, acl_rule_ip_t> ip;
+      sorted_snapshot_table<uint32_t, acl_rule_eth_t> eth;
+   };
+
+   // The rules of `key', which adds the ACL if it is new.
+   acl_rules_t & acl_rules(acl_key_t const & key) {
+      acls_.set(key, no_value());
+      return rules_[key];
+   }
+
+   snapshot_table<acl_key_t, no_value> acls_;
+   std::unordered_map<acl_key_t, acl_rules_t, sdk_hash> rules_;
 };
 
+void
+acl_mgr::acl_rule_set_moved(acl_key_t const & key, uint32_t seq,
+                            acl_rule_ip_t & rule) {
+   acl_rule_set(key, seq, rule);
+}
+
+void
+acl_mgr::acl_rule_set_moved(acl_key_t const & key, uint32_t seq,
+                            acl_rule_eth_t & rule) {
+   acl_rule_set(key, seq, rule);
+}
+
 DEFINE_STUB_MGR_CTOR(acl_mgr)
 
 }  // end namespace DA
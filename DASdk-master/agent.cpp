@@ -3,9 +3,11 @@
 
 #include <cstdlib>  // for abort()
 #include <functional> // For dummy agent_id impl
+#include <map>
 
 #include "DA/agent.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -32,6 +34,7 @@ void agent_handler::on_agent_option(std::string const & name,
 }
 
 static void call_on_initialized(agent_handler* handler) {
+   loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
    handler->on_initialized();
 }
 
@@ -60,29 +63,32 @@ class agent_mgr_impl : public agent_mgr {
    }
 
    agent_option_iter_t agent_option_iter() const {
-      agent_option_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return agent_option_iter_impl::iter();
    }
 
    std::string 
    status(std::string const & key) const {
-      return "";
+      auto it = status_.find(key);
+      return it == status_.end() ? "" : it->second;
    }
 
    agent_status_iter_t status_iter() const {
-      agent_status_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return agent_status_iter_impl::iter();
    }
 
 
    void
    status_set(std::string const & key, std::string const & value) {
+      status_[key] = value;
    }
 
    void
    status_del(std::string const & key) {
+      status_.erase(key);
    }
-   
+
+ private:
+   std::map<std::string, std::string> status_;
 };
 
 void handle_agent_initialize(agent_mgr * mgr) {
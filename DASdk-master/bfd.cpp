@@ -3,6 +3,7 @@
 
 #include <DA/bfd.h>
 #include <impl.h>
+#include <iterator_impl.h>
 
 namespace DA {
 
@@ -13,8 +14,7 @@ class bfd_session_mgr_impl : public bfd_session_mgr {
    }
 
    bfd_session_iter_t session_iter() const {
-      bfd_session_iter_t * nop = 0;
-      return *nop;
+      return bfd_session_iter_impl::iter();
    }
 
    bool exists(bfd_session_key_t const & key) const {
@@ -3,11 +3,14 @@
 
 #include "DA/class_map.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
 class class_map_mgr_impl : public class_map_mgr {
  public:
+   using class_map_mgr::class_map_is;
+
    class_map_mgr_impl() {
    }
 
@@ -29,14 +32,18 @@ class class_map_mgr_impl : public class_map_mgr {
    }
 
    class_map_iter_t class_map_iter(policy_feature_t) const {
-      class_map_iter_t * nop = 0;
-      return *nop;
+      return class_map_iter_impl::iter();
    }
 
    void class_map_del(class_map_key_t const & key) {
    }
 };
 
+void
+class_map_mgr::class_map_is_moved(class_map_t & class_map) {
+   class_map_is(class_map);
+}
+
 DEFINE_STUB_MGR_CTOR(class_map_mgr)
 
 }
@@ -6,11 +6,14 @@
 #include "DA/decap_group.h"
 #include "DA/panic.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
 class decap_group_mgr_impl : public decap_group_mgr {
  public:
+   using decap_group_mgr::decap_group_set;
+
     decap_group_mgr_impl() {
     }
 
@@ -23,8 +26,7 @@ class decap_group_mgr_impl : public decap_group_mgr {
     }
 
     decap_group_iter_t decap_group_iter() const {
-       decap_group_iter_t * nop = 0;
-       return *nop;  // TODO: No op impl.
+       return decap_group_iter_impl::iter();
     }
 
    decap_group_t decap_group(std::string const & decap_group_name) const {
@@ -45,6 +47,11 @@ class decap_group_mgr_impl : public decap_group_mgr {
     }
 };
 
+void
+decap_group_mgr::decap_group_set_moved(decap_group_t & group) {
+   decap_group_set(group);
+}
+
 DEFINE_STUB_MGR_CTOR(decap_group_mgr)
 
 };  // end namespace DA
@@ -3,6 +3,7 @@
 
 #include "DA/directflow.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -32,12 +33,13 @@ flow_handler::on_flow_status(const std::string & name, flow_status_t status) {
 
 class directflow_mgr_impl : public directflow_mgr {
  public:
+   using directflow_mgr::flow_entry_set;
+
    directflow_mgr_impl() {
    }
 
    flow_entry_iter_t flow_entry_iter() const {
-      flow_entry_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return flow_entry_iter_impl::iter();
    }
 
    bool exists(std::string const & name) const {
@@ -68,6 +70,11 @@ class directflow_mgr_impl : public directflow_mgr {
 
 };
 
+void
+directflow_mgr::flow_entry_set_moved(flow_entry_t & flow) {
+   flow_entry_set(flow);
+}
+
 DEFINE_STUB_MGR_CTOR(directflow_mgr)
 
 }
@@ -4,6 +4,7 @@
 #include <cassert>
 #include "DA/eth_intf.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -39,8 +40,7 @@ class eth_intf_mgr_impl : public eth_intf_mgr {
    }
 
    eth_intf_iter_t eth_intf_iter() const {
-      eth_intf_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return eth_intf_iter_impl::iter();
    }
 
    bool exists(intf_id_t) const {
@@ -3,6 +3,7 @@
 
 #include <DA/eth_lag_intf.h>
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -55,8 +56,7 @@ class eth_lag_intf_mgr_impl : public eth_lag_intf_mgr {
    }
 
    eth_lag_intf_iter_t eth_lag_intf_iter() const {
-      eth_lag_intf_iter_t * nop = 0;
-      return *nop;
+      return eth_lag_intf_iter_impl::iter();
    }
 
    bool exists(intf_id_t intf_id) const {
@@ -64,14 +64,12 @@ class eth_lag_intf_mgr_impl : public eth_lag_intf_mgr {
    }
 
    eth_lag_intf_member_iter_t eth_lag_intf_member_iter() const {
-      eth_lag_intf_member_iter_t * nop = 0;
-      return *nop;
+      return eth_lag_intf_member_iter_impl::iter();
    }
 
    eth_lag_intf_member_iter_t eth_lag_intf_member_iter(
          intf_id_t eth_lag_intf_id) const {
-      eth_lag_intf_member_iter_t * nop = 0;
-      return *nop;
+      return eth_lag_intf_member_iter_impl::iter();
    }
 
    void eth_lag_intf_is(intf_id_t eth_lag_intf_id) {
@@ -3,6 +3,7 @@
 
 #include "DA/eth_phy_intf.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -46,8 +47,7 @@ class eth_phy_intf_mgr_impl : public eth_phy_intf_mgr {
    }
 
    eth_phy_intf_iter_t eth_phy_intf_iter() const {
-      eth_phy_intf_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return eth_phy_intf_iter_impl::iter();
    }
 
    bool exists(intf_id_t) const {
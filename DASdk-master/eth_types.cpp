@@ -2,24 +2,104 @@
 // Arista Networks, Inc. Confidential and Proprietary.
 
 #include "DA/eth.h"
+#include "DA/panic.h"
 #include <assert.h>
 #include <string.h>
 
 namespace DA {
 
+namespace {
+
+// Maps each character to its value as a hex digit, or to -1.
+struct hex_digit_table {
+   constexpr hex_digit_table() : value() {
+      for (int c = 0; c < 256; ++c) {
+         value[c] = c >= '0' && c <= '9' ? c - '0' :
+                    c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                    c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+      }
+   }
+   int8_t value[256];
+};
+
+}
+
+static constexpr hex_digit_table hex_digits;
+
+bool
+parse_eth_addr(char const * addr, size_t len, eth_addr_t * result) {
+   // The separator tells the format: 6 groups of up to 2 digits, 3 groups
+   // of up to 4 digits, or 12 digits in a row.
+   int groups = 1;
+   int max_digits = 12;
+   char separator = 0;
+   for (size_t i = 0; i < len && i < 5; ++i) {
+      char c = addr[i];
+      if (c == ':' || c == '-') {
+         groups = 6;
+         max_digits = 2;
+      } else if (c == '.') {
+         groups = 3;
+         max_digits = 4;
+      } else {
+         continue;
+      }
+      separator = c;
+      break;
+   }
+   int bits_per_group = 48 / groups;
+   char const * p = addr;
+   char const * end = addr + len;
+   uint64_t value = 0;
+   for (int group = 0; group < groups; ++group) {
+      if (group) {
+         if (p == end || *p != separator) {
+            return false;
+         }
+         ++p;
+      }
+      uint64_t group_value = 0;
+      int digits = 0;
+      for (; p != end && digits < max_digits; ++p, ++digits) {
+         int digit = hex_digits.value[static_cast<unsigned char>(*p)];
+         if (digit < 0) {
+            break;
+         }
+         group_value = group_value << 4 | digit;
+      }
+      // Groups may be shortened, except when there are no separators.
+      if (!digits || (!separator && digits != max_digits)) {
+         return false;
+      }
+      value = value << bits_per_group | group_value;
+   }
+   if (p != end) {
+      return false;
+   }
+   for (int i = 5; i >= 0; --i) {
+      result->bytes_[i] = uint8_t(value);
+      value >>= 8;
+   }
+   return true;
+}
+
+bool
+parse_eth_addr(char const * addr, eth_addr_t * result) {
+   return parse_eth_addr(addr, strlen(addr), result);
+}
+
 eth_addr_t::eth_addr_t(char const * addr) :
       bytes_{} {
-   // TODO: No op impl.
+   if (!parse_eth_addr(addr, this)) {
+      panic(invalid_argument_error("addr", "invalid Ethernet address."));
+   }
 }
 
 eth_addr_t::eth_addr_t(std::string const & addr) :
       bytes_{} {
-   // TODO: No op impl.
-}
-
-bool
-eth_addr_t::operator<(eth_addr_t other) const {
-   return memcmp(bytes_, other.bytes_, 6) < 0;
+   if (!parse_eth_addr(addr.data(), addr.size(), this)) {
+      panic(invalid_argument_error("addr", "invalid Ethernet address."));
+   }
 }
 
 uint8_t
@@ -32,11 +112,6 @@ eth_addr_t::byte(int index) const {
    
 }
 
-void
-eth_addr_t::bytes(void * arr) const {
-   memcpy(arr, bytes_, sizeof(bytes_));
-}
-
 
 
 
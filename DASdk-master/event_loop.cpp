@@ -1,30 +1,53 @@
 // Copyright (c) 2013 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
+#include <cstdio>  // for snprintf()
+#include <cstring>  // for memset()
+
+#include "DA/exception.h"
 #include "DA/panic.h"
 #include "DA/event_loop.h"
 #include "impl.h"
 
 namespace DA {
 
+// Once we're integrated in an external loop, events are dispatched straight
+// to the handlers concerned, without going through a pass of our own loop.
+
 void
-event_loop_handler::on_readable(int) {
-   impl.main_loop(0);
+event_loop_handler::on_readable(int fd) {
+   if(!impl.external_loop()) {
+      impl.main_loop(0);
+      return;
+   }
+   impl.external_fd_event(fd, fd_handler_sm::WANT_READ);
 }
 
 void
-event_loop_handler::on_writable(int) {
-   impl.main_loop(0);
+event_loop_handler::on_writable(int fd) {
+   if(!impl.external_loop()) {
+      impl.main_loop(0);
+      return;
+   }
+   impl.external_fd_event(fd, fd_handler_sm::WANT_WRITE);
 }
 
 void
-event_loop_handler::on_exception(int) {
-   impl.main_loop(0);
+event_loop_handler::on_exception(int fd) {
+   if(!impl.external_loop()) {
+      impl.main_loop(0);
+      return;
+   }
+   impl.external_fd_event(fd, fd_handler_sm::WANT_EXCEPT);
 }
 
 void
 event_loop_handler::on_timeout() {
-   impl.main_loop(0);
+   if(!impl.external_loop()) {
+      impl.main_loop(0);
+      return;
+   }
+   impl.external_timeout();
 }
 
 event_loop::event_loop(mount_mgr * mgr) : mount_mgr_(mgr) {
@@ -57,7 +80,121 @@ event_loop::external_loop_is(event_loop_handler * loop) {
       panic("The event_loop_handler passed in argument was null");
    }
    loop_ = loop;
-   // TODO: No-op impl.
+   impl.external_loop_is(loop);
+}
+
+void
+event_loop::shards_is(uint32_t count) {
+   if(!count) {
+      panic(invalid_argument_error("count", "there is always at least one shard"));
+   }
+   impl.shards_is(count);
+}
+
+uint32_t
+event_loop::shards() const {
+   return impl.shards();
+}
+
+uint32_t
+event_loop::current_shard() const {
+   return Impl::current().shard_id();
+}
+
+void
+event_loop::post(uint32_t shard, shard_callback_t const & callback) {
+   if(!callback) {
+      panic(invalid_argument_error("callback", "must not be empty"));
+   }
+   impl.shard(shard)->post(callback);
+}
+
+void
+event_loop::stats_enabled_is(bool enabled) {
+   Impl::current().stats_enabled_is(enabled);
+}
+
+bool
+event_loop::stats_enabled() const {
+   return Impl::current().stats() != 0;
+}
+
+loop_histogram_t
+event_loop::stats(loop_stat_t stat) const {
+   return Impl::current().stat(stat);
+}
+
+std::map<std::string, loop_histogram_t>
+event_loop::handler_stats() const {
+   return Impl::current().handler_stats();
+}
+
+void
+event_loop::stats_status_interval_is(seconds_t interval) {
+   if(interval < 0) {
+      panic(invalid_argument_error("interval", "must not be negative"));
+   }
+   if(&Impl::current() != &impl) {
+      panic("Loop stats can only be published from the main loop");
+   }
+   impl.stats_status_interval_is(interval);
+}
+
+loop_histogram_t::loop_histogram_t() {
+   reset();
+}
+
+void
+loop_histogram_t::reset() {
+   memset(buckets_, 0, sizeof(buckets_));
+   count_ = 0;
+   total_ns_ = 0;
+   max_ns_ = 0;
+}
+
+uint64_t
+loop_histogram_t::bucket_upper_bound(int bucket) {
+   if(bucket < (1 << linear_bits)) {
+      return uint64_t(bucket);
+   }
+   int shift = (bucket >> linear_bits) - 1;
+   uint64_t sub_bucket = uint64_t(bucket) & ((1 << linear_bits) - 1);
+   uint64_t lower = ((uint64_t(1) << linear_bits) + sub_bucket) << shift;
+   return lower + ((uint64_t(1) << shift) - 1);
+}
+
+seconds_t
+loop_histogram_t::percentile(double percentile) const {
+   if(!count_) {
+      return 0;
+   }
+   // Rank of the value we're looking for, counting from 1.
+   uint64_t rank = uint64_t(percentile / 100 * count_ + 0.5);
+   if(rank < 1) {
+      rank = 1;
+   } else if(rank > count_) {
+      rank = count_;
+   }
+   uint64_t seen = 0;
+   for(int i = 0; i < num_buckets; i++) {
+      seen += buckets_[i];
+      if(seen >= rank) {
+         uint64_t bound = bucket_upper_bound(i);
+         return (bound < max_ns_ ? bound : max_ns_) / 1e9;
+      }
+   }
+   return max();
+}
+
+std::string
+loop_histogram_t::to_string() const {
+   char buf[160];
+   snprintf(buf, sizeof(buf),
+            "count=%llu p50=%.1fus p90=%.1fus p99=%.1fus p99.9=%.1fus max=%.1fus",
+            (unsigned long long)count_, percentile(50) * 1e6,
+            percentile(90) * 1e6, percentile(99) * 1e6,
+            percentile(99.9) * 1e6, max() * 1e6);
+   return buf;
 }
 
 }
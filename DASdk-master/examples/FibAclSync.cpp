@@ -54,6 +54,8 @@ static const float ACL_UPDATE_TIMER_MAX = 8;
 
 static const std::string AGENT_NAME = "FibAclSync";
 static const uint32_t ACL_SEQ_INCR = 10;
+// The number of FIB routes update_acls() fetches at a time.
+static const size_t ROUTE_BATCH_SIZE = 256;
 static const std::string ROUTE_TYPE_BGP = "bgp";
 static const std::string ROUTE_TYPE_IBGP = "ibgp";
 static const std::string ROUTE_TYPE_EBGP = "ebgp";
@@ -437,6 +439,32 @@ class fib_acl_sync : public DA::agent_handler,
       acl6_seq = ACL_SEQ_INCR;
    }
 
+   void add_acl_rule(DA::fib_route_t const & route,
+                     DA::acl_key_t const & acl4, DA::acl_key_t const & acl6,
+                     bool v4_acl_configured, bool v6_acl_configured) {
+      if (route_types.find(route.route_type()) == route_types.end()) {
+         return;
+      }
+      auto prefix = route.route_key().prefix();
+      auto rule = DA::acl_rule_ip_t();
+      DA::ip_addr_mask_t destination_addr(prefix.network(),
+                                          prefix.prefix_length());
+
+      // Create an ACL rule with the destination matching route prefix.
+      rule.action_is(DA::ACL_PERMIT);
+      rule.destination_addr_is(destination_addr);
+
+      if ((prefix.af() == DA::AF_IPV4) && (v4_acl_configured)) {
+         t.trace3("%s: Adding rule %u", __FUNCTION__, acl4_seq);
+         get_acl_mgr()->acl_rule_set(acl4, acl4_seq, rule);
+         acl4_seq += ACL_SEQ_INCR;
+      } else if ((prefix.af() == DA::AF_IPV6) && (v6_acl_configured)) {
+         t.trace3("%s: Adding rule %u", __FUNCTION__, acl4_seq);
+         get_acl_mgr()->acl_rule_set(acl6, acl6_seq, rule);
+         acl6_seq += ACL_SEQ_INCR;
+      }
+   }
+
    void update_acls() {
       t.trace3( "%s: Processing pending ACL update", __FUNCTION__);
       // Iterate over the fib routes and add permit rules for the routes
@@ -459,27 +487,13 @@ class fib_acl_sync : public DA::agent_handler,
       acl4_seq = ACL_SEQ_INCR;
       acl6_seq = ACL_SEQ_INCR;
 
-      for (auto i = get_fib_mgr()->fib_route_iter(); i; ++i) {
-         if (route_types.find(i->route_type()) != route_types.end()) {
-            auto route_key = i->route_key();
-            auto prefix = route_key.prefix();
-            auto rule = DA::acl_rule_ip_t();
-            DA::ip_addr_mask_t destination_addr(prefix.network(),
-                                            prefix.prefix_length());
-
-            // Create an ACL rule with the destination matching route prefix.
-            rule.action_is(DA::ACL_PERMIT);
-            rule.destination_addr_is(destination_addr);
-
-            if ((prefix.af() == DA::AF_IPV4) && (v4_acl_configured)) {
-               t.trace3("%s: Adding rule %u", __FUNCTION__, acl4_seq);
-               get_acl_mgr()->acl_rule_set(acl4, acl4_seq, rule);
-               acl4_seq += ACL_SEQ_INCR;
-            } else if ((prefix.af() == DA::AF_IPV6) && (v6_acl_configured)) {
-               t.trace3("%s: Adding rule %u", __FUNCTION__, acl4_seq);
-               get_acl_mgr()->acl_rule_set(acl6, acl6_seq, rule);
-               acl6_seq += ACL_SEQ_INCR;
-            }
+      // Fetch the routes a batch at a time rather than one per iteration.
+      DA::fib_route_t routes[ROUTE_BATCH_SIZE];
+      auto i = get_fib_mgr()->fib_route_iter();
+      while (size_t count = i.next_batch(routes, ROUTE_BATCH_SIZE)) {
+         for (size_t j = 0; j < count; ++j) {
+            add_acl_rule(routes[j], acl4, acl6, v4_acl_configured,
+                         v6_acl_configured);
          }
       }
 
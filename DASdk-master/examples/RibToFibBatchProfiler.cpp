@@ -0,0 +1,223 @@
+// Copyright (c) 2015 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/agent.h>
+#include <DA/fib.h>
+#include <DA/ip_route.h>
+#include <DA/sdk.h>
+#include <DA/tracing.h>
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+// Program a bunch of routes, then delete them, and measure how fast the
+// FIB hands them back when they're delivered in batches, once per loop
+// iteration.  RibToFibProfiler measures the same with one call per route,
+// which also tells when the first route made it to the FIB.
+//
+// Make the agent using a 32-bit linux build environment:
+//    bash# g++ -lDA -std=gnu++0x examples/RibToFibBatchProfiler.cpp -o RouteBatchProfiler
+// and run it as RibToFibProfiler, e.g. from the CLI:
+// (conf)# daemon RouteBatchProfiler
+// (conf-daemon-RouteBatchProfiler)# exec /mnt/flash/RouteBatchProfiler
+// (conf-daemon-RouteBatchProfiler)# option num_routes value 100000
+// (conf-daemon-RouteBatchProfiler)# option iter value first
+// (conf-daemon-RouteBatchProfiler)# no shutdown
+
+
+#define DEFAULT_NUM_ROUTES 1000
+
+#define HELP_STR                                                        \
+   "This agent profiles route insertion/deletion with the FIB changes " \
+   "delivered in batches. It can use the following CLI options: \n"     \
+   "- option iter value <name>:\n"                                      \
+   "    run a new iteration \n"                                         \
+   "- option num_routes value <num>:\n"                                 \
+   "    use this number of routes \n"                                   \
+   ""
+
+class RouteBatchProfiler : public DA::agent_handler,
+                           public DA::fib_handler {
+ public:
+   explicit RouteBatchProfiler(DA::sdk & sdk) :
+           DA::agent_handler(sdk.get_agent_mgr()),
+           DA::fib_handler(sdk.get_fib_mgr(DA::MODE_TYPE_READ_NOTIFYING)),
+           phase_(0),
+           phase_done_(true),
+           tag_(42),
+           num_routes_(DEFAULT_NUM_ROUTES),
+           event_num_(0),
+           num_fib_routes_seen_(0),
+           num_batches_seen_(0),
+           t("RouteBatchProfiler") {
+      t.trace0("Constructed agent");
+      agent_mgr = sdk.get_agent_mgr();
+      ip_mgr = sdk.get_ip_route_mgr();
+
+      ip_mgr->tag_is(tag_);
+      route_batches_is(true);
+   }
+
+   void on_initialized() {
+      t.trace0("Initialized agent");
+      reset_statuses();
+      t.trace1("Clearing initial routes");
+      ip_mgr->resync_init();
+      ip_mgr->resync_complete();
+   }
+
+   void on_agent_option(std::string const & key,
+                        std::string const & value) {
+      if (key == "iter") {
+         if (!value.empty()) {
+            run_iteration(value);
+         }
+      } else if (key == "num_routes") {
+         num_routes_ = std::stoi(value);
+      }
+   }
+
+   void on_route_set_batch(DA::fib_route_t const * routes, size_t count) {
+      routes_seen(count, "programmed");
+   }
+
+   void on_route_del_batch(DA::fib_route_key_t const * route_keys,
+                           size_t count) {
+      routes_seen(count, "deleted");
+   }
+
+   // Counts the routes of a batch.  A batch can also carry changes from
+   // outside the profiler, so the count may go past the number of routes
+   // programmed: the phase ends once, on the batch that reaches it.
+   void routes_seen(size_t count, char const * what) {
+      if (phase_done_) {
+         return;
+      }
+      num_fib_routes_seen_ += count;
+      num_batches_seen_++;
+      if (num_fib_routes_seen_ >= num_routes_) {
+         phase_done_ = true;
+         std::chrono::duration<double> elapsed =
+            std::chrono::system_clock::now() - phase_start_time_;
+         std::stringstream event_name;
+         event_name << "All routes " << what << " (" << num_batches_seen_
+                    << " batches, " << std::fixed << std::setprecision(0)
+                    << num_fib_routes_seen_ / elapsed.count() << " routes/sec)";
+         profile(event_name.str());
+         handle_next_phase();
+      }
+   }
+
+   void run_iteration(std::string iteration_name) {
+      reset_statuses();
+      start_time_ = std::chrono::system_clock::now();
+      last_event_time_ = start_time_;
+      event_num_ = 0;
+      phase_ = 0;
+
+      std::stringstream event_name;
+      event_name << "Start " << iteration_name << " (" << num_routes_ << " routes)";
+      profile(event_name.str());
+      handle_next_phase();
+   }
+
+   void handle_next_phase() {
+      t.trace1("Running phase %d", phase_);
+      switch(phase_) {
+       case 0:
+         start_phase();
+         profile("Begin insertion");
+         set_routes();
+         profile("End insertion");
+         break;
+       case 1:
+         start_phase();
+         profile("Begin delete");
+         ip_mgr->resync_init();
+         ip_mgr->resync_complete();
+         profile("End delete");
+         break;
+       default:
+         profile("Done!");
+         break;
+      }
+      phase_++;
+   }
+
+   void start_phase() {
+      phase_start_time_ = std::chrono::system_clock::now();
+      phase_done_ = false;
+      num_fib_routes_seen_ = 0;
+      num_batches_seen_ = 0;
+   }
+
+   void set_routes() {
+      t.trace1("Starting to insert %d routes", num_routes_);
+      for(DA::uint32_be_t i = 0; i < num_routes_; i++) {
+         // Create a unique IP prefix:
+         DA::uint32_be_t addr_num = i;
+         addr_num = addr_num << 8;
+         addr_num = addr_num ^ (DA::uint32_be_t)200;
+         DA::ip_prefix_t prefix(DA::ip_addr_t(addr_num), 24);
+
+         DA::ip_route_key_t rkey(prefix);
+         DA::ip_route_t route(rkey);
+         route.tag_is(tag_);
+         DA::ip_route_via_t via(rkey);
+         via.hop_is(DA::ip_addr_t("0.0.0.0"));
+         via.intf_is(DA::intf_id_t("Ethernet3"));
+         ip_mgr->ip_route_set(route, DA::IP_ROUTE_ACTION_FORWARD);
+         ip_mgr->ip_route_via_set(via);
+      }
+      t.trace1("Finished inserting %d routes", num_routes_);
+   }
+
+   void reset_statuses() {
+      for (auto i = agent_mgr->status_iter(); i; i++) {
+         agent_mgr->status_del(*i);
+      }
+      agent_mgr->status_set("help", HELP_STR);
+   }
+
+   void profile(std::string event) {
+      auto now = std::chrono::system_clock::now();
+      t.trace1("Profiling event %s", event.c_str());
+
+      std::stringstream status_key;
+      status_key << std::setfill('0') << std::setw(2) << event_num_ << " " << event;
+
+      std::chrono::duration<double> time_since_start = now - start_time_;
+      std::chrono::duration<double> time_since_last = now - last_event_time_;
+      std::stringstream status_value;
+      status_value << "Since start: " << time_since_start.count() << " sec";
+      status_value << "\n      last event: " << time_since_last.count() << " sec";
+
+      agent_mgr->status_set(status_key.str(), status_value.str());
+      last_event_time_ = std::chrono::system_clock::now();
+      event_num_++;
+   }
+
+ private:
+   uint32_t phase_;
+   bool phase_done_;
+   uint32_t tag_;
+   uint32_t num_routes_;
+   uint32_t event_num_;
+   std::chrono::time_point<std::chrono::system_clock> start_time_;
+   std::chrono::time_point<std::chrono::system_clock> last_event_time_;
+   std::chrono::time_point<std::chrono::system_clock> phase_start_time_;
+
+   size_t num_fib_routes_seen_;
+   uint32_t num_batches_seen_;
+
+   DA::tracer t;
+   DA::agent_mgr * agent_mgr;
+   DA::ip_route_mgr * ip_mgr;
+};
+
+int main(int argc, char ** argv) {
+   DA::sdk sdk;
+   RouteBatchProfiler ex(sdk);
+   sdk.main_loop(argc, argv);
+}
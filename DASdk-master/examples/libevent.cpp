@@ -1,12 +1,24 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
-#include <cassert>
-
 #include <event2/event.h>
 
 #include "libevent.h"
 
+libevent_loop::~libevent_loop() {
+   for(auto i = fds_.begin(); i != fds_.end(); i++) {
+      if(i->second.read) {
+         event_free(i->second.read);
+      }
+      if(i->second.write) {
+         event_free(i->second.write);
+      }
+   }
+   if(timer_) {
+      event_free(timer_);
+   }
+}
+
 void
 libevent_loop::init() {
    loop_->wait_for_initialized();
@@ -14,14 +26,62 @@ libevent_loop::init() {
 }
 
 static void cb_read(evutil_socket_t fd, short /*what*/, void *arg) {
-   ((libevent_loop*) arg)->on_readable(fd);
+   ((libevent_loop*) arg)->on_read_event(fd);
+}
+
+void
+libevent_loop::on_read_event(int fd) {
+   // The read event stands for both reads and exceptions, so tell the SDK
+   // about whichever of the two it asked for.
+   auto i = fds_.find(fd);
+   if(i == fds_.end()) {
+      return;
+   }
+   if(i->second.want_read) {
+      on_readable(fd);
+   } else if(i->second.want_except) {
+      on_exception(fd);
+   }
+}
+
+void
+libevent_loop::maybe_free_events(int fd) {
+   auto i = fds_.find(fd);
+   if(i == fds_.end() || i->second.want_read || i->second.want_write
+      || i->second.want_except) {
+      return;
+   }
+   if(i->second.read) {
+      event_free(i->second.read);
+   }
+   if(i->second.write) {
+      event_free(i->second.write);
+   }
+   fds_.erase(i);
+}
+
+void
+libevent_loop::update_read_event(int fd, fd_events & events) {
+   bool interested = events.want_read || events.want_except;
+   if(!events.read) {
+      if(!interested) {
+         return;
+      }
+      events.read = event_new(eb_, fd, EV_READ|EV_PERSIST, cb_read, this);
+   }
+   if(interested) {
+      event_add(events.read, NULL);
+   } else {
+      event_del(events.read);
+   }
 }
 
 void
 libevent_loop::watch_readable(int fd, bool interested) {
-   assert(interested);  // TODO: support unregistering an fd.
-   struct event * ev = event_new(eb_, fd, EV_READ|EV_PERSIST, cb_read, this);
-   event_add(ev, NULL);
+   fd_events & events = fds_[fd];
+   events.want_read = interested;
+   update_read_event(fd, events);
+   maybe_free_events(fd);
 }
 
 static void cb_write(evutil_socket_t fd, short /*what*/, void *arg) {
@@ -30,17 +90,30 @@ static void cb_write(evutil_socket_t fd, short /*what*/, void *arg) {
 
 void
 libevent_loop::watch_writable(int fd, bool interested) {
-   assert(interested);  // TODO: support unregistering an fd.
-   struct event * ev = event_new(eb_, fd, EV_WRITE|EV_PERSIST, cb_write, this);
-   event_add(ev, NULL);
+   fd_events & events = fds_[fd];
+   events.want_write = interested;
+   if(!events.write) {
+      if(interested) {
+         events.write = event_new(eb_, fd, EV_WRITE|EV_PERSIST, cb_write, this);
+         event_add(events.write, NULL);
+      }
+   } else if(interested) {
+      event_add(events.write, NULL);
+   } else {
+      event_del(events.write);
+   }
+   maybe_free_events(fd);
 }
 
 void
 libevent_loop::watch_exception(int fd, bool interested) {
    // libevent doesn't allow watching just for "exceptions".  Rather when a
-   // connection is closed, we'll be notified the fd is "readable" and we'll
-   // read EOF.
-   watch_readable(fd, interested);
+   // connection is closed, the read event fires, and on_read_event() reports
+   // it as an exception if that's all the SDK is watching for.
+   fd_events & events = fds_[fd];
+   events.want_except = interested;
+   update_read_event(fd, events);
+   maybe_free_events(fd);
 }
 
 static void cb_timer(evutil_socket_t fd, short /*what*/, void *arg) {
@@ -49,6 +122,9 @@ static void cb_timer(evutil_socket_t fd, short /*what*/, void *arg) {
 
 void
 libevent_loop::timeout_time_is(struct timeval deadline) {
-   struct event * ev = evtimer_new(eb_, cb_timer, this);
-   event_add(ev, &deadline);
+   if(!timer_) {
+      timer_ = evtimer_new(eb_, cb_timer, this);
+   }
+   // Re-adding a pending event reschedules it.
+   event_add(timer_, &deadline);
 }
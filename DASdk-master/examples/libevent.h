@@ -6,19 +6,21 @@
 
 #include <sys/time.h>
 
+#include <map>
+
 #include <DA/event_loop.h>
 #include <DA/sdk.h>
 
+struct event;  // Forward declare libevent's event structure.
 struct event_base;  // Forward declare libevent's main data structure.
 
 class libevent_loop : public DA::event_loop_handler {
  public:
    libevent_loop(DA::sdk & sdk, event_base * eb)
-      : eb_(eb), loop_(sdk.get_event_loop()) {
+      : eb_(eb), loop_(sdk.get_event_loop()), timer_(0) {
    }
 
-   virtual ~libevent_loop() {
-   }
+   virtual ~libevent_loop();
 
    void init();
    virtual void watch_readable(int fd, bool interested);
@@ -26,9 +28,31 @@ class libevent_loop : public DA::event_loop_handler {
    virtual void watch_exception(int fd, bool interested);
    virtual void timeout_time_is(struct timeval deadline);
 
+   /// Called by libevent when the read event of `fd' fires.
+   void on_read_event(int fd);
+
  private:
+   /// The libevent events we created for a given fd, reused across calls.
+   struct fd_events {
+      fd_events() : read(0), write(0), want_read(false), want_write(false),
+                    want_except(false) {
+      }
+      struct event * read;
+      struct event * write;
+      bool want_read;
+      bool want_write;
+      bool want_except;
+   };
+
+   /// (Un)registers the read event, needed for both reads and exceptions.
+   void update_read_event(int fd, fd_events & events);
+   /// Frees the events of `fd' once nothing is watched on it anymore.
+   void maybe_free_events(int fd);
+
    event_base * const eb_;
    DA::event_loop * loop_;
+   std::map<int, fd_events> fds_;
+   struct event * timer_;
 };
 
 #endif // EXAMPLES_LIBEVENT_H
@@ -0,0 +1,92 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/event_loop.h>
+#include <DA/exception.h>
+#include <DA/sdk.h>
+#include <DA/timer.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <time.h>
+
+// Times now() on each clock source, and loop_now() from a handler, then
+// checks that the TSC clock follows CLOCK_MONOTONIC: it is sampled for a
+// while and must never go backwards nor drift away.
+//
+//    bash# ClockBenchmark [calls] [seconds of drift check]
+
+static double calls_per_second(DA::seconds_t (*clock)(), int calls) {
+   double sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < calls; ++i) {
+      sum += clock();
+   }
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   if (sum < 0) {
+      printf("negative time\n");
+   }
+   return calls / elapsed.count();
+}
+
+static double monotonic() {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char ** argv) {
+   int calls = argc > 1 ? atoi(argv[1]) : 10000000;
+   double check_seconds = argc > 2 ? atof(argv[2]) : 1;
+   DA::sdk sdk;
+   DA::event_loop * loop = sdk.get_event_loop();
+
+   printf("now() on CLOCK_MONOTONIC: %5.1fM calls/s\n",
+          calls_per_second(DA::now, calls) / 1e6);
+
+   double loop_rate = 0;
+   loop->post(0, [&loop_rate, calls]() {
+      loop_rate = calls_per_second(DA::loop_now, calls);
+   });
+   loop->run(0);
+   printf("loop_now() in the loop:   %5.1fM calls/s\n", loop_rate / 1e6);
+
+   try {
+      DA::clock_source_is(DA::CLOCK_SOURCE_TSC);
+   } catch (DA::unsupported_error const & e) {
+      printf("no TSC clock on this machine\n");
+      return 0;
+   }
+   printf("now() on the TSC:         %5.1fM calls/s\n",
+          calls_per_second(DA::now, calls) / 1e6);
+
+   // Each TSC reading is compared with the CLOCK_MONOTONIC readings taken
+   // right before and after it, so being preempted in between isn't
+   // counted as drift.
+   double last = DA::now();
+   double max_drift = 0;
+   double end = monotonic() + check_seconds;
+   for (double before = monotonic(); before < end; before = monotonic()) {
+      double tsc = DA::now();
+      double after = monotonic();
+      if (tsc < last) {
+         printf("the TSC clock went backwards by %g s\n", last - tsc);
+         return 1;
+      }
+      last = tsc;
+      double drift = 0;
+      if (tsc < before) {
+         drift = before - tsc;
+      } else if (tsc > after) {
+         drift = tsc - after;
+      }
+      if (drift > max_drift) {
+         max_drift = drift;
+      }
+   }
+   printf("TSC drift from CLOCK_MONOTONIC over %gs: %.2f us at most\n",
+          check_seconds, max_drift * 1e6);
+   return 0;
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/event_loop.h>
+#include <DA/fib.h>
+#include <DA/sdk.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+
+// Flaps a set of routes many times within one loop iteration, and times
+// how long the FIB takes to hand the changes to a handler that gets them
+// one route at a time, in batches, or conflated.  The handler either just
+// counts the routes, or mirrors them into a table of its own, as an agent
+// programming them somewhere else would.
+//
+//    bash# ConflationBenchmark [routes] [flaps]
+
+enum delivery_mode_t {
+   PER_ROUTE,
+   BATCHED,
+   CONFLATED,
+};
+
+static char const * mode_names[] = { "per route", "batched", "conflated" };
+
+struct route_key_hash {
+   size_t operator()(DA::fib_route_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+class route_mirror : public DA::fib_handler {
+ public:
+   route_mirror(DA::fib_mgr * mgr, delivery_mode_t mode, bool mirror) :
+         DA::fib_handler(mgr), mirror_(mirror), calls_(0) {
+      route_batches_is(mode == BATCHED);
+      route_conflation_is(mode == CONFLATED);
+   }
+
+   void on_route_set(DA::fib_route_t const & route) {
+      calls_++;
+      if (mirror_) {
+         routes_[route.route_key()] = route;
+      }
+   }
+
+   void on_route_del(DA::fib_route_key_t const & route_key) {
+      calls_++;
+      if (mirror_) {
+         routes_.erase(route_key);
+      }
+   }
+
+   size_t calls() const {
+      return calls_;
+   }
+
+ private:
+   bool mirror_;
+   size_t calls_;
+   std::unordered_map<DA::fib_route_key_t, DA::fib_route_t, route_key_hash> routes_;
+};
+
+static DA::fib_route_key_t route_key(uint32_t i) {
+   return DA::fib_route_key_t(
+      DA::ip_prefix_t(DA::ip_addr_t(DA::uint32_be_t(i << 8)), 24));
+}
+
+int main(int argc, char ** argv) {
+   uint32_t num_routes = argc > 1 ? atoi(argv[1]) : 10000;
+   uint32_t flaps = argc > 2 ? atoi(argv[2]) : 50;
+   DA::sdk sdk;
+   DA::fib_mgr * fib_mgr = sdk.get_fib_mgr();
+   DA::event_loop * loop = sdk.get_event_loop();
+
+   printf("%u routes, %u flaps\n", num_routes, flaps);
+   for (int mirror = 0; mirror < 2; ++mirror) {
+      for (int mode = PER_ROUTE; mode <= CONFLATED; ++mode) {
+         route_mirror handler(fib_mgr, delivery_mode_t(mode), mirror);
+         auto start = std::chrono::steady_clock::now();
+         for (uint32_t flap = 0; flap < flaps; ++flap) {
+            for (uint32_t i = 0; i < num_routes; ++i) {
+               DA::fib_route_t route(route_key(i));
+               route.fec_id_is(flap);
+               fib_mgr->fib_route_set(route);
+            }
+            if (flap != flaps - 1) {
+               for (uint32_t i = 0; i < num_routes; ++i) {
+                  fib_mgr->fib_route_del(route_key(i));
+               }
+            }
+         }
+         loop->run(0);
+         std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+         printf("%-9s %-9s %8zu calls %8lu conflated %8.1f ms\n",
+                mirror ? "mirror" : "count", mode_names[mode], handler.calls(),
+                (unsigned long)handler.route_changes_conflated(), elapsed.count());
+         for (uint32_t i = 0; i < num_routes; ++i) {
+            fib_mgr->fib_route_del(route_key(i));
+         }
+         loop->run(0);
+      }
+   }
+}
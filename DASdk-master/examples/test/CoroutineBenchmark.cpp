@@ -0,0 +1,207 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/coroutine.h>
+#include <DA/event_loop.h>
+#include <DA/fd.h>
+#include <DA/fib.h>
+#include <DA/sdk.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "alloc_count.h"
+
+// Bounces a byte back and forth over a socketpair, once with two
+// coroutines awaiting readable(), and once with two fd_handlers, and
+// reports the time and the allocations per round trip.  Then has tasks
+// wait for routes, and times setting the routes they wait for.  Needs
+// C++20, so it's only built when configure finds a compiler that has
+// coroutines:
+//
+//    bash# CoroutineBenchmark [round trips] [routes]
+
+static int round_trips;
+static int done;
+
+static void bounce(int fd) {
+   char c;
+   if (read(fd, &c, 1) != 1 || write(fd, &c, 1) != 1) {
+      perror("bounce");
+      exit(1);
+   }
+}
+
+DA::task ping(int fd) {
+   char c = 'x';
+   for (int i = 0; i < round_trips; ++i) {
+      if (write(fd, &c, 1) != 1) {
+         perror("write");
+         exit(1);
+      }
+      co_await DA::readable(fd);
+      if (read(fd, &c, 1) != 1) {
+         perror("read");
+         exit(1);
+      }
+   }
+   done++;
+}
+
+DA::task pong(int fd) {
+   for (int i = 0; i < round_trips; ++i) {
+      co_await DA::readable(fd);
+      bounce(fd);
+   }
+   done++;
+}
+
+class ping_handler : public DA::fd_handler {
+ public:
+   explicit ping_handler(int fd) : fd_(fd), left_(round_trips) {
+      watch_readable(fd_, true);
+      send();
+   }
+
+   void on_readable(int fd) {
+      char c;
+      if (read(fd, &c, 1) != 1) {
+         perror("read");
+         exit(1);
+      }
+      if (--left_) {
+         send();
+      } else {
+         watch_readable(fd_, false);
+         done++;
+      }
+   }
+
+ private:
+   void send() {
+      if (write(fd_, "x", 1) != 1) {
+         perror("write");
+         exit(1);
+      }
+   }
+
+   int fd_;
+   int left_;
+};
+
+class pong_handler : public DA::fd_handler {
+ public:
+   explicit pong_handler(int fd) : fd_(fd), left_(round_trips) {
+      watch_readable(fd_, true);
+   }
+
+   void on_readable(int fd) {
+      bounce(fd);
+      if (!--left_) {
+         watch_readable(fd_, false);
+         done++;
+      }
+   }
+
+ private:
+   int fd_;
+   int left_;
+};
+
+static int routes_seen;
+
+DA::task wait_route(DA::fib_mgr * mgr, DA::fib_route_key_t key) {
+   co_await DA::fib_route_seen(mgr, key);
+   routes_seen++;
+}
+
+static DA::fib_route_key_t route_key(uint32_t i) {
+   return DA::fib_route_key_t(
+      DA::ip_prefix_t(DA::ip_addr_t(DA::uint32_be_t(htonl(i << 8))), 24));
+}
+
+// Has a task wait for each of `count' routes, then sets them, and then
+// has tasks await the routes that are now there.
+static void measure_routes(DA::fib_mgr * mgr, uint32_t count) {
+   for (uint32_t i = 0; i < count; ++i) {
+      mgr->fib_route_del(route_key(i));
+   }
+   routes_seen = 0;
+   for (uint32_t i = 0; i < count; ++i) {
+      wait_route(mgr, route_key(i));
+   }
+   auto begin = std::chrono::steady_clock::now();
+   for (uint32_t i = 0; i < count; ++i) {
+      mgr->fib_route_set(DA::fib_route_t(route_key(i)));
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - begin;
+   if (routes_seen != int(count)) {
+      printf("%d of %u routes seen\n", routes_seen, count);
+      exit(1);
+   }
+   printf("%u routes waited for: %.1f ns per route set\n", count,
+          elapsed.count() / count);
+
+   // The frames are allocated, but the waits shouldn't be.
+   begin = std::chrono::steady_clock::now();
+   size_t allocations_before = allocations;
+   for (uint32_t i = 0; i < count; ++i) {
+      wait_route(mgr, route_key(i));
+   }
+   elapsed = std::chrono::steady_clock::now() - begin;
+   printf("%u routes already set: %.1f ns and %.2f allocations per task\n",
+          count, elapsed.count() / count,
+          double(allocations - allocations_before) / count);
+}
+
+template <typename Start>
+static void measure(char const * what, DA::event_loop * loop, Start start) {
+   int fds[2];
+   if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds)) {
+      perror("socketpair");
+      exit(1);
+   }
+   done = 0;
+   auto begin = std::chrono::steady_clock::now();
+   size_t allocations_before = allocations;
+   start(fds[0], fds[1], [&]() {
+      while (done < 2) {
+         loop->run(0);
+      }
+   });
+   std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - begin;
+   printf("%-10s %d round trips: %.2f us and %.2f allocations each\n",
+          what, round_trips, elapsed.count() / round_trips,
+          double(allocations - allocations_before) / round_trips);
+   close(fds[0]);
+   close(fds[1]);
+}
+
+int main(int argc, char ** argv) {
+   round_trips = argc > 1 ? atoi(argv[1]) : 200000;
+   uint32_t routes = argc > 2 ? atoi(argv[2]) : 10000;
+   DA::sdk sdk;
+   DA::event_loop * loop = sdk.get_event_loop();
+   DA::fib_mgr * fib_mgr = sdk.get_fib_mgr();
+
+   for (int repeat = 0; repeat < 2; ++repeat) {
+      measure("coroutine", loop, [](int a, int b, auto run) {
+         pong(b);
+         ping(a);
+         run();
+      });
+      measure("fd_handler", loop, [](int a, int b, auto run) {
+         pong_handler pong(b);
+         ping_handler ping(a);
+         run();
+      });
+      measure_routes(fib_mgr, routes);
+   }
+   return 0;
+}
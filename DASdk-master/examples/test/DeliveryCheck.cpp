@@ -0,0 +1,143 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/event_loop.h>
+#include <DA/fib.h>
+#include <DA/sdk.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+// Sets and deletes random routes over many loop iterations, with handlers
+// that turn route_batches() and route_conflation() on and off at random:
+// between changes, and from their own handlers, so also while a change is
+// being notified or a batch delivered.  Checks that after each iteration,
+// every handler's copy of the routes matches the FIB, and that the handlers
+// that never conflate got every change once, in order.  Exits with 1 on the
+// first mismatch.
+//
+//    bash# DeliveryCheck [iterations] [seed]
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+static uint32_t const num_routes = 32;
+
+static DA::fib_route_key_t route_key(uint32_t i) {
+   return DA::fib_route_key_t(
+      DA::ip_prefix_t(DA::ip_addr_t(DA::uint32_be_t((i + 1) << 8)), 24));
+}
+
+// The changes to one route, as the FEC IDs it was set with, and 0 for
+// deletes.
+typedef std::map<uint32_t, std::vector<uint64_t> > change_log;
+
+static std::vector<class route_copy *> handlers;
+
+class route_copy : public DA::fib_handler {
+ public:
+   route_copy(DA::fib_mgr * mgr, bool conflates) :
+         DA::fib_handler(mgr), conflates_(conflates) {
+   }
+
+   void on_route_set(DA::fib_route_t const & route) {
+      uint32_t i = route.route_key().prefix().network().addr_v4() >> 8;
+      routes_[i - 1] = route.fec_id();
+      changes_[i - 1].push_back(route.fec_id());
+      maybe_switch();
+   }
+
+   void on_route_del(DA::fib_route_key_t const & route_key) {
+      uint32_t i = route_key.prefix().network().addr_v4() >> 8;
+      routes_.erase(i - 1);
+      changes_[i - 1].push_back(0);
+      maybe_switch();
+   }
+
+   // Has a random handler switch how it gets the changes, sometimes.
+   static void maybe_switch() {
+      if (random_below(8) == 0) {
+         handlers[random_below(handlers.size())]->switch_delivery();
+      }
+   }
+
+   void switch_delivery() {
+      route_batches_is(random_below(2));
+      if (conflates_) {
+         route_conflation_is(random_below(2));
+      }
+   }
+
+   bool conflates() const {
+      return conflates_;
+   }
+   std::map<uint32_t, uint64_t> const & routes() const {
+      return routes_;
+   }
+   change_log const & changes() const {
+      return changes_;
+   }
+
+ private:
+   bool conflates_;
+   std::map<uint32_t, uint64_t> routes_;
+   change_log changes_;
+};
+
+int main(int argc, char ** argv) {
+   int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 1);
+   DA::sdk sdk;
+   DA::fib_mgr * fib_mgr = sdk.get_fib_mgr();
+   DA::event_loop * loop = sdk.get_event_loop();
+
+   for (int i = 0; i < 6; ++i) {
+      handlers.push_back(new route_copy(fib_mgr, i % 2));
+   }
+   std::map<uint32_t, uint64_t> routes;
+   change_log changes;
+   uint64_t fec_id = 0;
+   for (int iteration = 0; iteration < iterations; ++iteration) {
+      uint32_t count = random_below(64);
+      for (uint32_t change = 0; change < count; ++change) {
+         uint32_t i = random_below(num_routes);
+         if (random_below(3)) {
+            DA::fib_route_t route(route_key(i));
+            route.fec_id_is(++fec_id);
+            routes[i] = fec_id;
+            changes[i].push_back(fec_id);
+            fib_mgr->fib_route_set(route);
+         } else if (routes.erase(i)) {
+            changes[i].push_back(0);
+            fib_mgr->fib_route_del(route_key(i));
+         }
+         route_copy::maybe_switch();
+      }
+      loop->run(0);
+      for (size_t h = 0; h < handlers.size(); ++h) {
+         route_copy const * handler = handlers[h];
+         if (handler->routes() != routes) {
+            printf("Iteration %d: handler %zu has %zu routes, the FIB %zu\n",
+                   iteration, h, handler->routes().size(), routes.size());
+            return 1;
+         }
+         if (!handler->conflates() && handler->changes() != changes) {
+            printf("Iteration %d: handler %zu missed or repeated changes\n",
+                   iteration, h);
+            return 1;
+         }
+      }
+   }
+   for (size_t h = 0; h < handlers.size(); ++h) {
+      delete handlers[h];
+   }
+   printf("%d iterations, %lu changes: OK\n", iterations,
+          (unsigned long)fec_id);
+   return 0;
+}
@@ -0,0 +1,246 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/eth.h>
+#include <DA/mac_table.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Checks that parse_eth_addr() reads random addresses written in each
+// format, and agrees with a reference parser on randomly edited ones, and
+// that to_string() writes what it parsed.  Then times parsing and
+// formatting, and sorting and looking up random mac_key_t.  Exits with 1
+// on the first mismatch.
+//
+//    bash# EthAddrCheck [addresses] [seed] [time]
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+static void random_bytes(uint8_t * bytes) {
+   for (int i = 0; i < 6; ++i) {
+      // Some zero bytes, which can be written as shorter groups.
+      bytes[i] = random_below(4) ? random_gen() : random_below(16);
+   }
+}
+
+static std::string format(uint8_t const * bytes) {
+   std::string s;
+   char buf[8];
+   bool upper = random_below(2);
+   bool shorten = random_below(2);
+   switch (random_below(4)) {
+    case 0:
+    case 1: {
+      char separator = random_below(2) ? ':' : '-';
+      for (int i = 0; i < 6; ++i) {
+         snprintf(buf, sizeof(buf), shorten ? (upper ? "%X" : "%x")
+                                            : (upper ? "%02X" : "%02x"),
+                  bytes[i]);
+         s += (i ? std::string(1, separator) : "") + buf;
+      }
+      break;
+    }
+    case 2:
+      for (int i = 0; i < 3; ++i) {
+         snprintf(buf, sizeof(buf), shorten ? (upper ? "%X" : "%x")
+                                            : (upper ? "%04X" : "%04x"),
+                  bytes[2 * i] << 8 | bytes[2 * i + 1]);
+         s += (i ? "." : "") + std::string(buf);
+      }
+      break;
+    default:
+      for (int i = 0; i < 6; ++i) {
+         snprintf(buf, sizeof(buf), upper ? "%02X" : "%02x", bytes[i]);
+         s += buf;
+      }
+      break;
+   }
+   return s;
+}
+
+static std::string mutate(std::string s) {
+   static char const chars[] = "0123456789abcdefABCDEFgx:-. ";
+   int edits = 1 + random_below(2);
+   for (int i = 0; i < edits && !s.empty(); ++i) {
+      size_t pos = random_below(s.size());
+      char c = chars[random_below(sizeof(chars) - 1)];
+      switch (random_below(3)) {
+       case 0:
+         s[pos] = c;
+         break;
+       case 1:
+         s.insert(pos, 1, c);
+         break;
+       default:
+         s.erase(pos, 1);
+         break;
+      }
+   }
+   return s;
+}
+
+// Splits the address on its first separator, and requires the number of
+// groups and digits of that format.
+static bool reference_parse(std::string const & s, uint8_t * bytes) {
+   size_t first = s.find_first_of(":-.");
+   char separator = first == std::string::npos ? 0 : s[first];
+   size_t groups = separator == '.' ? 3 : separator ? 6 : 1;
+   size_t max_digits = 12 / groups;
+   std::vector<std::string> parts;
+   size_t start = 0;
+   for (;;) {
+      size_t next = separator ? s.find(separator, start) : std::string::npos;
+      parts.push_back(s.substr(start, next - start));
+      if (next == std::string::npos) {
+         break;
+      }
+      start = next + 1;
+   }
+   if (parts.size() != groups) {
+      return false;
+   }
+   uint64_t value = 0;
+   for (auto part = parts.begin(); part != parts.end(); ++part) {
+      if (part->empty() || part->size() > max_digits ||
+          (!separator && part->size() != max_digits) ||
+          part->find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) {
+         return false;
+      }
+      value = value << (48 / groups) | strtoull(part->c_str(), 0, 16);
+   }
+   for (int i = 5; i >= 0; --i) {
+      bytes[i] = uint8_t(value);
+      value >>= 8;
+   }
+   return true;
+}
+
+static bool check(std::string const & s) {
+   uint8_t bytes[6];
+   bool valid = reference_parse(s, bytes);
+   DA::eth_addr_t addr;
+   if (DA::parse_eth_addr(s.c_str(), &addr) != valid ||
+       (valid && !(addr == DA::eth_addr_t(bytes)))) {
+      printf("\"%s\": expected %s\n", s.c_str(), valid ? "valid" : "invalid");
+      return false;
+   }
+   char expected[18];
+   snprintf(expected, sizeof(expected), "%02x:%02x:%02x:%02x:%02x:%02x",
+            bytes[0], bytes[1], bytes[2], bytes[3], bytes[4], bytes[5]);
+   if (valid && addr.to_string() != expected) {
+      printf("\"%s\" is written as %s\n", s.c_str(), addr.to_string().c_str());
+      return false;
+   }
+   return true;
+}
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start,
+                         size_t count) {
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   return elapsed.count() / count;
+}
+
+static void time_addresses(size_t count) {
+   std::vector<std::string> strings;
+   uint8_t bytes[6];
+   for (size_t i = 0; i < count; ++i) {
+      random_bytes(bytes);
+      strings.push_back(format(bytes));
+   }
+   std::vector<DA::eth_addr_t> addrs(count);
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < count; ++i) {
+      DA::parse_eth_addr(strings[i].data(), strings[i].size(), &addrs[i]);
+   }
+   printf("parse:  %6.1f ns per address\n", elapsed_ns(start, count));
+   char buf[32];
+   size_t chars = 0;
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < count; ++i) {
+      chars += addrs[i].to_chars(buf, buf + sizeof(buf)) - buf;
+   }
+   printf("format: %6.1f ns per address (%zu)\n", elapsed_ns(start, count),
+          chars % 10);
+}
+
+struct mac_key_hash {
+   size_t operator()(DA::mac_key_t const & key) const {
+      return key.hash();
+   }
+};
+
+static void time_mac_keys(size_t count) {
+   std::vector<DA::mac_key_t> keys;
+   uint8_t bytes[6];
+   for (size_t i = 0; i < count; ++i) {
+      random_bytes(bytes);
+      keys.push_back(DA::mac_key_t(1 + random_below(4094), DA::eth_addr_t(bytes)));
+   }
+   std::vector<DA::mac_key_t> sorted(keys);
+   auto start = std::chrono::steady_clock::now();
+   std::sort(sorted.begin(), sorted.end());
+   std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+   printf("std::sort of %zu mac_key_t: %.0f ms\n", count, elapsed.count());
+
+   std::map<DA::mac_key_t, int> map;
+   std::unordered_map<DA::mac_key_t, int, mac_key_hash> hash_map;
+   for (size_t i = 0; i < count; ++i) {
+      map[keys[i]] = i;
+      hash_map[keys[i]] = i;
+   }
+   size_t found = 0;
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < count; ++i) {
+      found += map.count(keys[(i * 7919) % count]);
+   }
+   printf("std::map lookup:           %6.0f ns\n", elapsed_ns(start, count));
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < count; ++i) {
+      found += hash_map.count(keys[(i * 7919) % count]);
+   }
+   printf("std::unordered_map lookup: %6.0f ns\n", elapsed_ns(start, count));
+   if (found != 2 * count) {
+      printf("lost keys\n");
+   }
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 200000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 42);
+
+   size_t valid = 0;
+   for (size_t i = 0; i < count; ++i) {
+      uint8_t bytes[6];
+      random_bytes(bytes);
+      std::string s = format(bytes);
+      if (random_below(2)) {
+         s = mutate(s);
+      }
+      if (!check(s)) {
+         return 1;
+      }
+      valid += reference_parse(s, bytes);
+   }
+   printf("%zu addresses, %zu valid: no mismatch\n", count, valid);
+
+   if (argc > 3) {
+      time_addresses(1000000);
+      time_mac_keys(1000000);
+   }
+   return 0;
+}
@@ -0,0 +1,130 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/base_handler.h>
+#include <DA/base_mgr.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// Registers many handlers with a manager and times how long it takes to
+// notify them, for handlers watching everything and for handlers watching
+// a single key, and how long it takes to add and remove a handler.  This
+// times base_mgr itself, which all the managers notify their handlers
+// through, so it defines a manager of its own.
+//
+//    bash# HandlerBenchmark [handlers] [keys]
+
+class bench_handler;
+
+class bench_mgr : public DA::base_mgr<bench_handler, uint32_t> {
+ public:
+   void notify_all();
+   void notify(uint32_t key);
+
+ private:
+   friend class bench_handler;
+};
+
+class bench_handler : public DA::base_handler<bench_mgr, bench_handler> {
+ public:
+   explicit bench_handler(bench_mgr * mgr) :
+         DA::base_handler<bench_mgr, bench_handler>(mgr), notified_(0) {
+   }
+
+   void watch_all(bool all) {
+      if (all) {
+         mgr_->add_handler(this);
+      } else {
+         mgr_->remove_handler(this);
+      }
+   }
+
+   void watch(uint32_t key, bool interest) {
+      if (interest) {
+         mgr_->add_handler(key, this);
+      } else {
+         mgr_->remove_handler(key, this);
+      }
+   }
+
+   virtual void on_notified() {
+      notified_++;
+   }
+
+ private:
+   size_t notified_;
+};
+
+void bench_mgr::notify_all() {
+   handler_foreach([](bench_handler * handler) {
+      handler->on_notified();
+   });
+}
+
+void bench_mgr::notify(uint32_t key) {
+   handler_foreach(key, [](bench_handler * handler) {
+      handler->on_notified();
+   });
+}
+
+static double elapsed_us(std::chrono::steady_clock::time_point start) {
+   std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - start;
+   return elapsed.count();
+}
+
+static void fan_out(size_t count) {
+   bench_mgr mgr;
+   std::vector<std::unique_ptr<bench_handler>> handlers;
+   for (size_t i = 0; i < count; ++i) {
+      handlers.emplace_back(new bench_handler(&mgr));
+      handlers.back()->watch_all(true);
+   }
+   int notifications = 1000;
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < notifications; ++i) {
+      mgr.notify_all();
+   }
+   printf("fan-out to %6zu handlers:           %8.2f us per notification\n",
+          count, elapsed_us(start) / notifications);
+   handlers.clear();
+}
+
+int main(int argc, char ** argv) {
+   size_t num_handlers = argc > 1 ? atoi(argv[1]) : 100000;
+   uint32_t num_keys = argc > 2 ? atoi(argv[2]) : 1000;
+
+   fan_out(num_handlers / 10);
+   fan_out(num_handlers);
+
+   // Each key is watched by num_handlers / num_keys handlers.
+   bench_mgr mgr;
+   std::vector<std::unique_ptr<bench_handler>> handlers;
+   for (size_t i = 0; i < num_handlers; ++i) {
+      handlers.emplace_back(new bench_handler(&mgr));
+      handlers.back()->watch(i % num_keys, true);
+   }
+   int notifications = 100000;
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < notifications; ++i) {
+      mgr.notify(i % num_keys);
+   }
+   printf("%6zu handlers over %5u keys:      %8.2f us per notification\n",
+          num_handlers, num_keys, elapsed_us(start) / notifications);
+
+   int toggles = 1000000;
+   start = std::chrono::steady_clock::now();
+   for (int i = 0; i < toggles; ++i) {
+      bench_handler * handler = handlers[i % num_handlers].get();
+      handler->watch_all(true);
+      handler->watch_all(false);
+   }
+   printf("add and remove among %6zu handlers: %8.0f ns\n",
+          num_handlers, elapsed_us(start) * 1000 / toggles);
+   handlers.clear();
+   return 0;
+}
@@ -0,0 +1,183 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/intf.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "alloc_count.h"
+
+// Checks that intf_id_t round-trips random interface names, both the ones
+// parsed into the id and the interned ones, that equal names give equal
+// ids and different names different ids, and that the type and
+// subinterface bits match the name.  Then times converting a mix of names
+// both ways, and counts the allocations.  Exits with 1 on the first
+// mismatch.
+//
+//    bash# IntfNameCheck [names] [seed]
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+// The types' names, in the order the parser tries them.
+static struct {
+   char const * name;
+   DA::intf_type_t type;
+} const types[] = {
+   { "Ethernet", DA::INTF_TYPE_ETH },
+   { "Vlan", DA::INTF_TYPE_VLAN },
+   { "Management", DA::INTF_TYPE_MANAGEMENT },
+   { "Loopback", DA::INTF_TYPE_LOOPBACK },
+   { "Port-Channel", DA::INTF_TYPE_LAG },
+   { "Null", DA::INTF_TYPE_NULL0 },
+   { "Cpu", DA::INTF_TYPE_CPU },
+   { "Vxlan", DA::INTF_TYPE_VXLAN },
+};
+static int const num_types = sizeof(types) / sizeof(*types);
+
+static std::string random_number() {
+   char buf[16];
+   // Mostly small numbers, some too large to be parsed, and a few with
+   // leading zeros, which are interned.
+   uint32_t n = random_below(10) ? random_below(100) : random_below(100000);
+   snprintf(buf, sizeof(buf), random_below(30) ? "%u" : "0%u", n);
+   return buf;
+}
+
+static std::string random_name() {
+   std::string name;
+   switch (random_below(8)) {
+    case 0:
+      name = random_below(2) ? "Tunnel" : "Recirc-Channel";
+      break;
+    case 1:
+      // A type name with a suffix, such as 'Ethernetx'.
+      name = std::string(types[random_below(num_types)].name) + "x";
+      break;
+    default:
+      name = types[random_below(num_types)].name;
+      break;
+   }
+   int numbers = random_below(10) ? 1 + random_below(3) : random_below(5);
+   for (int i = 0; i < numbers; ++i) {
+      name += (i ? "/" : "") + random_number();
+   }
+   if (!random_below(4)) {
+      name += "." + random_number();
+   }
+   return name;
+}
+
+static DA::intf_type_t expected_type(std::string const & name) {
+   if (name.empty()) {
+      return DA::INTF_TYPE_NULL;
+   }
+   for (int t = 0; t < num_types; ++t) {
+      if (!name.compare(0, strlen(types[t].name), types[t].name)) {
+         // Null0 is the only null interface.
+         if (types[t].type == DA::INTF_TYPE_NULL0 && name != "Null0") {
+            break;
+         }
+         return types[t].type;
+      }
+   }
+   return DA::INTF_TYPE_OTHER;
+}
+
+static bool check(std::string const & name,
+                  std::map<std::string, DA::intf_id_t> * ids,
+                  std::map<DA::intf_id_t, std::string> * names) {
+   DA::intf_id_t id(name);
+   if (id.to_string() != name) {
+      printf("\"%s\" round-trips to \"%s\"\n", name.c_str(),
+             id.to_string().c_str());
+      return false;
+   }
+   if (id.intf_type() != expected_type(name) ||
+       id.is_subintf() != (name.find('.') != std::string::npos) ||
+       id.is_null0() != (name == "Null0")) {
+      printf("\"%s\" has type %s, subinterface %d, null0 %d\n", name.c_str(),
+             DA::enum_name(id.intf_type()), id.is_subintf(), id.is_null0());
+      return false;
+   }
+   auto seen = ids->insert(std::make_pair(name, id));
+   if (!(seen.first->second == id)) {
+      printf("\"%s\" gave two ids\n", name.c_str());
+      return false;
+   }
+   auto named = names->insert(std::make_pair(id, name));
+   if (named.first->second != name) {
+      printf("\"%s\" and \"%s\" have the same id\n", name.c_str(),
+             named.first->second.c_str());
+      return false;
+   }
+   return true;
+}
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start,
+                         size_t count) {
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   return elapsed.count() / count;
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 100000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 42);
+
+   std::map<std::string, DA::intf_id_t> ids;
+   std::map<DA::intf_id_t, std::string> names;
+   if (!check("", &ids, &names) || !check("Null0", &ids, &names)) {
+      return 1;
+   }
+   for (size_t i = 0; i < count; ++i) {
+      if (!check(random_name(), &ids, &names)) {
+         return 1;
+      }
+   }
+   if (!(DA::intf_id_t("Ethernet2") < DA::intf_id_t("Ethernet10")) ||
+       !(DA::intf_id_t("Ethernet3/1") < DA::intf_id_t("Ethernet3/1.1"))) {
+      printf("parsed ids don't compare like their numbers\n");
+      return 1;
+   }
+   printf("%zu names, %zu different: no mismatch\n", count, ids.size());
+
+   // 14 names parsed into the id and 6 interned ones, all seen before.
+   static char const * const mix[] = {
+      "Ethernet1", "Ethernet2/1", "Ethernet3/1/4", "Ethernet48.100",
+      "Port-Channel10", "Port-Channel20.5", "Vlan1", "Vlan4094",
+      "Management1", "Management1/1", "Loopback0", "Null0", "Cpu1",
+      "Vxlan1", "Tunnel5", "Tunnel6.1", "Ethernet01", "Vlan5000",
+      "Recirc-Channel1", "Ethernet3/1/4/1",
+   };
+   size_t mix_size = sizeof(mix) / sizeof(*mix);
+   std::vector<std::string> strings(mix, mix + mix_size);
+   for (auto s = strings.begin(); s != strings.end(); ++s) {
+      DA::intf_id_t id(*s);
+   }
+   char buf[64];
+   size_t chars = 0;
+   int rounds = 100000;
+   size_t before = allocations;
+   auto start = std::chrono::steady_clock::now();
+   for (int round = 0; round < rounds; ++round) {
+      for (auto s = strings.begin(); s != strings.end(); ++s) {
+         DA::intf_id_t id(*s);
+         chars += id.to_chars(buf, buf + sizeof(buf)) - buf;
+      }
+   }
+   printf("%zu names both ways: %.1f ns per name, %zu allocations (%zu)\n",
+          mix_size, elapsed_ns(start, rounds * mix_size), allocations - before,
+          chars % 10);
+   return 0;
+}
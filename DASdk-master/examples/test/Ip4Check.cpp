@@ -0,0 +1,192 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/ip.h>
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "alloc_count.h"
+
+// Checks that ip4_addr_t and ip4_prefix_t agree with the generic types on
+// random prefixes of all lengths: conversions both ways, strings, masks,
+// ordering and hashes, and that the IPv4 parsers accept exactly the IPv4
+// strings the generic ones do.  Then measures the footprint of 2M /24
+// prefixes in each type, and the time to parse them from a route file.
+// Exits with 1 on the first mismatch.
+//
+//    bash# Ip4Check [prefixes] [seed] [time]
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+static uint32_t random_network(int length) {
+   uint32_t addr = random_gen();
+   return length ? addr & ~uint32_t(0) << (32 - length) : 0;
+}
+
+static DA::ip4_prefix_t random_prefix() {
+   int length = random_below(33);
+   DA::ip4_addr_t network(DA::uint32_be_t(htonl(random_network(length))));
+   return DA::ip4_prefix_t(network, length);
+}
+
+static bool check_prefix(DA::ip4_prefix_t const & p, DA::ip4_prefix_t const & q) {
+   DA::ip_prefix_t wide = p;
+   DA::ip_prefix_t expected(DA::ip_addr_t(p.network().addr_v4()),
+                            p.prefix_length());
+   DA::ip_addr_t wide_addr = p.network();
+   DA::ip_prefix_t other = q;
+   bool less = wide.network() < other.network() ||
+               (wide.network() == other.network() &&
+                wide.prefix_length() < other.prefix_length());
+   if (!(wide == expected) || !(DA::ip4_prefix_t(wide) == p) ||
+       !(DA::ip4_addr_t(wide_addr) == p.network()) ||
+       p.to_string() != wide.to_string() ||
+       p.network().to_string() != wide_addr.to_string() ||
+       !(DA::ip_addr_t(p.mask()) == wide.mask()) ||
+       p.hash() != wide.hash() || p.network().hash() != wide_addr.hash() ||
+       std::hash<DA::ip4_prefix_t>()(p) != std::hash<DA::ip_prefix_t>()(wide) ||
+       (p == q) != (wide == other) || (p < q) != less ||
+       (p.network() < q.network()) != (wide_addr < other.network())) {
+      printf("%s and %s: the compact types disagree\n", p.to_string().c_str(),
+             q.to_string().c_str());
+      return false;
+   }
+   return true;
+}
+
+// Parses a string with the IPv4 parsers, which must succeed exactly when
+// the generic parsers return an IPv4 value, and return the same value.
+static bool check_parse(std::string const & s) {
+   DA::ip_addr_t addr;
+   DA::ip4_addr_t addr4;
+   bool valid = DA::parse_ip_addr(s.data(), s.size(), &addr) &&
+                addr.af() == DA::AF_IPV4;
+   if (DA::parse_ip4_addr(s.data(), s.size(), &addr4) != valid ||
+       (valid && !(DA::ip_addr_t(addr4) == addr))) {
+      printf("address \"%s\": expected %s\n", s.c_str(),
+             valid ? "valid" : "invalid");
+      return false;
+   }
+   DA::ip_prefix_t prefix;
+   DA::ip4_prefix_t prefix4;
+   valid = DA::parse_ip_prefix(s.data(), s.size(), &prefix) &&
+           prefix.af() == DA::AF_IPV4;
+   if (DA::parse_ip4_prefix(s.data(), s.size(), &prefix4) != valid ||
+       (valid && !(DA::ip_prefix_t(prefix4) == prefix))) {
+      printf("prefix \"%s\": expected %s\n", s.c_str(),
+             valid ? "valid" : "invalid");
+      return false;
+   }
+   return true;
+}
+
+static std::string random_string(DA::ip4_prefix_t const & p) {
+   std::string s = p.to_string();
+   switch (random_below(6)) {
+    case 0:
+      // The address alone.
+      return s.substr(0, s.find('/'));
+    case 1:
+      return "::ffff:" + s;
+    case 2: {
+      // Host bits, a bad length, or a stray character.
+      static char const chars[] = "0123456789./:x ";
+      s[random_below(s.size())] = chars[random_below(sizeof(chars) - 1)];
+      return s;
+    }
+    case 3:
+      return s + std::to_string(random_below(10));
+    default:
+      return s;
+   }
+}
+
+// Parses a route file of valid prefixes, with an IPv6 prefix at the end.
+static bool check_prefixes(std::vector<DA::ip4_prefix_t> const & prefixes) {
+   std::string file;
+   for (auto p = prefixes.begin(); p != prefixes.end(); ++p) {
+      file += p->to_string() + (random_below(2) ? "\n" : "\r\n");
+   }
+   size_t end_of_ipv4 = file.size();
+   file += "2001:db8::/32\n";
+   std::vector<DA::ip4_prefix_t> parsed(prefixes.size() + 1);
+   size_t consumed;
+   size_t count = DA::parse_ip4_prefixes(file.data(), file.size(),
+                                         parsed.data(), parsed.size(), &consumed);
+   if (count != prefixes.size() || consumed != end_of_ipv4) {
+      printf("parse_ip4_prefixes: %zu of %zu prefixes, stopped at %zu of %zu\n",
+             count, prefixes.size(), consumed, end_of_ipv4);
+      return false;
+   }
+   for (size_t i = 0; i < count; ++i) {
+      if (!(parsed[i] == prefixes[i])) {
+         printf("parse_ip4_prefixes: line %zu differs\n", i);
+         return false;
+      }
+   }
+   return true;
+}
+
+template <typename Prefix>
+static void measure(char const * name, std::string const & file, size_t count,
+                    size_t (*parse)(char const *, size_t, Prefix *, size_t,
+                                    size_t *)) {
+   std::vector<Prefix> prefixes(count);
+   auto start = std::chrono::steady_clock::now();
+   size_t parsed = parse(file.data(), file.size(), prefixes.data(), count, 0);
+   std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+   size_t before = allocated_bytes;
+   std::unordered_set<Prefix> set(prefixes.begin(), prefixes.end());
+   printf("%-12s vector %5.1f MB, parsed in %5.1f ms, unordered_set %5.1f MB\n",
+          name, double(sizeof(Prefix) * parsed) / 1e6, elapsed.count(),
+          double(allocated_bytes - before) / 1e6);
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 200000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 42);
+
+   std::vector<DA::ip4_prefix_t> prefixes;
+   DA::ip4_prefix_t last;
+   for (size_t i = 0; i < count; ++i) {
+      DA::ip4_prefix_t p = random_prefix();
+      // Sometimes the previous prefix, or the same one.
+      DA::ip4_prefix_t q = random_below(4) ? random_prefix() :
+                           random_below(2) ? last : p;
+      if (!check_prefix(p, q) || !check_parse(random_string(p))) {
+         return 1;
+      }
+      prefixes.push_back(p);
+      last = p;
+   }
+   if (!check_prefixes(prefixes)) {
+      return 1;
+   }
+   printf("%zu prefixes: no mismatch\n", count);
+
+   if (argc > 3) {
+      std::string file;
+      size_t routes = 2000000;
+      for (size_t i = 0; i < routes; ++i) {
+         DA::ip4_addr_t network(DA::uint32_be_t(htonl(uint32_t(i) << 8)));
+         file += DA::ip4_prefix_t(network, 24).to_string() + "\n";
+      }
+      measure<DA::ip_prefix_t>("ip_prefix_t", file, routes,
+                               DA::parse_ip_prefixes);
+      measure<DA::ip4_prefix_t>("ip4_prefix_t", file, routes,
+                                DA::parse_ip4_prefixes);
+   }
+   return 0;
+}
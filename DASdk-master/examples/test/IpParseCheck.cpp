@@ -0,0 +1,314 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/ip.h>
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// Checks parse_ip_addr(), parse_ip_prefix() and parse_ip_prefixes()
+// against inet_pton() on fuzzed strings: random addresses written in the
+// various IPv4 and IPv6 forms, with random edits that make many of them
+// invalid.  Exits with 1 on the first mismatch.  With a third argument,
+// also times the parsers against inet_pton().
+//
+//    bash# IpParseCheck [strings] [seed] [time]
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+static std::string random_address() {
+   unsigned char bytes[16];
+   for (int i = 0; i < 16; ++i) {
+      // Zero runs make the :: compression kick in.
+      bytes[i] = random_below(3) ? 0 : random_gen();
+   }
+   char buf[INET6_ADDRSTRLEN];
+   switch (random_below(5)) {
+    case 0:
+    case 1:
+      return inet_ntop(AF_INET, bytes, buf, sizeof(buf));
+    case 2:
+      return inet_ntop(AF_INET6, bytes, buf, sizeof(buf));
+    case 3: {
+      // Uncompressed, sometimes with leading zeros or upper case digits.
+      std::string s;
+      char const * format = random_below(2) ? "%x" : random_below(2) ? "%04x"
+                                                                      : "%X";
+      for (int i = 0; i < 8; ++i) {
+         snprintf(buf, sizeof(buf), format, bytes[2 * i] << 8 | bytes[2 * i + 1]);
+         s += (i ? ":" : "") + std::string(buf);
+      }
+      return s;
+    }
+    default: {
+      // A trailing IPv4 part.
+      snprintf(buf, sizeof(buf), "::%s%u.%u.%u.%u",
+               random_below(2) ? "ffff:" : "", bytes[12], bytes[13], bytes[14],
+               bytes[15]);
+      return buf;
+    }
+   }
+}
+
+static std::string mutate(std::string s) {
+   static char const chars[] = "0123456789abcdefABCDEFgx:./ -";
+   int edits = random_below(3);
+   for (int i = 0; i < edits && !s.empty(); ++i) {
+      size_t pos = random_below(s.size());
+      char c = chars[random_below(sizeof(chars) - 1)];
+      switch (random_below(4)) {
+       case 0:
+         s[pos] = c;
+         break;
+       case 1:
+         s.insert(pos, 1, c);
+         break;
+       case 2:
+         s.erase(pos, 1);
+         break;
+       default:
+         s.insert(pos, s.substr(pos, random_below(5)));
+         break;
+      }
+   }
+   return s;
+}
+
+// What inet_pton() makes of an address: 0 if invalid, else its family.
+static int reference_addr(std::string const & s, unsigned char * bytes) {
+   if (inet_pton(AF_INET, s.c_str(), bytes) == 1) {
+      return AF_INET;
+   }
+   if (inet_pton(AF_INET6, s.c_str(), bytes) == 1) {
+      return AF_INET6;
+   }
+   return 0;
+}
+
+// What a prefix should parse to: the address must be valid, the length a
+// number without leading zeros that fits, and the host bits zero.
+static bool reference_prefix(std::string const & s, unsigned char * bytes,
+                             int * af, unsigned * length) {
+   size_t slash = s.rfind('/');
+   if (slash == std::string::npos) {
+      return false;
+   }
+   std::string digits = s.substr(slash + 1);
+   if (digits.empty() || digits.size() > 3 ||
+       digits.find_first_not_of("0123456789") != std::string::npos ||
+       (digits[0] == '0' && digits.size() > 1)) {
+      return false;
+   }
+   *length = atoi(digits.c_str());
+   *af = reference_addr(s.substr(0, slash), bytes);
+   int size = *af == AF_INET ? 4 : 16;
+   if (!*af || *length > unsigned(size * 8)) {
+      return false;
+   }
+   for (int bit = *length; bit < size * 8; ++bit) {
+      if (bytes[bit / 8] & (0x80 >> (bit % 8))) {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool same(DA::ip_addr_t const & addr, int af,
+                 unsigned char const * bytes) {
+   int size = af == AF_INET ? 4 : 16;
+   return addr.af() == (af == AF_INET ? DA::AF_IPV4 : DA::AF_IPV6) &&
+          !memcmp(addr.addr(), bytes, size);
+}
+
+static bool check_addr(std::string const & s) {
+   unsigned char bytes[16];
+   int af = reference_addr(s, bytes);
+   DA::ip_addr_t addr;
+   if (DA::parse_ip_addr(s.c_str(), &addr) != bool(af) ||
+       (af && !same(addr, af, bytes))) {
+      printf("address \"%s\": inet_pton says %s\n", s.c_str(),
+             af ? "valid" : "invalid");
+      return false;
+   }
+   return true;
+}
+
+static bool check_prefix(std::string const & s, std::vector<std::string> * valid) {
+   unsigned char bytes[16];
+   int af = 0;
+   unsigned length = 0;
+   bool ok = reference_prefix(s, bytes, &af, &length);
+   DA::ip_prefix_t prefix;
+   if (DA::parse_ip_prefix(s.c_str(), &prefix) != ok ||
+       (ok && (!same(prefix.network(), af, bytes) ||
+               prefix.prefix_length() != int(length)))) {
+      printf("prefix \"%s\": expected %s\n", s.c_str(), ok ? "valid" : "invalid");
+      return false;
+   }
+   if (ok) {
+      valid->push_back(s);
+   }
+   return true;
+}
+
+// Parses the valid prefixes back from a route file, with mixed line endings
+// and empty lines, and an invalid line at the end.
+static bool check_prefixes(std::vector<std::string> const & valid) {
+   std::string file;
+   for (size_t i = 0; i < valid.size(); ++i) {
+      file += valid[i];
+      file += random_below(2) ? "\n" : "\r\n";
+      if (!random_below(10)) {
+         file += "\n";
+      }
+   }
+   size_t end_of_valid = file.size();
+   file += "not/a/prefix\n";
+   std::vector<DA::ip_prefix_t> prefixes(valid.size() + 1);
+   size_t consumed;
+   size_t count = DA::parse_ip_prefixes(file.data(), file.size(),
+                                        prefixes.data(), prefixes.size(),
+                                        &consumed);
+   if (count != valid.size() || consumed != end_of_valid) {
+      printf("parse_ip_prefixes: %zu of %zu prefixes, stopped at %zu of %zu\n",
+             count, valid.size(), consumed, end_of_valid);
+      return false;
+   }
+   for (size_t i = 0; i < count; ++i) {
+      DA::ip_prefix_t prefix;
+      DA::parse_ip_prefix(valid[i].c_str(), &prefix);
+      if (prefixes[i] != prefix) {
+         printf("parse_ip_prefixes: line %zu differs\n", i);
+         return false;
+      }
+   }
+   return true;
+}
+
+template <typename Parse>
+static double parse_ns(std::vector<std::string> const & strings, Parse parse) {
+   size_t parsed = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (auto s = strings.begin(); s != strings.end(); ++s) {
+      parsed += parse(*s);
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   if (parsed != strings.size()) {
+      printf("timed strings didn't parse\n");
+   }
+   return elapsed.count() / strings.size();
+}
+
+static void time_family(char const * name, int af) {
+   std::vector<std::string> strings;
+   while (strings.size() < 100000) {
+      std::string s = random_address();
+      unsigned char bytes[16];
+      if (reference_addr(s, bytes) == af) {
+         strings.push_back(s);
+      }
+   }
+   unsigned char bytes[16];
+   DA::ip_addr_t addr;
+   printf("%s address: parse_ip_addr %5.1f ns, inet_pton %5.1f ns\n", name,
+          parse_ns(strings, [&](std::string const & s) {
+             return DA::parse_ip_addr(s.data(), s.size(), &addr);
+          }),
+          parse_ns(strings, [&](std::string const & s) {
+             return inet_pton(af, s.c_str(), bytes) == 1;
+          }));
+}
+
+// Times parse_ip_prefixes() on a route file of mixed prefixes.
+static void time_prefixes(std::vector<std::string> const & valid) {
+   if (valid.empty()) {
+      return;
+   }
+   std::string file;
+   while (file.size() < 32 << 20) {
+      for (auto s = valid.begin(); s != valid.end(); ++s) {
+         file += *s + "\n";
+      }
+   }
+   std::vector<DA::ip_prefix_t> prefixes(1024);
+   size_t count = 0;
+   size_t offset = 0;
+   auto start = std::chrono::steady_clock::now();
+   while (offset < file.size()) {
+      size_t consumed;
+      count += DA::parse_ip_prefixes(file.data() + offset, file.size() - offset,
+                                     prefixes.data(), prefixes.size(),
+                                     &consumed);
+      offset += consumed;
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   printf("route file: parse_ip_prefixes %5.1f ns per prefix\n",
+          elapsed.count() / count);
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 200000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 42);
+
+   size_t valid_addrs = 0;
+   std::vector<std::string> valid_prefixes;
+   for (size_t i = 0; i < count; ++i) {
+      std::string s = random_address();
+      if (random_below(2)) {
+         s = mutate(s);
+      }
+      if (!check_addr(s)) {
+         return 1;
+      }
+      // Prefix lengths around the size of the families, and a few bad ones.
+      char length[8];
+      snprintf(length, sizeof(length), random_below(50) ? "%u" : "0%u",
+               random_below(130));
+      std::string prefix = s + "/" + length;
+      unsigned char bytes[16];
+      int af = reference_addr(s, bytes);
+      valid_addrs += af != 0;
+      if (af && random_below(2)) {
+         // Most random addresses have host bits set: clear them.
+         int bits = af == AF_INET ? 32 : 128;
+         int len = random_below(bits + 1);
+         for (int bit = len; bit < bits; ++bit) {
+            bytes[bit / 8] &= ~(0x80 >> (bit % 8));
+         }
+         char buf[INET6_ADDRSTRLEN];
+         snprintf(length, sizeof(length), "%d", len);
+         prefix = inet_ntop(af, bytes, buf, sizeof(buf)) + std::string("/") +
+                  length;
+      }
+      if (random_below(3) == 0) {
+         prefix = mutate(prefix);
+      }
+      if (!check_prefix(prefix, &valid_prefixes)) {
+         return 1;
+      }
+   }
+   if (!check_prefixes(valid_prefixes)) {
+      return 1;
+   }
+   printf("%zu strings, %zu valid addresses, %zu valid prefixes: "
+          "no mismatch\n", count, valid_addrs, valid_prefixes.size());
+
+   if (argc > 3) {
+      time_family("IPv4", AF_INET);
+      time_family("IPv6", AF_INET6);
+      time_prefixes(valid_prefixes);
+   }
+   return 0;
+}
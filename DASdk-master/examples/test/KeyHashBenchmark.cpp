@@ -0,0 +1,115 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/ip.h>
+#include <DA/mac_table.h>
+#include <DA/neighbor_table.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+// Times the hash() method of the key types, and lookups in an
+// std::unordered_set of random keys hashed with it.  Then times lookups
+// through std::hash<ip_addr_t>, with fewer addresses, since a bad
+// std::hash makes them quadratic.
+//
+//    bash# KeyHashBenchmark [keys]
+
+template <typename Key>
+struct key_hash {
+   size_t operator()(Key const & key) const {
+      return key.hash();
+   }
+};
+
+static std::mt19937_64 random_bits(42);
+
+static DA::ip_addr_t random_ip_addr() {
+   if (random_bits() % 4) {
+      return DA::ip_addr_t(DA::uint32_be_t(random_bits()));
+   }
+   in6_addr addr;
+   uint64_t words[2] = { random_bits(), random_bits() };
+   memcpy(&addr, words, sizeof(addr));
+   return DA::ip_addr_t(addr);
+}
+
+static DA::ip_prefix_t random_ip_prefix_t() {
+   DA::ip_addr_t addr = random_ip_addr();
+   int bits = addr.af() == DA::AF_IPV4 ? 32 : 128;
+   return DA::ip_prefix_t(addr, 1 + random_bits() % bits);
+}
+
+static DA::eth_addr_t random_eth_addr() {
+   uint64_t bits = random_bits();
+   uint8_t bytes[6];
+   memcpy(bytes, &bits, sizeof(bytes));
+   return DA::eth_addr_t(bytes);
+}
+
+static DA::mac_key_t random_mac_key_t() {
+   return DA::mac_key_t(1 + random_bits() % 4094, random_eth_addr());
+}
+
+static DA::neighbor_key_t random_neighbor_key_t() {
+   return DA::neighbor_key_t(random_ip_addr());
+}
+
+static double elapsed_ns(std::chrono::steady_clock::time_point start,
+                         size_t count) {
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   return elapsed.count() / count;
+}
+
+template <typename Key, typename Hash>
+static double lookup_ns(std::vector<Key> const & keys) {
+   std::unordered_set<Key, Hash> set(keys.begin(), keys.end());
+   size_t found = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < keys.size(); ++i) {
+      found += set.count(keys[(i * 7919) % keys.size()]);
+   }
+   double ns = elapsed_ns(start, keys.size());
+   if (found != keys.size()) {
+      printf("lost keys\n");
+   }
+   return ns;
+}
+
+template <typename Key>
+static void measure(char const * name, Key (*random_key)(), size_t count) {
+   std::vector<Key> keys;
+   for (size_t i = 0; i < count; ++i) {
+      keys.push_back(random_key());
+   }
+   uint32_t sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (auto key = keys.begin(); key != keys.end(); ++key) {
+      sum += key->hash();
+   }
+   double hash_ns = elapsed_ns(start, count);
+   printf("%-16s hash() %6.1f ns   lookup %6.1f ns   (%u)\n", name, hash_ns,
+          lookup_ns<Key, key_hash<Key>>(keys), sum % 10);
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 1000000;
+   measure("ip_addr_t", random_ip_addr, count);
+   measure("ip_prefix_t", random_ip_prefix_t, count);
+   measure("mac_key_t", random_mac_key_t, count);
+   measure("neighbor_key_t", random_neighbor_key_t, count);
+
+   std::vector<DA::ip_addr_t> addrs;
+   for (size_t i = 0; i < 20000; ++i) {
+      addrs.push_back(random_ip_addr());
+   }
+   printf("std::hash<ip_addr_t>, %zu addresses: lookup %.1f ns\n",
+          addrs.size(), lookup_ns<DA::ip_addr_t, std::hash<DA::ip_addr_t>>(addrs));
+   return 0;
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/fib.h>
+#include <DA/nexthop_group.h>
+#include <DA/sdk.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "alloc_count.h"
+
+// Times setting the nexthops of new nexthop groups from 16-entry maps,
+// once by copying the maps in and once by moving them in, and counts the
+// allocations of each.  Then does the same with FECs of 16 vias set in the
+// FIB manager.
+//
+//    bash# MoveSetterBenchmark [groups] [rounds]
+
+typedef std::map<uint16_t, DA::nexthop_group_entry_t> nexthop_map_t;
+
+static std::vector<nexthop_map_t> make_maps(size_t count) {
+   std::vector<nexthop_map_t> maps(count);
+   for (size_t i = 0; i < count; ++i) {
+      for (uint16_t entry = 0; entry < 16; ++entry) {
+         DA::ip_addr_t nexthop(DA::uint32_be_t(i << 4 | entry));
+         maps[i][entry] = DA::nexthop_group_entry_t(nexthop);
+      }
+   }
+   return maps;
+}
+
+// Sets `count' new groups, `rounds' times over, so that the heap is warm.
+template <typename Set>
+static void measure(char const * name, size_t count, int rounds, Set set) {
+   double ns = 0;
+   size_t allocated = 0;
+   for (int round = 0; round < rounds; ++round) {
+      std::vector<nexthop_map_t> maps = make_maps(count);
+      // Empty groups, as when programming many groups: assigning to a map
+      // that already has nodes would reuse them.
+      std::vector<DA::nexthop_group_t> groups(
+         count, DA::nexthop_group_t("group", DA::NEXTHOP_GROUP_IP_IN_IP));
+      size_t before = allocations;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < count; ++i) {
+         set(groups[i], maps[i]);
+      }
+      std::chrono::duration<double, std::nano> elapsed =
+         std::chrono::steady_clock::now() - start;
+      ns += elapsed.count();
+      allocated += allocations - before;
+   }
+   printf("%-7s %6.1f ns, %4.1f allocations per nexthops_is()\n", name,
+          ns / (count * rounds), double(allocated) / (count * rounds));
+}
+
+static std::vector<DA::fib_fec_t> make_fecs(size_t count) {
+   std::vector<DA::fib_fec_t> fecs;
+   for (size_t i = 0; i < count; ++i) {
+      DA::fib_fec_t fec((DA::fib_fec_key_t(i)));
+      for (uint32_t via = 0; via < 16; ++via) {
+         fec.via_set(DA::fib_via_t(DA::ip_addr_t(DA::uint32_be_t(i << 4 | via)),
+                                   DA::intf_id_t()));
+      }
+      fecs.push_back(fec);
+   }
+   return fecs;
+}
+
+// Sets `count' new FECs in the FIB, `rounds' times over, deleting them
+// between rounds.
+template <typename Set>
+static void measure_fecs(char const * name, DA::fib_mgr * mgr, size_t count,
+                         int rounds, Set set) {
+   double ns = 0;
+   size_t allocated = 0;
+   for (int round = 0; round < rounds; ++round) {
+      std::vector<DA::fib_fec_t> fecs = make_fecs(count);
+      for (size_t i = 0; i < count; ++i) {
+         mgr->fib_fec_del(fecs[i].fec_key());
+      }
+      size_t before = allocations;
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < count; ++i) {
+         set(mgr, fecs[i]);
+      }
+      std::chrono::duration<double, std::nano> elapsed =
+         std::chrono::steady_clock::now() - start;
+      ns += elapsed.count();
+      allocated += allocations - before;
+   }
+   printf("%-7s %6.1f ns, %4.1f allocations per fib_fec_set()\n", name,
+          ns / (count * rounds), double(allocated) / (count * rounds));
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 1000;
+   int rounds = argc > 2 ? atoi(argv[2]) : 100;
+   measure("copied:", count, rounds,
+           [](DA::nexthop_group_t & group, nexthop_map_t & nexthops) {
+              group.nexthops_is(nexthops);
+           });
+   measure("moved:", count, rounds,
+           [](DA::nexthop_group_t & group, nexthop_map_t & nexthops) {
+              group.nexthops_is(std::move(nexthops));
+           });
+
+   DA::sdk sdk;
+   DA::fib_mgr * fib_mgr = sdk.get_fib_mgr();
+   measure_fecs("copied:", fib_mgr, count, rounds,
+                [](DA::fib_mgr * mgr, DA::fib_fec_t & fec) {
+                   mgr->fib_fec_set(fec);
+                });
+   measure_fecs("moved:", fib_mgr, count, rounds,
+                [](DA::fib_mgr * mgr, DA::fib_fec_t & fec) {
+                   mgr->fib_fec_set(std::move(fec));
+                });
+   return 0;
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/event_loop.h>
+#include <DA/fd.h>
+#include <DA/sdk.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+// Watches many idle sockets and makes one of them readable per loop
+// iteration, to time what an iteration costs as the number of watched
+// FDs grows.  The loop polls with epoll by default; run it with
+// DA_SDK_POLLER=select to compare with the select() poller, which can't
+// go past FD_SETSIZE:
+//
+//    bash# PollerBenchmark [sockets] [iterations]
+//    bash# DA_SDK_POLLER=select PollerBenchmark [sockets] [iterations]
+
+class reader : public DA::fd_handler {
+ public:
+   reader() : reads_(0) {
+   }
+
+   void on_readable(int fd) {
+      char buf[16];
+      if (read(fd, buf, sizeof(buf)) > 0) {
+         reads_++;
+      }
+   }
+
+   size_t reads() const {
+      return reads_;
+   }
+
+ private:
+   size_t reads_;
+};
+
+int main(int argc, char ** argv) {
+   int sockets = argc > 1 ? atoi(argv[1]) : 500;
+   int iterations = argc > 2 ? atoi(argv[2]) : 100000;
+   char const * poller = getenv("DA_SDK_POLLER");
+   DA::sdk sdk;
+   DA::event_loop * loop = sdk.get_event_loop();
+
+   reader handler;
+   std::vector<int> writers;
+   std::vector<int> readers;
+   for (int i = 0; i < sockets; ++i) {
+      int fds[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds)) {
+         perror("socketpair");
+         return 1;
+      }
+      handler.watch_readable(fds[0], true);
+      readers.push_back(fds[0]);
+      writers.push_back(fds[1]);
+   }
+
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < iterations; ++i) {
+      if (write(writers[i % sockets], "x", 1) != 1) {
+         perror("write");
+         return 1;
+      }
+      loop->run(0);
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   printf("%s poller, %d sockets: %zu reads, %.0f ns per iteration\n",
+          poller ? poller : "epoll", sockets, handler.reads(),
+          elapsed.count() / iterations);
+
+   for (int i = 0; i < sockets; ++i) {
+      handler.watch_readable(readers[i], false);
+      close(readers[i]);
+      close(writers[i]);
+   }
+   return handler.reads() == size_t(iterations) ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/event_loop.h>
+#include <DA/sdk.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// Worker threads post callbacks to the main loop as fast as they can, and
+// the loop runs them.  Times how long it takes the loop to run them all,
+// which is what agents handing their results back from worker threads
+// with post(0, ...) pay.
+//
+//    bash# PostBenchmark [threads] [posts per thread]
+
+int main(int argc, char ** argv) {
+   int threads = argc > 1 ? atoi(argv[1]) : 4;
+   size_t posts = argc > 2 ? atoi(argv[2]) : 1000000;
+   DA::sdk sdk;
+   DA::event_loop * loop = sdk.get_event_loop();
+
+   size_t ran = 0;
+   size_t total = threads * posts;
+   auto start = std::chrono::steady_clock::now();
+   std::vector<std::thread> workers;
+   for (int i = 0; i < threads; ++i) {
+      workers.emplace_back([loop, posts, &ran]() {
+         for (size_t j = 0; j < posts; ++j) {
+            loop->post(0, [&ran]() { ran++; });
+         }
+      });
+   }
+   while (ran < total) {
+      loop->run(0);
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   for (auto & worker : workers) {
+      worker.join();
+   }
+   printf("%d threads, %zu callbacks: %.0f ns per callback, %.1fM per second\n",
+          threads, ran, elapsed.count() / ran, ran * 1e3 / elapsed.count());
+   return 0;
+}
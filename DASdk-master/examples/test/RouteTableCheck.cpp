@@ -0,0 +1,295 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/route_table.h>
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Checks sort_prefixes() and sort_routes() against std::stable_sort() with
+// prefix_less(), for all sizes up to 64 and random ones up to 3000, with
+// duplicates, one or both families, sorted input, and addresses with host
+// bits set.  Checks prefix_less() itself, and that it agrees with
+// operator==, and diff_routes() against a merge.  Then times
+// them on 1M IPv4 routes, against std::sort() and the merge.  Exits with 1
+// on the first mismatch.
+//
+//    bash# RouteTableCheck [tables] [seed] [time]
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+// The prefix with one of its host bits set, or the prefix itself if it has
+// none.  Routes may be keyed so, and must not be taken for the network.
+static DA::ip_prefix_t with_host_bit(DA::ip_prefix_t const & prefix) {
+   int bits = prefix.af() == DA::AF_IPV6 ? 128 : 32;
+   int length = prefix.prefix_length();
+   if (length == bits) {
+      return prefix;
+   }
+   uint8_t bytes[16];
+   memcpy(bytes, prefix.network().addr(), bits / 8);
+   int bit = length + random_below(bits - length);
+   bytes[bit / 8] |= 0x80 >> (bit % 8);
+   return DA::ip_prefix_t(DA::ip_addr_t(prefix.af(), bytes), length);
+}
+
+// A prefix of a random length, among `distinct' networks per family so
+// that some prefixes repeat, and some with host bits.
+static DA::ip_prefix_t random_prefix(bool ipv6, uint32_t distinct) {
+   uint8_t bytes[16] = {};
+   uint32_t network = random_below(distinct) * 2654435761u;
+   memcpy(bytes, &network, sizeof(network));
+   if (ipv6) {
+      bytes[15] = random_below(4);
+   }
+   int bits = ipv6 ? 128 : 32;
+   int length = random_below(bits + 1);
+   for (int bit = length; bit < bits; ++bit) {
+      bytes[bit / 8] &= ~(0x80 >> (bit % 8));
+   }
+   DA::ip_prefix_t prefix(
+      DA::ip_addr_t(ipv6 ? DA::AF_IPV6 : DA::AF_IPV4, bytes), length);
+   return random_below(8) ? prefix : with_host_bit(prefix);
+}
+
+static DA::fib_route_t random_route(DA::ip_prefix_t const & prefix) {
+   DA::fib_route_t route((DA::fib_route_key_t(prefix)));
+   route.fec_id_is(random_below(4));
+   route.metric_is(random_below(2));
+   return route;
+}
+
+static bool route_less(DA::fib_route_t const & a, DA::fib_route_t const & b) {
+   return DA::prefix_less(a.route_key().prefix(), b.route_key().prefix());
+}
+
+static bool reference_less(DA::ip_prefix_t const & a, DA::ip_prefix_t const & b) {
+   if (a.af() != b.af()) {
+      return a.af() < b.af();
+   }
+   int cmp = memcmp(a.network().addr(), b.network().addr(),
+                    a.af() == DA::AF_IPV4 ? 4 : 16);
+   return cmp < 0 || (cmp == 0 && a.prefix_length() < b.prefix_length());
+}
+
+static bool check_sort(size_t size) {
+   bool ipv4 = random_below(3);
+   bool ipv6 = !ipv4 || random_below(2);
+   uint32_t distinct = random_below(2) ? size + 1 : size / 4 + 1;
+   std::vector<DA::ip_prefix_t> prefixes;
+   std::vector<DA::fib_route_t> routes;
+   for (size_t i = 0; i < size; ++i) {
+      bool v6 = ipv4 && ipv6 ? random_below(2) : ipv6;
+      prefixes.push_back(random_prefix(v6, distinct));
+      routes.push_back(random_route(prefixes.back()));
+   }
+   for (size_t i = 1; i < size; ++i) {
+      DA::ip_prefix_t const & a = prefixes[i - 1];
+      DA::ip_prefix_t const & b = prefixes[i];
+      bool equivalent = !DA::prefix_less(a, b) && !DA::prefix_less(b, a);
+      if (DA::prefix_less(a, b) != reference_less(a, b) ||
+          equivalent != (a == b)) {
+         printf("prefix_less(%s, %s) is wrong\n", a.to_string().c_str(),
+                b.to_string().c_str());
+         return false;
+      }
+   }
+   // Sorted input, the second time around.
+   for (int sorted = 0; sorted < 2; ++sorted) {
+      std::vector<DA::ip_prefix_t> expected(prefixes);
+      std::stable_sort(expected.begin(), expected.end(), DA::prefix_less);
+      DA::sort_prefixes(prefixes.data(), prefixes.data() + size);
+      std::vector<DA::fib_route_t> expected_routes(routes);
+      std::stable_sort(expected_routes.begin(), expected_routes.end(),
+                       route_less);
+      DA::sort_routes(routes.data(), routes.data() + size);
+      if (prefixes != expected || routes != expected_routes) {
+         printf("%zu %s prefixes, %u distinct: the %s differ\n", size,
+                ipv4 && ipv6 ? "mixed" : ipv4 ? "IPv4" : "IPv6", distinct,
+                prefixes != expected ? "sorted prefixes" : "sorted routes");
+         return false;
+      }
+   }
+   return true;
+}
+
+// The routes of a sorted table with one route per prefix.
+static std::vector<DA::fib_route_t> random_table(size_t size) {
+   std::vector<DA::fib_route_t> routes;
+   for (size_t i = 0; i < size; ++i) {
+      routes.push_back(random_route(random_prefix(random_below(4) == 0,
+                                                  size + 1)));
+   }
+   DA::sort_routes(routes.data(), routes.data() + size);
+   auto same_prefix = [](DA::fib_route_t const & a, DA::fib_route_t const & b) {
+      return a.route_key() == b.route_key();
+   };
+   routes.erase(std::unique(routes.begin(), routes.end(), same_prefix),
+                routes.end());
+   return routes;
+}
+
+// Merges the tables with the existing operators, and reference_less().
+static void reference_diff(std::vector<DA::fib_route_t> const & current,
+                           std::vector<DA::fib_route_t> const & desired,
+                           std::vector<DA::fib_route_t> * added,
+                           std::vector<DA::fib_route_t> * updated,
+                           std::vector<DA::fib_route_key_t> * deleted) {
+   auto c = current.begin();
+   auto d = desired.begin();
+   while (c != current.end() || d != desired.end()) {
+      if (d == desired.end() ||
+          (c != current.end() && reference_less(c->route_key().prefix(),
+                                                d->route_key().prefix()))) {
+         deleted->push_back((c++)->route_key());
+      } else if (c == current.end() ||
+                 reference_less(d->route_key().prefix(),
+                                c->route_key().prefix())) {
+         added->push_back(*d++);
+      } else {
+         if (*c != *d) {
+            updated->push_back(*d);
+         }
+         ++c;
+         ++d;
+      }
+   }
+}
+
+static bool check_diff(size_t size) {
+   std::vector<DA::fib_route_t> current = random_table(size);
+   std::vector<DA::fib_route_t> desired;
+   // Keep, change, drop or replace each route, and add some.
+   for (auto route = current.begin(); route != current.end(); ++route) {
+      switch (random_below(5)) {
+       case 0:
+         break;
+       case 2: {
+         // The same network, keyed with other host bits.
+         DA::fib_route_t replaced(DA::fib_route_key_t(
+            with_host_bit(route->route_key().prefix())));
+         replaced.fec_id_is(route->fec_id());
+         desired.push_back(replaced);
+         break;
+       }
+       case 1: {
+         DA::fib_route_t changed(*route);
+         changed.fec_id_is(route->fec_id() + 1);
+         desired.push_back(changed);
+         break;
+       }
+       default:
+         desired.push_back(*route);
+         break;
+      }
+   }
+   std::vector<DA::fib_route_t> more = random_table(size / 4);
+   desired.insert(desired.end(), more.begin(), more.end());
+   DA::sort_routes(desired.data(), desired.data() + desired.size());
+   auto same_prefix = [](DA::fib_route_t const & a, DA::fib_route_t const & b) {
+      return a.route_key() == b.route_key();
+   };
+   desired.erase(std::unique(desired.begin(), desired.end(), same_prefix),
+                 desired.end());
+
+   std::vector<DA::fib_route_t> added, updated, expected_added, expected_updated;
+   std::vector<DA::fib_route_key_t> deleted, expected_deleted;
+   DA::diff_routes(current.data(), current.size(), desired.data(),
+                   desired.size(), &added, &updated, &deleted);
+   reference_diff(current, desired, &expected_added, &expected_updated,
+                  &expected_deleted);
+   if (added != expected_added || updated != expected_updated ||
+       deleted != expected_deleted) {
+      printf("diff of %zu and %zu routes differs: %zu/%zu/%zu added, updated, "
+             "deleted instead of %zu/%zu/%zu\n", current.size(), desired.size(),
+             added.size(), updated.size(), deleted.size(), expected_added.size(),
+             expected_updated.size(), expected_deleted.size());
+      return false;
+   }
+   return true;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+   std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+   return elapsed.count();
+}
+
+// A table of IPv4 routes, in random order.
+static std::vector<DA::fib_route_t> ipv4_routes(size_t count) {
+   std::vector<DA::fib_route_t> routes;
+   for (size_t i = 0; i < count; ++i) {
+      DA::ip_addr_t network(DA::uint32_be_t(htonl(uint32_t(i) << 8)));
+      routes.push_back(random_route(DA::ip_prefix_t(network, 24)));
+   }
+   std::shuffle(routes.begin(), routes.end(), random_gen);
+   return routes;
+}
+
+static void time_routes(size_t count) {
+   std::vector<DA::fib_route_t> current = ipv4_routes(count);
+   std::vector<DA::fib_route_t> desired = ipv4_routes(count);
+   std::vector<DA::fib_route_t> current_copy(current), desired_copy(desired);
+
+   auto start = std::chrono::steady_clock::now();
+   std::sort(current_copy.begin(), current_copy.end(), route_less);
+   std::sort(desired_copy.begin(), desired_copy.end(), route_less);
+   printf("%zu routes, sorting both tables: std::sort %6.1f ms, ", count,
+          elapsed_ms(start));
+   start = std::chrono::steady_clock::now();
+   DA::sort_routes(current.data(), current.data() + count);
+   DA::sort_routes(desired.data(), desired.data() + count);
+   printf("sort_routes %6.1f ms\n", elapsed_ms(start));
+
+   start = std::chrono::steady_clock::now();
+   DA::sort_routes(current.data(), current.data() + count);
+   printf("%zu routes, re-sorting a sorted table: %6.1f ms\n", count,
+          elapsed_ms(start));
+
+   std::vector<DA::fib_route_t> added, updated;
+   std::vector<DA::fib_route_key_t> deleted;
+   start = std::chrono::steady_clock::now();
+   reference_diff(current, desired, &added, &updated, &deleted);
+   printf("%zu routes, diff: merge %6.1f ms, ", count, elapsed_ms(start));
+   added.clear();
+   updated.clear();
+   deleted.clear();
+   start = std::chrono::steady_clock::now();
+   DA::diff_routes(current.data(), count, desired.data(), count, &added,
+                   &updated, &deleted);
+   printf("diff_routes %6.1f ms (%zu updated)\n", elapsed_ms(start),
+          updated.size());
+}
+
+int main(int argc, char ** argv) {
+   size_t tables = argc > 1 ? atoi(argv[1]) : 1000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 42);
+
+   for (size_t size = 0; size <= 64; ++size) {
+      if (!check_sort(size)) {
+         return 1;
+      }
+   }
+   for (size_t i = 0; i < tables; ++i) {
+      size_t size = random_below(3001);
+      if (!check_sort(size) || !check_diff(size)) {
+         return 1;
+      }
+   }
+   printf("%zu tables: no mismatch\n", tables);
+
+   if (argc > 3) {
+      time_routes(1000000);
+   }
+   return 0;
+}
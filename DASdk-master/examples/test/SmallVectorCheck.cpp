@@ -0,0 +1,265 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/fib.h>
+#include <DA/nexthop_group.h>
+#include <DA/small_vector.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "alloc_count.h"
+
+// Checks small_vector against std::vector on random sequences of
+// operations, including inserting and pushing back one of the vector's own
+// elements, and counts the live elements to catch leaks and double
+// destructions.  Then times copying a FEC and an MPLS action, and counts
+// the allocations.  Exits with 1 on the first mismatch.
+//
+//    bash# SmallVectorCheck [sequences] [seed]
+
+// A value that counts its live instances, and that is poisoned once
+// destroyed.  The string makes copies allocate and moves steal.
+class tracked {
+ public:
+   explicit tracked(int value) : value_(std::to_string(value)), alive_(true) {
+      live++;
+   }
+   tracked(tracked const & other) : value_(other.get()), alive_(true) {
+      live++;
+   }
+   tracked(tracked && other) : value_(std::move(other.value_)), alive_(true) {
+      other.check();
+      live++;
+   }
+   ~tracked() {
+      check();
+      alive_ = false;
+      live--;
+   }
+   tracked & operator=(tracked const & other) {
+      check();
+      value_ = other.get();
+      return *this;
+   }
+   tracked & operator=(tracked && other) {
+      check();
+      other.check();
+      value_ = std::move(other.value_);
+      return *this;
+   }
+   bool operator==(tracked const & other) const {
+      return get() == other.get();
+   }
+   bool operator!=(tracked const & other) const {
+      return get() != other.get();
+   }
+   bool operator<(tracked const & other) const {
+      return get() < other.get();
+   }
+   std::string const & get() const {
+      check();
+      return value_;
+   }
+
+   static long live;
+
+ private:
+   void check() const {
+      if (!alive_) {
+         printf("use of a destroyed element\n");
+         exit(1);
+      }
+   }
+
+   std::string value_;
+   bool alive_;
+};
+
+long tracked::live;
+
+typedef DA::small_vector<tracked, 3> small_t;
+typedef std::vector<tracked> reference_t;
+
+static std::mt19937 random_gen;
+
+static uint32_t random_below(uint32_t n) {
+   return random_gen() % n;
+}
+
+static bool same(small_t const & v, reference_t const & r) {
+   if (v.size() != r.size() || v.empty() != r.empty() ||
+       v.capacity() < v.size()) {
+      return false;
+   }
+   for (size_t i = 0; i < r.size(); ++i) {
+      if (v[i] != r[i]) {
+         return false;
+      }
+   }
+   return true;
+}
+
+// Applies one random operation to both containers.
+static void step(small_t & v, reference_t & r) {
+   size_t size = r.size();
+   switch (random_below(12)) {
+    case 0:
+    case 1: {
+      tracked value(random_below(10));
+      v.push_back(value);
+      r.push_back(value);
+      break;
+    }
+    case 2: {
+      int value = random_below(10);
+      v.push_back(tracked(value));
+      r.push_back(tracked(value));
+      break;
+    }
+    case 3:
+      if (size) {
+         // Pushes back an element of the vector itself.
+         size_t i = random_below(size);
+         v.push_back(v[i]);
+         r.push_back(tracked(r[i]));
+      }
+      break;
+    case 4: {
+      size_t pos = random_below(size + 1);
+      tracked value(random_below(10));
+      v.insert(v.begin() + pos, value);
+      r.insert(r.begin() + pos, value);
+      break;
+    }
+    case 5:
+      if (size) {
+         // Inserts an element of the vector itself.
+         size_t pos = random_below(size + 1);
+         size_t i = random_below(size);
+         v.insert(v.begin() + pos, v[i]);
+         r.insert(r.begin() + pos, tracked(r[i]));
+      }
+      break;
+    case 6: {
+      size_t first = random_below(size + 1);
+      size_t last = first + random_below(size - first + 1);
+      v.erase(v.begin() + first, v.begin() + last);
+      r.erase(r.begin() + first, r.begin() + last);
+      break;
+    }
+    case 7: {
+      tracked value(random_below(10));
+      v.remove(value);
+      for (auto i = r.begin(); i != r.end();) {
+         i = *i == value ? r.erase(i) : i + 1;
+      }
+      break;
+    }
+    case 8:
+      if (!random_below(4)) {
+         v.clear();
+         r.clear();
+      }
+      break;
+    case 9:
+      v.reserve(random_below(10));
+      break;
+    case 10: {
+      small_t copy(v);
+      if (random_below(2)) {
+         v = std::move(copy);
+      } else {
+         small_t moved(std::move(copy));
+         v = moved;
+      }
+      break;
+    }
+    default: {
+      small_t other;
+      for (int i = random_below(6); i > 0; --i) {
+         other.push_back(tracked(random_below(10)));
+      }
+      reference_t other_r(other.begin(), other.end());
+      if ((v == other) != (r == other_r) || (v != other) != (r != other_r) ||
+          (v < other) != (r < other_r)) {
+         printf("comparisons differ\n");
+         exit(1);
+      }
+      if (random_below(2)) {
+         v = other;
+         r = other_r;
+      }
+      break;
+    }
+   }
+}
+
+static bool check(size_t sequences) {
+   for (size_t sequence = 0; sequence < sequences; ++sequence) {
+      {
+         small_t v;
+         reference_t r;
+         for (int i = random_below(60); i > 0; --i) {
+            step(v, r);
+            if (!same(v, r)) {
+               printf("sequence %zu differs after %zu elements\n", sequence,
+                      r.size());
+               return false;
+            }
+         }
+      }
+      if (tracked::live) {
+         printf("sequence %zu leaves %ld elements\n", sequence, tracked::live);
+         return false;
+      }
+   }
+   return true;
+}
+
+// Where the copies are published, so that they aren't optimized away.
+static void const * volatile sink;
+
+template <typename T>
+static void time_copies(char const * name, T const & value) {
+   int copies = 1000000;
+   size_t before = allocations;
+   auto start = std::chrono::steady_clock::now();
+   for (int i = 0; i < copies; ++i) {
+      T copy(value);
+      sink = &copy;
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   printf("copying %-20s %5.1f ns, %4.1f allocations\n", name,
+          elapsed.count() / copies, double(allocations - before) / copies);
+}
+
+int main(int argc, char ** argv) {
+   size_t sequences = argc > 1 ? atoi(argv[1]) : 20000;
+   random_gen.seed(argc > 2 ? atoi(argv[2]) : 42);
+   if (!check(sequences)) {
+      return 1;
+   }
+   printf("%zu sequences: no mismatch\n", sequences);
+
+   for (int vias = 4; vias <= 8; vias += 4) {
+      DA::fib_fec_t fec;
+      for (int i = 0; i < vias; ++i) {
+         fec.via_set(DA::fib_via_t(DA::ip_addr_t(DA::uint32_be_t(i)),
+                                   DA::intf_id_t()));
+      }
+      time_copies(vias == 4 ? "a FEC with 4 vias:" : "a FEC with 8 vias:", fec);
+   }
+   DA::nexthop_group_mpls_action_t action(DA::MPLS_ACTION_PUSH);
+   for (uint32_t label = 16; label < 19; ++label) {
+      action.label_stack_set(DA::mpls_label_t(label));
+   }
+   time_copies("a 3-label action:", action);
+   return 0;
+}
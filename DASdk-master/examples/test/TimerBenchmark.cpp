@@ -0,0 +1,84 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/event_loop.h>
+#include <DA/sdk.h>
+#include <DA/timer.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+// Times arming, re-arming, cancelling and firing many timeout_handlers,
+// which is what agents keeping a timer per session or per route do.
+//
+//    bash# TimerBenchmark [timers] [re-arms]
+
+class timer : public DA::timeout_handler {
+ public:
+   explicit timer(DA::timeout_mgr * mgr, size_t * fired) :
+         DA::timeout_handler(mgr), fired_(fired) {
+   }
+
+   void on_timeout() {
+      (*fired_)++;
+   }
+
+ private:
+   size_t * fired_;
+};
+
+static void report(char const * what, size_t count,
+                   std::chrono::steady_clock::time_point start) {
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   printf("%-8s %8zu timers %8.0f ns each\n", what, count,
+          elapsed.count() / count);
+}
+
+int main(int argc, char ** argv) {
+   size_t num_timers = argc > 1 ? atoi(argv[1]) : 100000;
+   size_t rearms = argc > 2 ? atoi(argv[2]) : 1000000;
+   DA::sdk sdk;
+   DA::timeout_mgr * mgr = sdk.get_timeout_mgr();
+   DA::event_loop * loop = sdk.get_event_loop();
+   std::mt19937 random(42);
+   std::uniform_real_distribution<double> delay(1000, 2000);
+
+   size_t fired = 0;
+   std::vector<std::unique_ptr<timer>> timers;
+   for (size_t i = 0; i < num_timers; ++i) {
+      timers.emplace_back(new timer(mgr, &fired));
+   }
+
+   DA::seconds_t base = DA::now();
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < num_timers; ++i) {
+      timers[i]->timeout_time_is(base + delay(random));
+   }
+   report("arm", num_timers, start);
+
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < rearms; ++i) {
+      timers[random() % num_timers]->timeout_time_is(base + delay(random));
+   }
+   report("re-arm", rearms, start);
+
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < num_timers; ++i) {
+      timers[i]->timeout_time_is(DA::never);
+   }
+   report("cancel", num_timers, start);
+
+   // Deadlines in the past all fire on the next loop iteration.
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < num_timers; ++i) {
+      timers[i]->timeout_time_is(base - delay(random));
+   }
+   loop->run(0);
+   report("fire", fired, start);
+   return fired == num_timers ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/fib.h>
+#include <DA/ip.h>
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "alloc_count.h"
+
+// Times formatting random routes with to_string() and with to_chars(), and
+// counts the allocations of each.  Then checks that to_chars() writes what
+// to_string() returns, that it fails on a short buffer, and that IPv6
+// addresses are written the way inet_ntop() writes them.
+//
+//    bash# ToCharsBenchmark [routes]
+
+static std::mt19937_64 random_bits(42);
+
+static DA::ip_addr_t random_ip_addr() {
+   if (random_bits() % 4) {
+      return DA::ip_addr_t(DA::uint32_be_t(random_bits()));
+   }
+   // Zero runs make the :: compression kick in.
+   in6_addr addr;
+   for (int i = 0; i < 16; ++i) {
+      addr.s6_addr[i] = random_bits() % 3 ? 0 : random_bits();
+   }
+   return DA::ip_addr_t(addr);
+}
+
+static DA::fib_route_t random_route() {
+   DA::ip_addr_t addr = random_ip_addr();
+   int bits = addr.af() == DA::AF_IPV4 ? 32 : 128;
+   int length = random_bits() % (bits + 1);
+   // Clear the host bits, which the prefix constructor rejects.
+   uint8_t bytes[16];
+   memcpy(bytes, addr.addr(), bits / 8);
+   for (int bit = length; bit < bits; ++bit) {
+      bytes[bit / 8] &= ~(0x80 >> (bit % 8));
+   }
+   DA::ip_prefix_t prefix(DA::ip_addr_t(addr.af(), bytes), length);
+   DA::fib_route_t route((DA::fib_route_key_t(prefix)));
+   route.route_type_is(
+      DA::fib_route_type_t(random_bits() % (DA::ROUTE_TYPE_OSPF3 + 1)));
+   route.preference_is(random_bits() % 256);
+   route.metric_is(random_bits());
+   route.fec_id_is(random_bits());
+   return route;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+   std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+   return elapsed.count();
+}
+
+int main(int argc, char ** argv) {
+   size_t count = argc > 1 ? atoi(argv[1]) : 1000000;
+   std::vector<DA::fib_route_t> routes;
+   for (size_t i = 0; i < count; ++i) {
+      routes.push_back(random_route());
+   }
+
+   size_t chars = 0;
+   size_t before = allocations;
+   auto start = std::chrono::steady_clock::now();
+   for (auto route = routes.begin(); route != routes.end(); ++route) {
+      chars += route->to_string().size();
+   }
+   printf("to_string(): %7.1f ms, %5.2f allocations per route, %zu MB\n",
+          elapsed_ms(start), double(allocations - before) / count, chars >> 20);
+
+   char buf[256];
+   chars = 0;
+   before = allocations;
+   start = std::chrono::steady_clock::now();
+   for (auto route = routes.begin(); route != routes.end(); ++route) {
+      chars += route->to_chars(buf, buf + sizeof(buf)) - buf;
+   }
+   printf("to_chars():  %7.1f ms, %5.2f allocations per route, %zu MB\n",
+          elapsed_ms(start), double(allocations - before) / count, chars >> 20);
+
+   for (auto route = routes.begin(); route != routes.end(); ++route) {
+      std::string s = route->to_string();
+      char * end = route->to_chars(buf, buf + sizeof(buf));
+      if (!end || std::string(buf, end) != s) {
+         printf("to_chars() differs from to_string(): %s\n", s.c_str());
+         return 1;
+      }
+      if (route->to_chars(buf, buf + s.size() - 1)) {
+         printf("to_chars() overflowed a short buffer: %s\n", s.c_str());
+         return 1;
+      }
+   }
+
+   for (size_t i = 0; i < count; ++i) {
+      DA::ip_addr_t addr = random_ip_addr();
+      char expected[INET6_ADDRSTRLEN];
+      if (addr.af() == DA::AF_IPV4) {
+         continue;
+      }
+      inet_ntop(AF_INET6, addr.addr(), expected, sizeof(expected));
+      char * end = addr.to_chars(buf, buf + sizeof(buf));
+      if (!end || std::string(buf, end) != expected) {
+         printf("%s is written as %s\n", expected, addr.to_string().c_str());
+         return 1;
+      }
+   }
+   printf("to_chars() matches to_string() and inet_ntop()\n");
+   return 0;
+}
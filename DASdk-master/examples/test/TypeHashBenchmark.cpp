@@ -0,0 +1,108 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include <DA/fib.h>
+#include <DA/intf.h>
+#include <DA/policy_map.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+// Times the hash() method of a few generated types, then checks that equal
+// values hash the same even when they were built over dirty memory, or
+// filled in a different order.
+//
+//    bash# TypeHashBenchmark [values]
+
+static DA::ip_addr_t ip(uint32_t i) {
+   return DA::ip_addr_t(DA::uint32_be_t(i));
+}
+
+static DA::fib_route_key_t route_key(uint32_t i) {
+   return DA::fib_route_key_t(DA::ip_prefix_t(ip(i << 8), 24));
+}
+
+static DA::fib_route_t route(uint32_t i) {
+   DA::fib_route_t route(route_key(i));
+   route.fec_id_is(i);
+   return route;
+}
+
+static DA::fib_fec_t fec(uint32_t i) {
+   DA::fib_fec_t fec;
+   for (uint32_t via = 0; via < 4; ++via) {
+      fec.via_set(DA::fib_via_t(ip(i + via), DA::intf_id_t()));
+   }
+   return fec;
+}
+
+static DA::intf_counters_t counters(uint32_t i) {
+   return DA::intf_counters_t(i, i + 1, i + 2, i + 3, i + 4, i + 5, i + 6, i + 7,
+                              i + 8, i + 9, i + 10, i + 11, i * 0.5);
+}
+
+static DA::policy_map_action_t action(uint32_t i) {
+   DA::policy_map_action_t action(DA::POLICY_ACTION_NEXTHOP);
+   for (uint32_t hop = 0; hop < 4; ++hop) {
+      action.nexthop_set(ip(i + hop));
+   }
+   return action;
+}
+
+template <typename T>
+static void measure(char const * name, T (*make)(uint32_t), uint32_t count) {
+   std::vector<T> values;
+   for (uint32_t i = 0; i < count; ++i) {
+      values.push_back(make(i));
+   }
+   uint32_t sum = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (auto value = values.begin(); value != values.end(); ++value) {
+      sum += value->hash();
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   printf("%-20s %6.1f ns per hash() (%u)\n", name, elapsed.count() / count,
+          sum % 10);
+}
+
+// Builds the same route key over memory filled with `fill'.
+static uint32_t dirty_route_key_hash(uint8_t fill) {
+   alignas(DA::fib_route_key_t) unsigned char buf[sizeof(DA::fib_route_key_t)];
+   memset(buf, fill, sizeof(buf));
+   DA::fib_route_key_t * key = new (buf) DA::fib_route_key_t(route_key(42));
+   uint32_t hash = key->hash();
+   key->~fib_route_key_t();
+   return hash;
+}
+
+int main(int argc, char ** argv) {
+   uint32_t count = argc > 1 ? atoi(argv[1]) : 100000;
+   measure("fib_route_key_t", route_key, count);
+   measure("fib_route_t", route, count);
+   measure("fib_fec_t (4 vias)", fec, count);
+   measure("intf_counters_t", counters, count);
+   measure("policy_map_action_t", action, count);
+
+   bool consistent = true;
+   if (dirty_route_key_hash(0) != dirty_route_key_hash(0xff)) {
+      printf("equal fib_route_key_t hash differently over dirty memory\n");
+      consistent = false;
+   }
+   DA::policy_map_action_t forward(DA::POLICY_ACTION_NEXTHOP);
+   DA::policy_map_action_t backward(DA::POLICY_ACTION_NEXTHOP);
+   for (uint32_t hop = 0; hop < 64; ++hop) {
+      forward.nexthop_set(ip(hop));
+      backward.nexthop_set(ip(63 - hop));
+   }
+   if (forward == backward && forward.hash() != backward.hash()) {
+      printf("equal policy_map_action_t hash differently\n");
+      consistent = false;
+   }
+   printf("equal values hash the same: %s\n", consistent ? "yes" : "no");
+   return consistent ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef EXAMPLES_TEST_ALLOC_COUNT_H
+#define EXAMPLES_TEST_ALLOC_COUNT_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <new>
+
+// Counts the allocations the benchmarks and checks make, by replacing every
+// form of operator new and delete.  The replacements are definitions, so only
+// one file of a program may include this.
+//
+// They are kept out of line.  Once the compiler inlines one of them into a
+// caller, it sees memory from operator new handed to free(), and warns with
+// -Wmismatched-new-delete at some optimization levels.
+
+// The number of calls to operator new, and the bytes they asked for.
+static size_t allocations;
+static size_t allocated_bytes;
+
+static void * counted_alloc(size_t size, size_t align) noexcept {
+   allocations++;
+   allocated_bytes += size;
+   if (size == 0) {
+      size = 1;
+   }
+   if (align <= alignof(max_align_t)) {
+      return malloc(size);
+   }
+   void * p;
+   return posix_memalign(&p, align, size) ? nullptr : p;
+}
+
+__attribute__((noinline))
+void * operator new(size_t size) {
+   if (void * p = counted_alloc(size, 0)) {
+      return p;
+   }
+   throw std::bad_alloc();
+}
+
+__attribute__((noinline))
+void * operator new[](size_t size) {
+   return operator new(size);
+}
+
+__attribute__((noinline))
+void * operator new(size_t size, std::nothrow_t const &) noexcept {
+   return counted_alloc(size, 0);
+}
+
+__attribute__((noinline))
+void * operator new[](size_t size, std::nothrow_t const &) noexcept {
+   return counted_alloc(size, 0);
+}
+
+__attribute__((noinline))
+void operator delete(void * p) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete[](void * p) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete(void * p, size_t) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete[](void * p, size_t) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete(void * p, std::nothrow_t const &) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete[](void * p, std::nothrow_t const &) noexcept {
+   free(p);
+}
+
+#if __cpp_aligned_new
+__attribute__((noinline))
+void * operator new(size_t size, std::align_val_t align) {
+   if (void * p = counted_alloc(size, size_t(align))) {
+      return p;
+   }
+   throw std::bad_alloc();
+}
+
+__attribute__((noinline))
+void * operator new[](size_t size, std::align_val_t align) {
+   return operator new(size, align);
+}
+
+__attribute__((noinline))
+void * operator new(size_t size, std::align_val_t align,
+                    std::nothrow_t const &) noexcept {
+   return counted_alloc(size, size_t(align));
+}
+
+__attribute__((noinline))
+void * operator new[](size_t size, std::align_val_t align,
+                      std::nothrow_t const &) noexcept {
+   return counted_alloc(size, size_t(align));
+}
+
+__attribute__((noinline))
+void operator delete(void * p, std::align_val_t) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete[](void * p, std::align_val_t) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete(void * p, size_t, std::align_val_t) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete[](void * p, size_t, std::align_val_t) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete(void * p, std::align_val_t,
+                     std::nothrow_t const &) noexcept {
+   free(p);
+}
+
+__attribute__((noinline))
+void operator delete[](void * p, std::align_val_t,
+                       std::nothrow_t const &) noexcept {
+   free(p);
+}
+#endif
+
+#endif // EXAMPLES_TEST_ALLOC_COUNT_H
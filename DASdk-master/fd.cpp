@@ -6,12 +6,13 @@
 
 namespace DA {
 
-fd_handler::fd_handler() {
-   impl.register_fd_handler(this);
+fd_handler::fd_handler() : fd_(new fd_internal(&Impl::current())) {
+   fd_->impl()->register_fd_handler(this);
 }
 
 fd_handler::~fd_handler() {
-   impl.unregister_fd_handler(this);
+   fd_->impl()->unregister_fd_handler(this);
+   delete fd_;
 }
 
 void
@@ -31,17 +32,45 @@ fd_handler::on_exception(int fd) {
 
 void
 fd_handler::watch_readable(int fd, bool interest) {
-   impl.get_fd_sm(this)->watch_readable(fd, interest);
+   fd_->impl()->watch_fd(this, fd, interest, fd_handler_sm::WANT_READ);
 }
 
 void
 fd_handler::watch_writable(int fd, bool interest) {
-   impl.get_fd_sm(this)->watch_writable(fd, interest);
+   fd_->impl()->watch_fd(this, fd, interest, fd_handler_sm::WANT_WRITE);
 }
 
 void
 fd_handler::watch_exception(int fd, bool interest) {
-   impl.get_fd_sm(this)->watch_exception(fd, interest);
+   fd_->impl()->watch_fd(this, fd, interest, fd_handler_sm::WANT_EXCEPT);
+}
+
+fd_waiter::fd_waiter() : impl_(&Impl::current()), prev_(0), next_(0),
+                         seq_(0), fd_(-1), interest_(0) {
+}
+
+fd_waiter::~fd_waiter() {
+   cancel();
+}
+
+void
+fd_waiter::wait_readable(int fd) {
+   impl_->arm_fd_waiter(this, fd, fd_handler_sm::WANT_READ);
+}
+
+void
+fd_waiter::wait_writable(int fd) {
+   impl_->arm_fd_waiter(this, fd, fd_handler_sm::WANT_WRITE);
+}
+
+void
+fd_waiter::cancel() {
+   impl_->disarm_fd_waiter(this);
+}
+
+bool
+fd_waiter::waiting() const {
+   return interest_ != 0;
 }
 
 }
@@ -3,51 +3,101 @@
 
 #include "DA/fib.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
-class fib_mgr_impl : public fib_mgr {
+class fib_mgr_impl : public fib_mgr, public deferred_flush {
  public:
+   using fib_mgr::fib_fec_set;
+   using fib_mgr::fib_route_set;
+
+   fib_mgr_impl() : notifying_(0), route_waiter_seq_(0) {
+   }
+
+   ~fib_mgr_impl() {
+      impl.flush_del(this);
+      // The waiters die with us: they are disarmed, without being called.
+      for (auto head = route_waiters_.begin(); head != route_waiters_.end();
+           ++head) {
+         for (fib_route_waiter * waiter = head->second; waiter;) {
+            fib_route_waiter * next = waiter->next_;
+            waiter->mgr_ = 0;
+            waiter->prev_ = 0;
+            waiter->next_ = 0;
+            waiter = next;
+         }
+      }
+   }
+
    bool fib_fec_set(fib_fec_t const & fec) {
-      // TODO: add/replace the fec
+      fecs_.set(fec.fec_key(), fec);
+      handler_foreach([&fec](fib_handler * handler) {
+         loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
+         handler->on_fec_set(fec);
+      });
       return true;
    }
 
    void fib_fec_del(fib_fec_key_t const & fec_key) {
-      // TODO: delete the fec from status
-      return;
+      if (!fecs_.del(fec_key)) {
+         return;
+      }
+      handler_foreach([&fec_key](fib_handler * handler) {
+         loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
+         handler->on_fec_del(fec_key);
+      });
    }
 
    bool fib_fec_exists(fib_fec_key_t const & fec_key) {
-      // TODO: check if fec exists
-      return true;
+      return fecs_.find(fec_key);
    }
 
    fib_fec_t fib_fec(fib_fec_key_t const & fec_key) {
-      // TODO: return fec from the status
-      fib_fec_t fec;
-      return fec;
+      fib_fec_t const * fec = fecs_.find(fec_key);
+      return fec ? *fec : fib_fec_t();
    }
 
    bool fib_route_set(fib_route_t const & route) {
-      // TODO: add/replace the route
+      routes_.set(route.route_key(), route);
+      notify_route_set(route);
       return true;
    }
 
    void fib_route_del(fib_route_key_t const & route_key) {
-      // TODO: delete the route from status
-      return;
+      if (!routes_.del(route_key)) {
+         return;
+      }
+      if (deliveries_.batched() || deliveries_.conflated()) {
+         flush_pending();
+      }
+      if (deliveries_.batched()) {
+         pending_routes_.del(route_key);
+      }
+      if (deliveries_.conflated()) {
+         conflated_routes_.changed(route_key);
+      }
+      if (deliveries_.now()) {
+         notifying_++;
+         handler_foreach([&](handler_t * handler) {
+            if (deliveries_.delivery(handler) == DELIVER_NOW) {
+               loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER,
+                                      handler);
+               handler->on_route_del(route_key);
+            }
+         });
+         notifying_--;
+         apply_deliveries();
+      }
    }
 
    bool fib_route_exists(fib_route_key_t const & route_key) {
-      // TODO: check if route exists
-      return true;
+      return routes_.find(route_key);
    }
 
    fib_route_t fib_route(fib_route_key_t const & route_key) {
-      // TODO: return route from the status
-      fib_route_t route;
-      return route;
+      fib_route_t const * route = routes_.find(route_key);
+      return route ? *route : fib_route_t();
    }
 
    bool register_vrf(std::string const & vrf_name, bool set_vrf) {
@@ -55,24 +105,316 @@ class fib_mgr_impl : public fib_mgr {
    }
 
    fib_route_iter_t fib_route_iter() const {
-      fib_route_iter_t *nop = 0;
-      return *nop;
+      return fib_route_iter_impl::iter(routes_.snapshot());
+   }
+
+   std::vector<fib_route_iter_t> fib_route_iters(size_t count) const {
+      return fib_route_iter_impl::iters(routes_.snapshot(), count);
    }
 
    fib_fec_iter_t fib_fec_iter() const {
-      fib_fec_iter_t *nop = 0;
-      return *nop;
+      return fib_fec_iter_impl::iter(fecs_.snapshot());
    }
 
    mgr_mode_type_t mode_type() {
       return MODE_TYPE_READ_ONLY;
    }
+
+   bool fib_fec_set_moved(fib_fec_t & fec) {
+      if (deliveries_.watching()) {
+         // Hand the handlers the FEC passed in rather than the table's row,
+         // which a FEC they set could move.
+         return fib_fec_set(fec);
+      }
+      fib_fec_key_t key = fec.fec_key();
+      fecs_.set(key, std::move(fec));
+      return true;
+   }
+
+   bool fib_route_set_moved(fib_route_t & route) {
+      if (deliveries_.now() || !route_waiters_.empty()) {
+         // As above, for the handlers and waiters called from here.
+         return fib_route_set(route);
+      }
+      fib_route_key_t key = route.route_key();
+      routes_.set(key, std::move(route));
+      // No handler runs before the route is copied into the batch.
+      notify_route_set(*routes_.find(key));
+      return true;
+   }
+
+   // Delivers the route changes of the loop iteration to the handlers that
+   // take them in batches, or conflated.  Changes they make go to the next
+   // batch.
+   void flush() {
+      delivering_routes_.swap(pending_routes_);
+      conflated_routes_.resolve([this](fib_route_key_t const & key) {
+         return routes_.find(key);
+      });
+      notifying_++;
+      handler_foreach([&](handler_t * handler) {
+         auto on_sets = [handler](fib_route_t const * batch, size_t count) {
+            handler->on_route_set_batch(batch, count);
+         };
+         auto on_dels = [handler](fib_route_key_t const * batch, size_t count) {
+            handler->on_route_del_batch(batch, count);
+         };
+         delivery_t how = deliveries_.delivery(handler);
+         if (how == DELIVER_NOW) {
+            return;
+         }
+         loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
+         if (how == DELIVER_CONFLATED) {
+            deliveries_.changes_conflated_add(handler,
+                                              conflated_routes_.conflated());
+            conflated_routes_.deliver(on_sets, on_dels);
+         } else {
+            delivering_routes_.deliver(on_sets, on_dels);
+         }
+      });
+      notifying_--;
+      delivering_routes_.clear();
+      conflated_routes_.delivered();
+      apply_deliveries();
+   }
+
+ private:
+   typedef fib_handler handler_t;
+
+   // The FIB handlers all watch every route, so any of them can take the
+   // changes in batches.
+   void add_handler(handler_t * handler) {
+      deliveries_.watch(handler);
+      fib_mgr::add_handler(handler);
+   }
+
+   void remove_handler(handler_t * handler) {
+      deliveries_.unwatch(handler);
+      fib_mgr::remove_handler(handler);
+   }
+
+   void route_batches_is(handler_t * handler, bool batches) {
+      deliveries_.batches_is(handler, batches, held_back());
+   }
+
+   bool route_batches(handler_t const * handler) const {
+      return deliveries_.batches(handler);
+   }
+
+   void route_conflation_is(handler_t * handler, bool conflation) {
+      deliveries_.conflation_is(handler, conflation, held_back());
+   }
+
+   bool route_conflation(handler_t const * handler) const {
+      return deliveries_.conflation(handler);
+   }
+
+   uint64_t route_changes_conflated(handler_t const * handler) const {
+      return deliveries_.changes_conflated(handler);
+   }
+
+   void route_waiter_add(fib_route_waiter * waiter) {
+      fib_route_waiter *& head = route_waiters_[waiter->route_key_];
+      waiter->seq_ = route_waiter_seq_++;
+      waiter->prev_ = 0;
+      waiter->next_ = head;
+      if (head) {
+         head->prev_ = waiter;
+      }
+      head = waiter;
+   }
+
+   void route_waiter_del(fib_route_waiter * waiter) {
+      if (waiter->prev_) {
+         waiter->prev_->next_ = waiter->next_;
+      } else if (waiter->next_) {
+         route_waiters_[waiter->route_key_] = waiter->next_;
+      } else {
+         route_waiters_.erase(waiter->route_key_);
+      }
+      if (waiter->next_) {
+         waiter->next_->prev_ = waiter->prev_;
+      }
+      waiter->prev_ = 0;
+      waiter->next_ = 0;
+   }
+
+   // Calls the waiters of the route.  Waiters are disarmed before being
+   // called and may wait again or cancel others, so restart from the head
+   // after each one, skipping those armed after we started.
+   void wake_route_waiters(fib_route_t const & route) {
+      if (route_waiters_.empty()) {
+         return;
+      }
+      uint64_t seq_limit = route_waiter_seq_;
+      for (;;) {
+         auto head = route_waiters_.find(route.route_key());
+         if (head == route_waiters_.end()) {
+            return;
+         }
+         fib_route_waiter * waiter = head->second;
+         while (waiter && waiter->seq_ >= seq_limit) {
+            waiter = waiter->next_;
+         }
+         if (!waiter) {
+            return;
+         }
+         route_waiter_del(waiter);
+         waiter->mgr_ = 0;
+         loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, waiter);
+         waiter->on_route_set(route);
+      }
+   }
+
+   // Holds the change back for the handlers that batch or conflate it
+   // before the others run, so that a handler changing how it gets the
+   // changes from there waits for the batches to be delivered.
+   void notify_route_set(fib_route_t const & route) {
+      if (deliveries_.batched() || deliveries_.conflated()) {
+         flush_pending();
+      }
+      if (deliveries_.batched()) {
+         pending_routes_.set(route);
+      }
+      if (deliveries_.conflated()) {
+         conflated_routes_.changed(route.route_key());
+      }
+      if (deliveries_.now()) {
+         notifying_++;
+         handler_foreach([&](handler_t * handler) {
+            if (deliveries_.delivery(handler) == DELIVER_NOW) {
+               loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER,
+                                      handler);
+               handler->on_route_set(route);
+            }
+         });
+         notifying_--;
+         apply_deliveries();
+      }
+      wake_route_waiters(route);
+   }
+
+   // Has the pending batches flushed, when the first change goes into them.
+   void flush_pending() {
+      if (pending_routes_.empty() && conflated_routes_.empty()) {
+         impl.flush_is(this);
+      }
+   }
+
+   // Switches the handlers that asked to while changes were held back, once
+   // those are delivered.
+   void apply_deliveries() {
+      if (!held_back()) {
+         deliveries_.apply();
+      }
+   }
+
+   // Returns true if changes are held back for some handlers, or being
+   // delivered to them.
+   bool held_back() const {
+      return notifying_ || !pending_routes_.empty() || !conflated_routes_.empty();
+   }
+
+   snapshot_table<fib_route_key_t, fib_route_t> routes_;
+   snapshot_table<fib_fec_key_t, fib_fec_t> fecs_;
+   notification_batch<fib_route_t, fib_route_key_t> pending_routes_;
+   // The batch being delivered, while the handlers add to the pending one.
+   notification_batch<fib_route_t, fib_route_key_t> delivering_routes_;
+   // The routes changed, for the handlers that conflate them.
+   conflated_batch<fib_route_t, fib_route_key_t> conflated_routes_;
+   // How each handler gets the route changes.
+   handler_deliveries<handler_t> deliveries_;
+   // How many notifications of the handlers are running, nested.
+   unsigned notifying_;
+   // The first of the waiters of each route waited for.
+   std::unordered_map<fib_route_key_t, fib_route_waiter *, sdk_hash>
+      route_waiters_;
+   uint64_t route_waiter_seq_;
 };
 
+bool
+fib_mgr::fib_fec_set_moved(fib_fec_t & fec) {
+   // Binds to the const reference overload: managers that keep the FEC
+   // override this one to move it in.
+   return fib_fec_set(fec);
+}
+
+bool
+fib_mgr::fib_route_set_moved(fib_route_t & route) {
+   return fib_route_set(route);
+}
+
+void
+fib_mgr::route_batches_is(fib_handler * handler, bool batches) {
+}
+
+bool
+fib_mgr::route_batches(fib_handler const * handler) const {
+   return false;
+}
+
+void
+fib_mgr::route_conflation_is(fib_handler * handler, bool conflation) {
+}
+
+bool
+fib_mgr::route_conflation(fib_handler const * handler) const {
+   return false;
+}
+
+uint64_t
+fib_mgr::route_changes_conflated(fib_handler const * handler) const {
+   return 0;
+}
+
+void
+fib_mgr::route_waiter_add(fib_route_waiter * waiter) {
+   panic(unsupported_error("This fib_mgr doesn't support route waiters"));
+}
+
+void
+fib_mgr::route_waiter_del(fib_route_waiter * waiter) {
+   panic(unsupported_error("This fib_mgr doesn't support route waiters"));
+}
+
+std::vector<fib_route_iter_t>
+fib_mgr::fib_route_iters(size_t count) const {
+   return std::vector<fib_route_iter_t>(1, fib_route_iter());
+}
+
 DEFINE_STUB_MGR_CTOR(fib_mgr)
 
 fib_handler::fib_handler(fib_mgr *mgr) : 
       base_handler<fib_mgr, fib_handler>(mgr) {
+   mgr_->add_handler(this);
+}
+
+fib_route_waiter::fib_route_waiter() : mgr_(0), prev_(0), next_(0), seq_(0) {
+}
+
+fib_route_waiter::~fib_route_waiter() {
+   cancel();
+}
+
+void
+fib_route_waiter::wait_route(fib_mgr * mgr, fib_route_key_t const & route_key) {
+   cancel();
+   route_key_ = route_key;
+   mgr->route_waiter_add(this);
+   mgr_ = mgr;
+}
+
+void
+fib_route_waiter::cancel() {
+   if (mgr_) {
+      mgr_->route_waiter_del(this);
+      mgr_ = 0;
+   }
+}
+
+bool
+fib_route_waiter::waiting() const {
+   return mgr_ != 0;
 }
 
 void fib_handler::on_route_set(fib_route_t const&) {
@@ -87,4 +429,17 @@ void fib_handler::on_fec_set(fib_fec_t const&) {
 void fib_handler::on_fec_del(fib_fec_key_t const&) {
 }
 
+void fib_handler::on_route_set_batch(fib_route_t const * routes, size_t count) {
+   for (size_t i = 0; i < count; ++i) {
+      on_route_set(routes[i]);
+   }
+}
+
+void fib_handler::on_route_del_batch(fib_route_key_t const * route_keys,
+                                     size_t count) {
+   for (size_t i = 0; i < count; ++i) {
+      on_route_del(route_keys[i]);
+   }
+}
+
 } // namespace DA
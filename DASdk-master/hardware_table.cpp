@@ -3,6 +3,7 @@
 
 #include "DA/hardware_table.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -16,8 +17,7 @@ class hardware_table_mgr_impl : public hardware_table_mgr {
    }
 
    virtual hardware_table_iter_t hardware_table_iter() const {
-      hardware_table_iter_t * nop = 0;
-      return *nop;
+      return hardware_table_iter_impl::iter();
    }
    
    virtual hardware_table_usage_t usage(hardware_table_key_t const & key) const {
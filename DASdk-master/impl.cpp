@@ -3,85 +3,1036 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <cxxabi.h>  // for abi::__cxa_demangle()
+#include <cstdlib>  // for getenv()
+#include <cstring>  // for strcmp() and strerror()
 #include <ctime>  // for time_t
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/select.h>
 #include <sys/time.h>  // for struct timeval
+#include <unistd.h>  // for close(), read() and write()
 
 #include "impl.h"
+#include "DA/exception.h"
 #include "DA/panic.h"
+#include "DA/agent.h"
 #include "DA/sdk.h"
 
 namespace DA {
 
 Impl impl;
 
+static struct timeval to_timeval(seconds_t time) {
+   struct timeval tv;
+   tv.tv_sec = time_t(time);
+   tv.tv_usec = suseconds_t((time - tv.tv_sec) * 1000000.0 + 0.5);
+   return tv;
+}
+
+void
+fd_handler_sm::interest_is(int fd, bool want, interest_t interest) {
+   if(want) {
+      fds_[fd] = fds_[fd] | interest;
+   } else {
+      fds_[fd] = fds_[fd] & ~interest;
+      if(!fds_[fd]) {
+         fds_.erase(fd);
+      }
+   }
+}
+
 void
-fd_handler_sm::update_fd_set(int & maxfd,
-                             fd_set * readfds,
-                             fd_set * writefds,
-                             fd_set * exceptfds) {
+select_poller::interest_is(int fd, uint8_t interest) {
+   if(interest) {
+      if(fd >= FD_SETSIZE) {
+         panic("Can't watch fd %d with select(), FD_SETSIZE is %d",
+               fd, FD_SETSIZE);
+      }
+      fds_[fd] = interest;
+   } else {
+      fds_.erase(fd);
+   }
+}
+
+int
+select_poller::wait(struct timeval * timeout, std::vector<fd_event> & ready) {
+   int maxfd = 0;
+   fd_set readfds;
+   FD_ZERO(&readfds);
+   fd_set writefds;
+   FD_ZERO(&writefds);
+   fd_set exceptfds;
+   FD_ZERO(&exceptfds);
+
    for(auto i = fds_.begin(); i != fds_.end(); i++) {
       int fd = i->first;
       if(fd > maxfd) {
          maxfd = fd;
       }
       uint8_t flags = i->second;
-      if (flags & WANT_READ) {
-         FD_SET(fd, readfds);
+      if (flags & fd_handler_sm::WANT_READ) {
+         FD_SET(fd, &readfds);
       }
-      if (flags & WANT_WRITE) {
-         FD_SET(fd, writefds);
+      if (flags & fd_handler_sm::WANT_WRITE) {
+         FD_SET(fd, &writefds);
       }
-      if (flags & WANT_EXCEPT) {
-         FD_SET(fd, exceptfds);
+      if (flags & fd_handler_sm::WANT_EXCEPT) {
+         FD_SET(fd, &exceptfds);
       }
    }
+   maxfd++;
+
+   int rv = select(maxfd, &readfds, &writefds, &exceptfds, timeout);
+   if(rv <= 0) {
+      return rv;
+   }
+   for(auto i = fds_.begin(); i != fds_.end(); i++) {
+      int fd = i->first;
+      uint8_t events = 0;
+      if(FD_ISSET(fd, &readfds)) {
+         events |= fd_handler_sm::WANT_READ;
+      }
+      if(FD_ISSET(fd, &writefds)) {
+         events |= fd_handler_sm::WANT_WRITE;
+      }
+      if(FD_ISSET(fd, &exceptfds)) {
+         events |= fd_handler_sm::WANT_EXCEPT;
+      }
+      if(events) {
+         ready.push_back(fd_event{fd, events});
+      }
+   }
+   return rv;
+}
+
+static uint32_t to_epoll_events(uint8_t interest) {
+   uint32_t events = 0;
+   if(interest & fd_handler_sm::WANT_READ) {
+      events |= EPOLLIN;
+   }
+   if(interest & fd_handler_sm::WANT_WRITE) {
+      events |= EPOLLOUT;
+   }
+   if(interest & fd_handler_sm::WANT_EXCEPT) {
+      events |= EPOLLPRI;
+   }
+   return events;
+}
+
+// Translates what epoll reported into what select() would have reported:
+// errors and hang-ups make a FD both readable and writable.
+static uint8_t from_epoll_events(uint32_t events) {
+   uint8_t interest = 0;
+   if(events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+      interest |= fd_handler_sm::WANT_READ;
+   }
+   if(events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+      interest |= fd_handler_sm::WANT_WRITE;
+   }
+   if(events & EPOLLPRI) {
+      interest |= fd_handler_sm::WANT_EXCEPT;
+   }
+   return interest;
+}
+
+epoll_poller::epoll_poller() : epfd_(epoll_create1(EPOLL_CLOEXEC)),
+                               registered_(0) {
+   if(epfd_ == -1) {
+      panic("epoll_create1() failed: %s", strerror(errno));
+   }
+}
+
+epoll_poller::~epoll_poller() {
+   close(epfd_);
 }
 
 void
-fd_handler_sm::interest_is(int fd, bool want, interest_t interest) {
-   if(want) {
-      fds_[fd] = fds_[fd] | interest;
-   } else {
-      fds_[fd] = fds_[fd] & ~interest;
-      if(!fds_[fd]) {
-         fds_.erase(fd);
+epoll_poller::interest_is(int fd, uint8_t interest) {
+   uint8_t previous = size_t(fd) < fds_.size() ? fds_[fd] : 0;
+   if(!interest) {
+      always_ready_.erase(fd);
+      if(previous) {
+         fds_[fd] = 0;
+         registered_--;
+         // The FD may have been closed already, in which case the kernel has
+         // dropped it from the epoll set on its own, so ignore errors here.
+         epoll_ctl(epfd_, EPOLL_CTL_DEL, fd, 0);
+      }
+      return;
+   }
+   if(always_ready_.find(fd) != always_ready_.end()) {
+      always_ready_[fd] = interest;
+      return;
+   }
+   if(previous == interest) {
+      return;  // Nothing changed.
+   }
+
+   struct epoll_event ev;
+   ev.events = to_epoll_events(interest);
+   ev.data.fd = fd;
+   int op = previous ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+   int rv = epoll_ctl(epfd_, op, fd, &ev);
+   if(rv == -1 && op == EPOLL_CTL_MOD && errno == ENOENT) {
+      // The FD was closed and re-opened behind our back, register it again.
+      rv = epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev);
+   }
+   if(rv == -1) {
+      if(errno == EPERM) {  // Regular files and the like.
+         if(previous) {
+            fds_[fd] = 0;
+            registered_--;
+         }
+         always_ready_[fd] = interest;
+         return;
+      }
+      panic("epoll_ctl() failed on fd %d: %s", fd, strerror(errno));
+   }
+   if(size_t(fd) >= fds_.size()) {
+      fds_.resize(fd + 1);
+   }
+   if(!previous) {
+      registered_++;
+   }
+   fds_[fd] = interest;
+}
+
+void
+epoll_poller::interest_rearm(int fd, uint8_t interest) {
+   uint8_t previous = size_t(fd) < fds_.size() ? fds_[fd] : 0;
+   if(!interest || !previous) {
+      interest_is(fd, interest);
+      return;
+   }
+   // We think the FD is registered, but if it was closed and re-opened since,
+   // the kernel dropped it from the epoll set, so add it again.
+   struct epoll_event ev;
+   ev.events = to_epoll_events(interest);
+   ev.data.fd = fd;
+   int rv = epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev);
+   if(rv == -1 && errno == EEXIST) {
+      rv = epoll_ctl(epfd_, EPOLL_CTL_MOD, fd, &ev);
+   }
+   if(rv == -1) {
+      if(errno == EPERM) {  // Re-opened as a regular file.
+         fds_[fd] = 0;
+         registered_--;
+         always_ready_[fd] = interest;
+         return;
+      }
+      panic("epoll_ctl() failed on fd %d: %s", fd, strerror(errno));
+   }
+   fds_[fd] = interest;
+}
+
+int
+epoll_poller::wait(struct timeval * timeout, std::vector<fd_event> & ready) {
+   int timeout_ms = -1;
+   if(!always_ready_.empty()) {
+      timeout_ms = 0;
+   } else if(timeout) {
+      // Round up, so we never wake up before the deadline.
+      timeout_ms = int(timeout->tv_sec * 1000 + (timeout->tv_usec + 999) / 1000);
+   }
+   if(events_.size() < registered_ + 1) {
+      events_.resize(registered_ + 1);
+   }
+
+   int rv = epoll_wait(epfd_, &events_[0], int(events_.size()), timeout_ms);
+   if(rv < 0) {
+      return rv;
+   }
+   for(int i = 0; i < rv; i++) {
+      int fd = events_[i].data.fd;
+      // Only report what was asked for, like select() does.
+      if(size_t(fd) >= fds_.size()) {
+         continue;
+      }
+      uint8_t events = from_epoll_events(events_[i].events) & fds_[fd];
+      if(!events && (events_[i].events & (EPOLLHUP | EPOLLERR))) {
+         // epoll reports hang-ups and errors whether they were asked for or
+         // not, and keeps doing so.  Hand them to the watchers as whatever
+         // they're waiting for (e.g. WANT_EXCEPT) rather than spin on them.
+         events = fds_[fd];
+      }
+      if(events) {
+         ready.push_back(fd_event{fd, events});
+      }
+   }
+   for(auto i = always_ready_.begin(); i != always_ready_.end(); i++) {
+      ready.push_back(fd_event{i->first, i->second});
+   }
+   return rv + int(always_ready_.size());
+}
+
+void
+external_poller::interest_is(int fd, uint8_t interest) {
+   auto it = fds_.find(fd);
+   uint8_t previous = it == fds_.end() ? 0 : it->second;
+   uint8_t changed = previous ^ interest;
+   if(changed & fd_handler_sm::WANT_READ) {
+      loop_->watch_readable(fd, interest & fd_handler_sm::WANT_READ);
+   }
+   if(changed & fd_handler_sm::WANT_WRITE) {
+      loop_->watch_writable(fd, interest & fd_handler_sm::WANT_WRITE);
+   }
+   if(changed & fd_handler_sm::WANT_EXCEPT) {
+      loop_->watch_exception(fd, interest & fd_handler_sm::WANT_EXCEPT);
+   }
+   if(interest) {
+      fds_[fd] = interest;
+   } else if(it != fds_.end()) {
+      fds_.erase(it);
+   }
+}
+
+int
+external_poller::wait(struct timeval * timeout, std::vector<fd_event> & ready) {
+   std::vector<struct pollfd> pfds;
+   pfds.reserve(fds_.size());
+   for(auto i = fds_.begin(); i != fds_.end(); i++) {
+      struct pollfd pfd;
+      pfd.fd = i->first;
+      pfd.events = 0;
+      pfd.revents = 0;
+      if(i->second & fd_handler_sm::WANT_READ) {
+         pfd.events |= POLLIN;
+      }
+      if(i->second & fd_handler_sm::WANT_WRITE) {
+         pfd.events |= POLLOUT;
       }
+      if(i->second & fd_handler_sm::WANT_EXCEPT) {
+         pfd.events |= POLLPRI;
+      }
+      pfds.push_back(pfd);
+   }
+   int timeout_ms = -1;
+   if(timeout) {
+      timeout_ms = int(timeout->tv_sec * 1000 + (timeout->tv_usec + 999) / 1000);
+   }
+   int rv = poll(pfds.empty() ? 0 : &pfds[0], pfds.size(), timeout_ms);
+   if(rv <= 0) {
+      return rv;
    }
+   for(auto i = pfds.begin(); i != pfds.end(); i++) {
+      uint8_t events = 0;
+      if(i->revents & (POLLIN | POLLHUP | POLLERR)) {
+         events |= fd_handler_sm::WANT_READ;
+      }
+      if(i->revents & (POLLOUT | POLLHUP | POLLERR)) {
+         events |= fd_handler_sm::WANT_WRITE;
+      }
+      if(i->revents & POLLPRI) {
+         events |= fd_handler_sm::WANT_EXCEPT;
+      }
+      events &= fds_[i->fd];
+      if(!events && (i->revents & (POLLHUP | POLLERR))) {
+         events = fds_[i->fd];  // Don't spin on an unwanted hang-up.
+      }
+      if(events) {
+         ready.push_back(fd_event{i->fd, events});
+      }
+   }
+   return rv;
+}
+
+void
+timer_queue::sift_up(size_t index) {
+   timer * moving = heap_[index];
+   while (index > 0) {
+      size_t parent = (index - 1) / 2;
+      if (!before(moving, heap_[parent])) {
+         break;
+      }
+      place(heap_[parent], index);
+      index = parent;
+   }
+   place(moving, index);
+}
+
+void
+timer_queue::sift_down(size_t index) {
+   timer * moving = heap_[index];
+   size_t size = heap_.size();
+   for (;;) {
+      size_t child = 2 * index + 1;
+      if (child >= size) {
+         break;
+      }
+      if (child + 1 < size && before(heap_[child + 1], heap_[child])) {
+         child++;
+      }
+      if (!before(heap_[child], moving)) {
+         break;
+      }
+      place(heap_[child], index);
+      index = child;
+   }
+   place(moving, index);
 }
 
 void
 timer_queue::update(timer * timer) {
    if (timer->timeout() == never) {
-      // Remove the timer from the list.  Don't use erase() because it's O(N).
-      auto it = std::find(c.begin(), c.end(), timer);
-      if (it == c.end()) {
-         return;  // We weren't in the list, so nothing to do.
+      remove(timer);
+      return;
+   }
+   timer->seq_ = next_seq_++;
+   if (!timer->scheduled()) {  // Append at the bottom and bubble up.  O(log N)
+      heap_.push_back(timer);
+      sift_up(heap_.size() - 1);
+   } else {  // Already in the heap, move it up or down.  O(log N)
+      size_t index = timer->index_;
+      if (index > 0 && before(timer, heap_[(index - 1) / 2])) {
+         sift_up(index);
+      } else {
+         sift_down(index);
       }
-      // Swap the one we want to remove with the last one, and pop back.  O(1)
-      std::swap(*it, c.back());
-      c.pop_back();
    }
-   // Re-sort our vector into a min-heap.  O(3N) = O(N).
-   std::make_heap(c.begin(), c.end(), comp);
+}
+
+void
+timer_queue::remove(timer * timer) {
+   timer->timeout_is(never);
+   if (!timer->scheduled()) {
+      return;  // We weren't in the heap, so nothing to do.
+   }
+   size_t index = timer->index_;
+   timer->index_ = timer::npos;
+   class timer * last = heap_.back();
+   heap_.pop_back();
+   if (last == timer) {
+      return;  // We were the last one, nothing to re-order.
+   }
+   // Move the last one in the hole we left and restore the heap.  O(log N)
+   place(last, index);
+   if (index > 0 && before(last, heap_[(index - 1) / 2])) {
+      sift_up(index);
+   } else {
+      sift_down(index);
+   }
 }
 
 void Impl::timeout_is(timeout_handler * handler, seconds_t timeout) {
    timer& timer = timeout_to_timer_[handler];
-   seconds_t previous = timer.timeout();
    timer.timeout_is(timeout);
-   if (previous == never) {    // If we weren't previously scheduled...
-      timers_.push(&timer);    // ... then add ourself to the min-heap.
-   } else {                    // Otherwise, we were already scheduled...
-      timers_.update(&timer);  // ... so we need to adjust our position.
+   timers_.update(&timer);
+   sync_external_timeout();
+}
+
+void Impl::run_timers(seconds_t current) {
+   // Only fire timers that were armed before we started, so that a handler
+   // re-arming itself with a deadline in the past can't starve the loop.
+   uint64_t seq_limit = timers_.next_seq();
+   while (!timers_.empty()) {
+      timer * next_timer = timers_.top();
+      if (next_timer->timeout() > current
+          || !timer_queue::armed_before(next_timer, seq_limit)) {
+         break;
+      }
+      loop_stats * stats = next_timer->cancelled() ? 0 : this->stats();
+      if(stats) {
+         stats->record(LOOP_STAT_TIMER_LATENESS, 0,
+                       now() - next_timer->timeout());
+      }
+      timeout_handler * handler = next_timer->handler();
+      loop_stats_probe probe(stats, handler ? LOOP_STAT_TIMEOUT_HANDLER
+                                            : LOOP_STAT_TIMER_CALLBACK, handler);
+      // Unset the timer before calling the handler, so it can re-arm itself.
+      timers_.pop();
+      next_timer->fire();
    }
 }
 
-static struct timeval to_timeval(seconds_t time) {
-   struct timeval tv;
-   tv.tv_sec = time_t(time);
-   tv.tv_usec = suseconds_t((time - tv.tv_sec) * 1000000.0 + 0.5);
-   return tv;
+void
+callback_timer::fire() {
+   impl_->fire_callback_timer(this);
+}
+
+timer_handle_t Impl::timer_start(seconds_t deadline, seconds_t interval,
+                                 timer_callback_t const & callback) {
+   if (deadline == never) {
+      panic(invalid_argument_error("deadline", "must not be never"));
+   }
+   if (interval < 0) {
+      panic(invalid_argument_error("interval", "must be positive"));
+   }
+   if (!callback) {
+      panic(invalid_argument_error("callback", "must not be empty"));
+   }
+   uint32_t slot;
+   if (free_callback_timers_.empty()) {
+      slot = uint32_t(callback_timers_.size());
+      callback_timers_.push_back(callback_timer());
+      callback_timers_.back().impl_ = this;
+      callback_timers_.back().slot_ = slot;
+   } else {
+      slot = free_callback_timers_.back();
+      free_callback_timers_.pop_back();
+   }
+   callback_timer & timer = callback_timers_[slot];
+   timer.callback_ = callback;
+   timer.deadline_ = deadline;
+   timer.interval_ = interval;
+   timer.state_ = callback_timer::ARMED;
+   timer.timeout_is(deadline);
+   timers_.update(&timer);
+   sync_external_timeout();
+   return timer_handle_t(slot, timer.generation_);
+}
+
+callback_timer *
+Impl::lookup_callback_timer(timer_handle_t const & handle) const {
+   if (handle.slot_ >= callback_timers_.size()) {
+      return 0;
+   }
+   callback_timer const & timer = callback_timers_[handle.slot_];
+   if (timer.generation_ != handle.generation_
+       || timer.state_ != callback_timer::ARMED) {
+      return 0;
+   }
+   return const_cast<callback_timer *>(&timer);
+}
+
+bool Impl::timer_pending(timer_handle_t const & handle) const {
+   return lookup_callback_timer(handle) != 0;
+}
+
+void Impl::timer_cancel(timer_handle_t const & handle) {
+   callback_timer * timer = lookup_callback_timer(handle);
+   if (!timer) {
+      return;  // Already fired or deleted.
+   }
+   timer->state_ = callback_timer::CANCELLED;
+   if (timer->firing_) {
+      return;  // fire_callback_timer() will release it once the callback returns.
+   }
+   timer->callback_ = timer_callback_t();  // Drop what the callback captured.
+   cancelled_timers_++;
+   // Don't let cancelled timers pile up in the queue: once they make up most
+   // of it, purge them all at once, which amortizes to O(1) per cancellation.
+   if (cancelled_timers_ > 64 && cancelled_timers_ > timers_.size() / 2) {
+      std::vector<callback_timer *> purged;
+      timers_.remove_if([&purged](class timer * t) {
+         if (!t->cancelled()) {
+            return false;
+         }
+         purged.push_back(static_cast<callback_timer *>(t));
+         return true;
+      });
+      for (auto i = purged.begin(); i != purged.end(); i++) {
+         release_callback_timer(*i);
+      }
+   }
+}
+
+void Impl::release_callback_timer(callback_timer * timer) {
+   if (timer->state_ == callback_timer::CANCELLED && !timer->firing_) {
+      cancelled_timers_--;
+   }
+   timer->callback_ = timer_callback_t();
+   timer->state_ = callback_timer::FREE;
+   timer->firing_ = false;
+   timer->generation_++;
+   if (!timer->generation_) {
+      timer->generation_ = 1;  // 0 is reserved for default-constructed handles.
+   }
+   free_callback_timers_.push_back(timer->slot_);
+}
+
+void Impl::fire_callback_timer(callback_timer * timer) {
+   if (timer->state_ == callback_timer::CANCELLED) {
+      release_callback_timer(timer);
+      return;
+   }
+   if (!timer->interval_) {
+      // One-shot: release the slot first so the handle is already stale if
+      // the callback looks at it, then run the callback we moved out.
+      timer_callback_t callback;
+      callback.swap(timer->callback_);
+      release_callback_timer(timer);
+      callback();
+      return;
+   }
+   timer->firing_ = true;
+   timer->callback_();
+   if (timer->state_ == callback_timer::CANCELLED) {  // Deleted itself.
+      release_callback_timer(timer);
+      return;
+   }
+   timer->firing_ = false;
+   seconds_t deadline = timer->deadline_ + timer->interval_;
+   seconds_t current = loop_time();
+   if (deadline <= current) {  // We fell behind, skip the missed periods.
+      deadline = current + timer->interval_;
+   }
+   timer->deadline_ = deadline;
+   timer->timeout_is(deadline);
+   timers_.update(timer);
+}
+
+thread_local Impl * Impl::current_ = 0;
+
+Impl::Impl() : shard_id_(0), initialized_(false), running_(false),
+               loop_depth_(0), loop_time_(0), in_iteration_(false), sdk_(0),
+               fd_waiter_seq_(0), poller_(0), external_loop_(0),
+               external_deadline_(never),
+               cancelled_timers_(0), stats_(0), stats_enabled_(false),
+               wakeup_fd_(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)),
+               wakeup_pending_(false), shards_(0) {
+   if(wakeup_fd_ == -1) {
+      panic("eventfd() failed: %s", strerror(errno));
+   }
+}
+
+Impl::Impl(uint32_t shard_id)
+      : shard_id_(shard_id), initialized_(true), running_(false),
+        loop_depth_(0), loop_time_(0), in_iteration_(false), sdk_(0),
+        fd_waiter_seq_(0), poller_(0), external_loop_(0),
+        external_deadline_(never),
+        cancelled_timers_(0), stats_(0), stats_enabled_(false),
+        wakeup_fd_(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)),
+        wakeup_pending_(false), shards_(0) {
+   if(wakeup_fd_ == -1) {
+      panic("eventfd() failed: %s", strerror(errno));
+   }
+}
+
+Impl::~Impl() {
+   std::vector<Impl *> const * shards = shards_.load(std::memory_order_acquire);
+   for(size_t i = 0; shards && i < shards->size(); i++) {
+      Impl * shard = (*shards)[i];
+      shard->post([shard]() { shard->stop_loop(); });
+      shard_threads_[i].join();
+      delete shard;
+   }
+   shards_.store(0, std::memory_order_release);
+   for(size_t i = 0; i < shard_tables_.size(); i++) {
+      delete shard_tables_[i];
+   }
+   shard_tables_.clear();
+   shard_threads_.clear();
+   delete poller_;
+   poller_ = 0;
+   delete stats_;
+   stats_ = 0;
+   close(wakeup_fd_);
+}
+
+Impl & Impl::current() {
+   return current_ ? *current_ : impl;
+}
+
+void Impl::shards_is(uint32_t count) {
+   if(this != &impl || &current() != this) {
+      panic("Shards can only be started from the main loop");
+   }
+   if(count < shards()) {
+      panic(invalid_argument_error("count", "shards can't be removed"));
+   }
+   if(count == shards()) {
+      return;
+   }
+   std::vector<Impl *> const * previous = shards_.load(std::memory_order_relaxed);
+   std::vector<Impl *> * shards = previous ? new std::vector<Impl *>(*previous)
+                                           : new std::vector<Impl *>();
+   shard_tables_.push_back(shards);
+   while(shards->size() + 1 < count) {
+      Impl * shard = new Impl(uint32_t(shards->size()) + 1);
+      shards->push_back(shard);
+      shard_threads_.push_back(std::thread(run_shard, shard));
+   }
+   shards_.store(shards, std::memory_order_release);
+}
+
+Impl * Impl::shard(uint32_t shard_id) {
+   std::vector<Impl *> const * shards = shards_.load(std::memory_order_acquire);
+   uint32_t count = shards ? uint32_t(shards->size()) + 1 : 1;
+   if(shard_id >= count) {
+      panic(invalid_range_error("shard", 0, count - 1));
+   }
+   return shard_id ? (*shards)[shard_id - 1] : this;
+}
+
+void Impl::run_shard(Impl * shard) {
+   current_ = shard;
+   shard->main_loop();
+}
+
+void Impl::post(std::function<void()> const & callback) {
+   posted_.push(callback);
+   wakeup();
+}
+
+void Impl::wakeup() {
+   // Only the first producer since the last drain needs to poke the eventfd,
+   // the others will be picked up along with it.
+   if(!wakeup_pending_.exchange(true)) {
+      uint64_t one = 1;
+      if(write(wakeup_fd_, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+         panic("write() to eventfd failed: %s", strerror(errno));
+      }
+   }
+}
+
+void Impl::run_posted() {
+   uint64_t count;
+   if(read(wakeup_fd_, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+      panic("read() from eventfd failed: %s", strerror(errno));
+   }
+   // Clear the flag before draining: anything pushed after this point either
+   // gets drained below or pokes the eventfd again.
+   wakeup_pending_.store(false);
+   // Don't let a flood of posts starve the rest of the loop: run a bounded
+   // batch and come back for the rest on the next iteration.
+   static const int max_batch = 1024;
+   std::function<void()> callback;
+   for(int i = 0; i < max_batch; i++) {
+      if(!posted_.pop(callback)) {
+         return;
+      }
+      loop_stats_probe probe(stats(), LOOP_STAT_POSTED_CALLBACK);
+      callback();
+   }
+   wakeup();
+}
+
+void Impl::flush_is(deferred_flush * flusher) {
+   flushes_.push_back(flusher);
+   if(!in_iteration_) {
+      wakeup();
+   }
+}
+
+void Impl::flush_del(deferred_flush * flusher) {
+   flushes_.erase(std::remove(flushes_.begin(), flushes_.end(), flusher),
+                  flushes_.end());
+}
+
+void Impl::run_flushes() {
+   // Changes the flushes cause are held back for another iteration, which
+   // flush_is() wakes us up for.
+   in_iteration_ = false;
+   std::vector<deferred_flush *> flushes;
+   flushes.swap(flushes_);
+   for(auto flusher = flushes.begin(); flusher != flushes.end(); flusher++) {
+      (*flusher)->flush();
+   }
+}
+
+post_queue::~post_queue() {
+   std::function<void()> callback;
+   while(pop(callback)) {
+   }
+}
+
+void
+post_queue::push(std::function<void()> const & callback) {
+   push(new node(callback));
+}
+
+void
+post_queue::push(node * n) {
+   n->next.store(0, std::memory_order_relaxed);
+   node * prev = head_.exchange(n, std::memory_order_acq_rel);
+   // Between the exchange above and the store below, the list is cut in two
+   // and pop() can't see `n' yet.
+   prev->next.store(n, std::memory_order_release);
+}
+
+bool
+post_queue::pop(std::function<void()> & callback) {
+   node * tail = tail_;
+   node * next = tail->next.load(std::memory_order_acquire);
+   if(tail == &stub_) {
+      if(!next) {
+         return false;
+      }
+      tail_ = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+   }
+   if(!next) {
+      if(tail != head_.load(std::memory_order_acquire)) {
+         return false;  // A producer is half way through push().
+      }
+      // `tail' is the last node: put the stub back behind it so we can
+      // take it out of the list.
+      push(&stub_);
+      next = tail->next.load(std::memory_order_acquire);
+      if(!next) {
+         return false;  // A producer is half way through push().
+      }
+   }
+   tail_ = next;
+   callback.swap(tail->callback);
+   delete tail;
+   return true;
+}
+
+poller * Impl::get_poller() {
+   if(!poller_) {
+      const char * backend = getenv("DA_SDK_POLLER");
+      if(backend && !strcmp(backend, "select")) {
+         poller_ = new select_poller();
+      } else {
+         poller_ = new epoll_poller();
+      }
+      poller_->interest_is(wakeup_fd_, fd_handler_sm::WANT_READ);
+   }
+   return poller_;
+}
+
+void Impl::unregister_fd_handler(fd_handler * handler) {
+   auto sm = fd_handlers_.find(handler);
+   if(sm == fd_handlers_.end()) {
+      return;
+   }
+   std::vector<int> fds;
+   for(auto i = sm->second.fd_set_begin(); i != sm->second.fd_set_end(); i++) {
+      fds.push_back(i->first);
+   }
+   fd_handlers_.erase(sm);
+   for(auto fd = fds.begin(); fd != fds.end(); fd++) {
+      auto watchers = fd_watchers_.find(*fd);
+      watchers->second.erase(handler);
+      if(watchers->second.empty()) {
+         fd_watchers_.erase(watchers);
+      }
+      update_fd_interest(*fd);
+   }
+}
+
+void Impl::watch_fd(fd_handler * handler, int fd, bool want,
+                    fd_handler_sm::interest_t interest) {
+   fd_handler_sm & sm = fd_handlers_.at(handler);
+   switch(interest) {
+      case fd_handler_sm::WANT_READ:
+         sm.watch_readable(fd, want);
+         break;
+      case fd_handler_sm::WANT_WRITE:
+         sm.watch_writable(fd, want);
+         break;
+      case fd_handler_sm::WANT_EXCEPT:
+         sm.watch_exception(fd, want);
+         break;
+   }
+   if(sm.interested_in(fd)) {
+      fd_watchers_[fd].insert(handler);
+   } else {
+      auto watchers = fd_watchers_.find(fd);
+      if(watchers != fd_watchers_.end()) {
+         watchers->second.erase(handler);
+         if(watchers->second.empty()) {
+            fd_watchers_.erase(watchers);
+         }
+      }
+   }
+   if(want) {
+      // The FD may be a new one re-using the number of one we were watching.
+      get_poller()->interest_rearm(fd, fd_interest(fd));
+   } else {
+      update_fd_interest(fd);
+   }
+}
+
+void Impl::arm_fd_waiter(fd_waiter * waiter, int fd,
+                         fd_handler_sm::interest_t interest) {
+   if(fd < 0) {
+      panic(invalid_argument_error("fd", "must not be negative"));
+   }
+   if(waiter->interest_) {
+      if(waiter->fd_ == fd && waiter->interest_ == interest) {
+         return;  // Already waiting for this.
+      }
+      disarm_fd_waiter(waiter);
+   }
+   if(size_t(fd) >= fd_waiters_.size()) {
+      fd_waiters_.resize(fd + 1);
+   }
+   waiter->fd_ = fd;
+   waiter->interest_ = uint8_t(interest);
+   waiter->seq_ = fd_waiter_seq_++;
+   waiter->prev_ = 0;
+   waiter->next_ = fd_waiters_[fd];
+   if(waiter->next_) {
+      waiter->next_->prev_ = waiter;
+   }
+   fd_waiters_[fd] = waiter;
+   update_fd_interest(fd);
+}
+
+void Impl::disarm_fd_waiter(fd_waiter * waiter) {
+   if(!waiter->interest_) {
+      return;
+   }
+   int fd = waiter->fd_;
+   unlink_fd_waiter(waiter);
+   update_fd_interest(fd);
+}
+
+void Impl::unlink_fd_waiter(fd_waiter * waiter) {
+   if(waiter->prev_) {
+      waiter->prev_->next_ = waiter->next_;
+   } else {
+      fd_waiters_[waiter->fd_] = waiter->next_;
+   }
+   if(waiter->next_) {
+      waiter->next_->prev_ = waiter->prev_;
+   }
+   waiter->prev_ = 0;
+   waiter->next_ = 0;
+   waiter->interest_ = 0;
+}
+
+uint8_t Impl::fd_interest(int fd) const {
+   uint8_t interest = 0;
+   auto watchers = fd_watchers_.find(fd);
+   if(watchers != fd_watchers_.end()) {
+      for(auto handler = watchers->second.begin();
+          handler != watchers->second.end(); handler++) {
+         interest |= fd_handlers_.at(*handler).interest(fd);
+      }
+   }
+   if(size_t(fd) < fd_waiters_.size()) {
+      for(fd_waiter * w = fd_waiters_[fd]; w; w = w->next_) {
+         interest |= w->interest_;
+      }
+   }
+   return interest;
+}
+
+void Impl::update_fd_interest(int fd) {
+   get_poller()->interest_is(fd, fd_interest(fd));
+}
+
+void Impl::external_loop_is(event_loop_handler * loop) {
+   std::lock_guard<std::recursive_mutex> sdk_lock(sdk_mutex_);
+   if(!initialized_) {
+      do_initialize();
+      initialized_ = true;
+   }
+   // Move all our registrations over to the new loop.
+   poller * previous = get_poller();
+   poller * external = new external_poller(loop);
+   previous->interest_is(wakeup_fd_, 0);
+   external->interest_is(wakeup_fd_, fd_handler_sm::WANT_READ);
+   for(auto i = fd_watchers_.begin(); i != fd_watchers_.end(); i++) {
+      previous->interest_is(i->first, 0);
+      external->interest_is(i->first, fd_interest(i->first));
+   }
+   for(size_t fd = 0; fd < fd_waiters_.size(); fd++) {
+      if(fd_waiters_[fd] && fd_watchers_.find(int(fd)) == fd_watchers_.end()) {
+         previous->interest_is(int(fd), 0);
+         external->interest_is(int(fd), fd_interest(int(fd)));
+      }
+   }
+   delete previous;
+   poller_ = external;
+   external_loop_ = loop;
+   external_deadline_ = never;
+   sync_external_timeout();
+}
+
+void Impl::external_fd_event(int fd, uint8_t events) {
+   std::lock_guard<std::recursive_mutex> sdk_lock(sdk_mutex_);
+   loop_scope scope(this);
+   loop_time_ = now();
+   loop_stats_probe iteration(stats(), LOOP_STAT_ITERATION);
+   in_iteration_ = true;
+   if(fd == wakeup_fd_) {
+      run_posted();
+   } else {
+      dispatch_fd_event(fd_event{fd, events});
+   }
+   run_timers(loop_time_);
+   run_flushes();
+   sync_external_timeout();
+}
+
+void Impl::external_timeout() {
+   std::lock_guard<std::recursive_mutex> sdk_lock(sdk_mutex_);
+   loop_scope scope(this);
+   loop_time_ = now();
+   loop_stats_probe iteration(stats(), LOOP_STAT_ITERATION);
+   external_deadline_ = never;  // The external loop's timer just fired.
+   in_iteration_ = true;
+   run_timers(loop_time_);
+   run_flushes();
+   sync_external_timeout();
+}
+
+void Impl::sync_external_timeout() {
+   if(!external_loop_ || timers_.empty()) {
+      return;
+   }
+   seconds_t deadline = timers_.top()->timeout();
+   if(deadline == external_deadline_) {
+      return;
+   }
+   external_deadline_ = deadline;
+   seconds_t delay = deadline - now();
+   if(delay < 0) {
+      delay = 0;
+   }
+   external_loop_->timeout_time_is(to_timeval(delay));
+}
+
+void Impl::dispatch_fd_event(fd_event const & event) {
+   int fd = event.fd;
+   if(size_t(fd) < fd_waiters_.size() && fd_waiters_[fd]) {
+      // Waiters are disarmed before being notified and may re-arm themselves
+      // or others, so restart from the head after each one, skipping those
+      // armed after we started.  The interest is only pushed down to the
+      // poller once we're done, so that a waiter re-arming itself right away
+      // doesn't cost any system call.
+      uint64_t seq_limit = fd_waiter_seq_;
+      for(;;) {
+         fd_waiter * waiter = fd_waiters_[fd];
+         while(waiter && (waiter->seq_ >= seq_limit
+                          || !(waiter->interest_ & event.events))) {
+            waiter = waiter->next_;
+         }
+         if(!waiter) {
+            break;
+         }
+         unlink_fd_waiter(waiter);
+         loop_stats_probe probe(stats(), LOOP_STAT_FD_HANDLER, waiter);
+         waiter->on_ready(fd);
+      }
+      update_fd_interest(fd);
+   }
+   auto watchers = fd_watchers_.find(fd);
+   if(watchers == fd_watchers_.end()) {
+      return;  // Nobody's interested anymore.
+   }
+   // Callbacks may change interests or delete handlers, so work on a copy and
+   // check that each handler still wants the event before notifying it.
+   std::vector<fd_handler *> handlers(watchers->second.begin(),
+                                      watchers->second.end());
+   for(auto i = handlers.begin(); i != handlers.end(); i++) {
+      fd_handler * handler = *i;
+      auto sm = fd_handlers_.find(handler);
+      if(sm != fd_handlers_.end() && (event.events & fd_handler_sm::WANT_READ)
+         && sm->second.want_readable(fd)) {
+         loop_stats_probe probe(stats(), LOOP_STAT_FD_HANDLER, handler);
+         handler->on_readable(fd);
+      }
+      sm = fd_handlers_.find(handler);
+      if(sm != fd_handlers_.end() && (event.events & fd_handler_sm::WANT_WRITE)
+         && sm->second.want_writable(fd)) {
+         loop_stats_probe probe(stats(), LOOP_STAT_FD_HANDLER, handler);
+         handler->on_writable(fd);
+      }
+      sm = fd_handlers_.find(handler);
+      if(sm != fd_handlers_.end() && (event.events & fd_handler_sm::WANT_EXCEPT)
+         && sm->second.want_exception(fd)) {
+         loop_stats_probe probe(stats(), LOOP_STAT_FD_HANDLER, handler);
+         handler->on_exception(fd);
+      }
+   }
 }
 
 void Impl::agent_name_is(const char * agent_name) {
@@ -95,11 +1046,92 @@ void Impl::do_initialize() {
    handle_agent_initialize(sdk_->get_agent_mgr());
 }
 
+void Impl::stats_enabled_is(bool enabled) {
+   if(enabled && !stats_enabled_) {
+      // Start over, throwing away what we recorded last time we were on.
+      if(stats_) {
+         *stats_ = loop_stats();
+      } else {
+         stats_ = new loop_stats();
+      }
+   }
+   stats_enabled_ = enabled;
+}
+
+loop_histogram_t Impl::stat(loop_stat_t stat) const {
+   if(stat < 0 || stat >= num_loop_stats) {
+      panic(invalid_range_error("stat", 0, num_loop_stats - 1));
+   }
+   return stats_ ? stats_->stats[stat] : loop_histogram_t();
+}
+
+// Returns the human readable name of a class.
+static std::string class_name(std::type_index type) {
+   int status;
+   char * demangled = abi::__cxa_demangle(type.name(), 0, 0, &status);
+   if(!demangled) {
+      return type.name();
+   }
+   std::string name(demangled);
+   free(demangled);
+   return name;
+}
+
+std::map<std::string, loop_histogram_t> Impl::handler_stats() const {
+   std::map<std::string, loop_histogram_t> result;
+   if(stats_) {
+      for(auto i = stats_->handlers.begin(); i != stats_->handlers.end(); i++) {
+         result[class_name(i->first)] = i->second;
+      }
+   }
+   return result;
+}
+
+void Impl::stats_status_interval_is(seconds_t interval) {
+   timer_cancel(stats_status_timer_);
+   stats_status_timer_ = timer_handle_t();
+   if(interval > 0) {
+      stats_status_timer_ = timer_start(now() + interval, interval,
+                                        [this]() { publish_stats(); });
+   }
+}
+
+void Impl::publish_stats() {
+   if(!stats_enabled_ || !sdk_) {
+      return;
+   }
+   static const char * const names[num_loop_stats] = {
+      "loop.timer_lateness",
+      "loop.iteration",
+      "loop.fd_handler",
+      "loop.timeout_handler",
+      "loop.timer_callback",
+      "loop.posted_callback",
+      "loop.mgr_handler",
+   };
+   agent_mgr * mgr = sdk_->get_agent_mgr();
+   for(int i = 0; i < num_loop_stats; i++) {
+      mgr->status_set(names[i], stats_->stats[i].to_string());
+   }
+   std::map<std::string, loop_histogram_t> handlers = handler_stats();
+   for(auto i = handlers.begin(); i != handlers.end(); i++) {
+      mgr->status_set("loop.handler." + i->first, i->second.to_string());
+   }
+}
+
 void Impl::stop_loop() {
    running_ = false;
 }
 
 void Impl::main_loop(seconds_t duration) {
+   // The main loop holds the SDK lock while it runs handlers, and only
+   // releases it while it waits, see sdk_scoped_lock.  Shards don't run any
+   // of the SDK's managers, so they don't need it.
+   std::unique_lock<std::recursive_mutex> sdk_lock(sdk_mutex_, std::defer_lock);
+   if(!shard_id_) {
+      sdk_lock.lock();
+   }
+
    if(!initialized_) {
       do_initialize();
       initialized_ = true;
@@ -112,33 +1144,25 @@ void Impl::main_loop(seconds_t duration) {
       loop_end = 0;  // Never end.
    }
 
+   loop_scope scope(this);
+   std::vector<fd_event> ready;
+   ready.swap(ready_);  // A nested loop starts with an empty one.
    running_ = true;
    while(running_) {
-      int maxfd = 0;
-      fd_set readfds;
-      FD_ZERO(&readfds);
-      fd_set writefds;
-      FD_ZERO(&writefds);
-      fd_set exceptfds;
-      FD_ZERO(&exceptfds);
-
-      for(auto handler = fd_handlers_.begin();
-          handler != fd_handlers_.end(); handler++) {
-         handler->second.update_fd_set(maxfd, &readfds, &writefds, &exceptfds);
-      }
-      maxfd++;
-
+      // Read the clock once before going to sleep, and once when waking up.
+      // Everything else in this iteration works off `loop_time_'.
+      seconds_t current = now();
       seconds_t next_deadline;  // Absolute point in time of our next deadline.
       seconds_t timeout_seconds;  // How long we're gonna sleep to get there.
-      timer * next_timer = 0;
       if(timers_.empty()) {
          next_deadline = never;
          timeout_seconds = 0;
       } else {
-         next_timer = timers_.top();
-         timers_.pop();
-         next_deadline = next_timer->timeout();
-         timeout_seconds = next_deadline - now();
+         next_deadline = timers_.top()->timeout();
+         timeout_seconds = next_deadline - current;
+         if (timeout_seconds < 0) {
+            timeout_seconds = 0;
+         }
       }
       // If this loop must eventually stop, check whether we need to stop
       // before the next timer fires.
@@ -152,19 +1176,29 @@ void Impl::main_loop(seconds_t duration) {
             // next timer then we must stop at that point instead of the timer.
             next_deadline = next_deadline < loop_end ? next_deadline : loop_end;
          }
-         timeout_seconds = next_deadline - now();
+         timeout_seconds = next_deadline - current;
          if (timeout_seconds < 0) {  // Can't have a negative timeout.
             timeout_seconds = 0;     // Tells select() to return immediately.
          }
       }
 
-      // Consider switching to epoll, but this doesn't matter for now.
       struct timeval timeout = to_timeval(timeout_seconds);
-      int rv = select(maxfd, &readfds, &writefds, &exceptfds,
-                      next_deadline == never ? 0 : &timeout);
+      ready.clear();
+      if(sdk_lock.owns_lock()) {
+         sdk_lock.unlock();
+      }
+      int rv = get_poller()->wait(next_deadline == never ? 0 : &timeout, ready);
+      // Saved before locking and reading the clock, which may clobber it.
+      int err = errno;
+      if(!shard_id_) {
+         sdk_lock.lock();
+      }
+      loop_time_ = now();
+      loop_stats_probe iteration(stats(), LOOP_STAT_ITERATION);
+      in_iteration_ = true;
 
-      if(rv < 0) {  // select() failed?
-         switch(errno) {
+      if(rv < 0) {  // select() / epoll_wait() failed?
+         switch(err) {
             case EINTR:
                break;  // Go straight to the point where we process timers.
             case EBADF:
@@ -173,52 +1207,31 @@ void Impl::main_loop(seconds_t duration) {
                panic("Programming bug, should never happen");
             case ENOMEM:
                panic("System out of memory");
+            default:
+               panic("Unhandled errno on poller failure: %d", err);
          }
-         panic("Unhandled errno on select() failure: %d", errno);
-      } else {  // select() succeeded.
-         // Process notifications: for each handler, check each FD it's
-         // interested in, and if the FD was select()ed, notify it.
-         for(auto handler_iter = fd_handlers_.begin();
-             handler_iter != fd_handlers_.end(); handler_iter++) {
-            auto handler = handler_iter->first;
-            auto sm = handler_iter->second;
-            for(auto fd_iter = sm.fd_set_begin();
-                fd_iter != sm.fd_set_end(); fd_iter++) {
-               int fd = fd_iter->first;
-               if(FD_ISSET(fd, &readfds) && sm.want_readable(fd)) {
-                  handler->on_readable(fd);
-               }
-               if(FD_ISSET(fd, &writefds) && sm.want_writable(fd)) {
-                  handler->on_writable(fd);
-               }
-               if(FD_ISSET(fd, &exceptfds) && sm.want_exception(fd)) {
-                  handler->on_exception(fd);
-               }
+      } else {  // The poller succeeded.
+         // Process notifications: only the FDs that are ready are visited.
+         for(auto event = ready.begin(); event != ready.end(); event++) {
+            if(event->fd == wakeup_fd_) {
+               run_posted();
+            } else {
+               dispatch_fd_event(*event);
             }
          }
       }
 
       // Process timers.
-      if(next_timer) {  // Do we have at least one outstanding timer?
-         if(now() >= next_deadline) {  // Our first timer has passed.
-            next_timer->handler()->on_timeout();
-            // We may have other timers that have passed too.
-            while(!timers_.empty()) {
-               next_timer = timers_.top();  // Grab the next timer.
-               if(next_timer->timeout() > now()) {  // Should it have fired already?
-                  break;  // No: stop here.
-               }  // Yes: trigger the callback, and continue.
-               timers_.pop();
-               next_timer->handler()->on_timeout();
-            }
-         } else {  // Our first timer needs to be rescheduled.
-            timers_.push(next_timer);
-         }
+      if(!timers_.empty()) {  // Do we have at least one outstanding timer?
+         run_timers(loop_time_);
       }
-      if(loop_end && loop_end <= now()) {
+      // Deliver the notifications held back during this iteration.
+      run_flushes();
+      if(loop_end && loop_end <= loop_time_) {
          break;
       }
    }
+   ready_.swap(ready);
 }
 
 }
@@ -4,14 +4,29 @@
 #ifndef DA_STUBS_IMPL_H
 #define DA_STUBS_IMPL_H
 
+#include <atomic>
+#include <deque>
+#include <functional>
 #include <list>
 #include <map>
+#include <mutex>
 #include <queue>
+#include <set>
 #include <string>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <sys/epoll.h>  // for struct epoll_event
 #include <sys/select.h>  // for fd_set
+#include <sys/time.h>  // for struct timeval
 
 #include "DA/agent.h"
+#include "DA/base_mgr.h"
+#include "DA/event_loop.h"
 #include "DA/fd.h"
 #include "DA/timer.h"
 
@@ -48,16 +63,22 @@ namespace DA {
  * with is interested in.
  */
 class fd_handler_sm {
+ public:
    enum interest_t {
       WANT_READ = 1 << 0,
       WANT_WRITE = 1 << 1,
       WANT_EXCEPT = 1 << 2,
    };
- public:
+
    /// Returns true if we're interested in this FD at all.
    bool interested_in(int fd) const {
       return fds_.find(fd) != fds_.end();
    }
+   /// Returns the set of interest_t bits we have for this FD (0 if none).
+   uint8_t interest(int fd) const {
+      auto it = fds_.find(fd);
+      return it == fds_.end() ? 0 : it->second;
+   }
 
    /// Sets whether or not we're interested in the given FD being readable.
    void watch_readable(int fd, bool interest) {
@@ -86,11 +107,6 @@ class fd_handler_sm {
       return interested_in(fd) && fds_.at(fd) & WANT_EXCEPT;
    }
 
-   /// Prepares the FD sets for select().
-   void update_fd_set(int & maxfd,
-                      fd_set * readfds,
-                      fd_set * writefds,
-                      fd_set * exceptfds);
    /// Iterates over the FDs we're interested in.
    std::map<int, uint8_t>::const_iterator fd_set_begin() const {
       return fds_.begin();
@@ -105,16 +121,127 @@ class fd_handler_sm {
    std::map<int, uint8_t> fds_;
 };
 
+/// A FD reported ready by a poller, along with its interest_t bits.
+struct fd_event {
+   int fd;
+   uint8_t events;
+};
+
+/**
+ * Waits for FDs to become ready.
+ *
+ * The Impl aggregates the interests of all the fd_handlers watching a given
+ * FD and pushes the result down to the poller whenever it changes, so that
+ * backends can keep their registrations across loop iterations instead of
+ * rebuilding them every time we wait.
+ */
+class poller {
+ public:
+   virtual ~poller() {
+   }
+
+   /**
+    * Sets the interest_t bits we want to wait on for this FD.  An interest of
+    * 0 means that nobody is watching this FD anymore.
+    */
+   virtual void interest_is(int fd, uint8_t interest) = 0;
+
+   /**
+    * Same as interest_is(), but doesn't trust what was registered before.
+    * Used when a handler watches a FD again: the FD may have been closed and
+    * re-opened under the same number meanwhile, and backends that keep their
+    * registrations in the kernel lose them when that happens.
+    */
+   virtual void interest_rearm(int fd, uint8_t interest) {
+      interest_is(fd, interest);
+   }
+
+   /**
+    * Waits until at least one FD is ready or the timeout expires.  A null
+    * timeout means wait forever.  The ready FDs are appended to `ready'.
+    * Returns -1 and leaves errno set if the underlying system call failed.
+    */
+   virtual int wait(struct timeval * timeout, std::vector<fd_event> & ready) = 0;
+};
+
+/**
+ * Poller based on select(2).  Rebuilds its FD sets on every wait() and is
+ * limited to FD_SETSIZE, but works everywhere.
+ */
+class select_poller : public poller {
+ public:
+   select_poller() {
+   }
+   virtual void interest_is(int fd, uint8_t interest);
+   virtual int wait(struct timeval * timeout, std::vector<fd_event> & ready);
+
+ private:
+   std::map<int, uint8_t> fds_;
+   DA_SDK_DISALLOW_COPY_CTOR(select_poller);
+};
+
+/**
+ * Poller based on epoll(7).  Registrations are persistent, so the cost of
+ * wait() is proportional to the number of ready FDs rather than to the number
+ * of watched FDs.
+ */
+class epoll_poller : public poller {
+ public:
+   epoll_poller();
+   virtual ~epoll_poller();
+   virtual void interest_is(int fd, uint8_t interest);
+   virtual void interest_rearm(int fd, uint8_t interest);
+   virtual int wait(struct timeval * timeout, std::vector<fd_event> & ready);
+
+ private:
+   int epfd_;
+   // Interests currently registered with the kernel, indexed by FD, so that
+   // FDs coming and going don't cost any memory allocation.
+   std::vector<uint8_t> fds_;
+   // Number of non-zero entries in `fds_'.
+   size_t registered_;
+   // FDs epoll refuses to watch (e.g. regular files, EPERM).  select()
+   // always reports those as ready, so we do the same.
+   std::map<int, uint8_t> always_ready_;
+   std::vector<struct epoll_event> events_;
+   DA_SDK_DISALLOW_COPY_CTOR(epoll_poller);
+};
+
+/**
+ * Poller that hands our FDs over to an external event loop, see
+ * event_loop::external_loop_is().  Interest changes are forwarded to the
+ * event_loop_handler incrementally, one watch_*() call per changed bit.
+ * wait() is only used if our own loop still gets run, and uses poll(2).
+ */
+class external_poller : public poller {
+ public:
+   explicit external_poller(event_loop_handler * loop) : loop_(loop) {
+   }
+   virtual void interest_is(int fd, uint8_t interest);
+   virtual int wait(struct timeval * timeout, std::vector<fd_event> & ready);
+
+ private:
+   event_loop_handler * const loop_;
+   // Interests the external loop currently knows about.
+   std::map<int, uint8_t> fds_;
+   DA_SDK_DISALLOW_COPY_CTOR(external_poller);
+};
+
 /**
  * Provides actual storage for `timeout_handler'.
  * Since timeout_handler doesn't store the current timeout, we have to store
  * it here, and associate a `timer' to each `timeout_handler'.
+ * A timer also remembers where it sits in the timer_queue, so that it can
+ * be moved or removed without searching for it.
  */
 class timer {
  public:
-   timer() {
+   virtual ~timer() {
+   }
+   timer() : timeout_(never), seq_(0), index_(npos), handler_(0) {
    }
-   explicit timer(timeout_handler * handler) : handler_(handler) {
+   explicit timer(timeout_handler * handler)
+      : timeout_(never), seq_(0), index_(npos), handler_(handler) {
    }
    timeout_handler * handler() {
       return handler_;
@@ -125,41 +252,688 @@ class timer {
    seconds_t timeout() const {
       return timeout_;
    }
+   /// Returns true if this timer is currently in the timer_queue.
+   bool scheduled() const {
+      return index_ != npos;
+   }
+   /// Called once the deadline has passed and the timer has been unset.
+   virtual void fire() {
+      handler_->on_timeout();
+   }
+   /// Returns true if this timer is still queued but must not fire anymore.
+   virtual bool cancelled() const {
+      return false;
+   }
  private:
+   friend class timer_queue;
+   static const size_t npos = size_t(-1);
+
    seconds_t timeout_;
+   // Arming sequence number, used to break ties between equal deadlines.
+   uint64_t seq_;
+   // Position in the timer_queue, or `npos' if not scheduled.
+   size_t index_;
    timeout_handler * handler_;
    //DA_SDK_DISALLOW_COPY_CTOR(timer);  // see comment in register_timeout_handler
 };
 
-/// Sorts timers such that the ones with the closest deadline come first.
-class timer_cmp {
+class Impl;
+
+/**
+ * A timer created through timeout_mgr::timer_once() or timer_periodic().
+ *
+ * These live in a slab owned by the Impl and are recycled once they have
+ * fired or been deleted.  The generation is bumped every time the slot is
+ * recycled, which is how stale timer_handle_t are told apart.  Deleting a
+ * timer only marks it as cancelled, the queue drops it lazily.
+ */
+class callback_timer : public timer {
  public:
-   bool operator()(const timer* l, const timer* r) {
-      return l->timeout() > r->timeout();
+   enum state_t {
+      FREE,       // In the free list.
+      ARMED,      // In the timer_queue, will fire.
+      CANCELLED,  // Still in the timer_queue, but won't fire.
+   };
+
+   callback_timer() : impl_(0), deadline_(never), interval_(0), slot_(0),
+                      generation_(1), state_(FREE), firing_(false) {
    }
+   virtual void fire();
+   virtual bool cancelled() const {
+      return state_ == CANCELLED;
+   }
+
+ private:
+   friend class Impl;
+
+   Impl * impl_;
+   timer_callback_t callback_;
+   // Deadline we were armed with, kept since the queue unsets it on pop.
+   seconds_t deadline_;
+   // 0 for one-shot timers.
+   seconds_t interval_;
+   // Our index in the Impl's slab.
+   uint32_t slot_;
+   uint32_t generation_;
+   state_t state_;
+   // True while a periodic timer's callback is running.
+   bool firing_;
 };
 
 /**
- * Min-heap of timers, so access to the next timer is O(1).
- * Insertion / deletion is O(log n).  Updating a deadline is O(n).
- * This would be more efficient with a Fibonacci heap, but that
- * doesn't really matter for now.
+ * Indexed min-heap of timers, so access to the next timer is O(1).
+ * Since each timer knows its own position in the heap, insertion, deletion
+ * and updating a deadline are all O(log n).  Timers with the same deadline
+ * come out in the order in which they were armed.
  */
-class timer_queue : public std::priority_queue<timer *,
-                                               std::vector<timer *>,
-                                               timer_cmp> {
+class timer_queue {
  public:
-   timer_queue() {
+   timer_queue() : next_seq_(0) {
    }
 
-   /// Re-inserts the given timer in the queue when its deadline is changed.
+   bool empty() const {
+      return heap_.empty();
+   }
+   size_t size() const {
+      return heap_.size();
+   }
+   /// Returns the timer with the closest deadline.
+   timer * top() const {
+      return heap_.front();
+   }
+   /// Removes the timer with the closest deadline and unsets its deadline.
+   void pop() {
+      remove(heap_.front());
+   }
+   /// Returns the sequence number the next armed timer will get.
+   uint64_t next_seq() const {
+      return next_seq_;
+   }
+   /// Returns true if the timer was armed before `seq' was handed out.
+   static bool armed_before(timer const * timer, uint64_t seq) {
+      return timer->seq_ < seq;
+   }
+
+   /**
+    * Inserts, moves or removes the given timer when its deadline is changed.
+    * A deadline of `never' removes the timer from the queue.
+    */
    void update(timer * timer);
+   /// Removes the timer from the queue, if it was in it, and unsets it.
+   void remove(timer * timer);
+   /**
+    * Removes all the timers for which `pred' returns true and unsets them.
+    * This is O(n), use it to purge many timers at once.
+    */
+   template <typename Pred> void remove_if(Pred pred) {
+      size_t kept = 0;
+      for (size_t i = 0; i < heap_.size(); i++) {
+         timer * t = heap_[i];
+         if (pred(t)) {
+            t->timeout_ = never;
+            t->index_ = timer::npos;
+         } else {
+            heap_[kept++] = t;
+         }
+      }
+      heap_.resize(kept);
+      for (size_t i = 0; i < kept; i++) {
+         heap_[i]->index_ = i;
+      }
+      for (size_t i = kept / 2; i-- > 0;) {  // Floyd's heap construction.
+         sift_down(i);
+      }
+   }
+
  private:
+   /// Returns true if `l' must fire before `r'.
+   static bool before(timer const * l, timer const * r) {
+      return l->timeout_ < r->timeout_
+         || (l->timeout_ == r->timeout_ && l->seq_ < r->seq_);
+   }
+   void place(timer * timer, size_t index) {
+      heap_[index] = timer;
+      timer->index_ = index;
+   }
+   void sift_up(size_t index);
+   void sift_down(size_t index);
+
+   std::vector<timer *> heap_;
+   uint64_t next_seq_;
    DA_SDK_DISALLOW_COPY_CTOR(timer_queue);
 };
 
 class sdk;
 
+/**
+ * Multiple-producer single-consumer queue of callbacks, based on Dmitry
+ * Vyukov's intrusive MPSC queue.  push() is wait-free and can be called
+ * from any thread, so producers never block each other nor the consumer.
+ * pop() must only be called from the thread running the loop.
+ */
+class post_queue {
+ public:
+   post_queue() : head_(&stub_), tail_(&stub_) {
+   }
+   ~post_queue();
+
+   /// Appends a callback to the queue.  Thread safe.
+   void push(std::function<void()> const & callback);
+   /**
+    * Takes the oldest callback out of the queue.  Returns false if the queue
+    * is empty, or if the oldest producer hasn't finished its push() yet, in
+    * which case that producer will wake the loop up again once it's done.
+    */
+   bool pop(std::function<void()> & callback);
+
+ private:
+   struct node {
+      node() : next(0) {
+      }
+      explicit node(std::function<void()> const & callback)
+         : next(0), callback(callback) {
+      }
+      std::atomic<node *> next;
+      std::function<void()> callback;
+   };
+   void push(node * n);
+
+   // Producers append here.
+   std::atomic<node *> head_;
+   // The consumer pops from here.
+   node * tail_;
+   // Placeholder that keeps the list non-empty.
+   node stub_;
+   DA_SDK_DISALLOW_COPY_CTOR(post_queue);
+};
+
+/**
+ * Private state of a fd_handler: the shard the handler is pinned to, which
+ * is the shard of the thread that created it.
+ */
+class fd_internal {
+ public:
+   explicit fd_internal(Impl * impl) : impl_(impl) {
+   }
+   Impl * impl() const {
+      return impl_;
+   }
+ private:
+   Impl * const impl_;
+};
+
+/// Private state of a timeout_handler: the shard the handler is pinned to.
+class timer_internal {
+ public:
+   explicit timer_internal(Impl * impl) : impl_(impl) {
+   }
+   Impl * impl() const {
+      return impl_;
+   }
+ private:
+   Impl * const impl_;
+};
+
+/// Number of values in loop_stat_t.
+static const int num_loop_stats = LOOP_STAT_MGR_HANDLER + 1;
+
+/**
+ * State of the loop instrumentation, see event_loop::stats_enabled_is().
+ * Allocated the first time the instrumentation is turned on, and then kept
+ * around until the loop goes away, so that a loop_stats_probe never points
+ * to freed memory even if the instrumentation is turned off under its feet.
+ */
+struct loop_stats {
+   loop_histogram_t stats[num_loop_stats];
+   // Durations of the callbacks, per class of handler.  Hashed, as it's
+   // looked up after every callback.
+   std::unordered_map<std::type_index, loop_histogram_t> handlers;
+
+   /// Records a duration, also under the class of the handler if there's one.
+   void record(loop_stat_t stat, std::type_info const * handler,
+               seconds_t duration) {
+      stats[stat].record(duration);
+      if(handler) {
+         handlers[std::type_index(*handler)].record(duration);
+      }
+   }
+};
+
+/**
+ * Times a callback and records its duration when going out of scope, if the
+ * loop_stats passed to it are non-null, i.e. if the instrumentation is on.
+ * Otherwise it costs a branch.  The class of the handler is looked up before
+ * the callback runs, since the callback may well delete the handler.
+ */
+class loop_stats_probe {
+ public:
+   template <typename Handler>
+   loop_stats_probe(loop_stats * stats, loop_stat_t stat, Handler const * handler)
+         : stats_(stats), stat_(stat), handler_(0), start_(0) {
+      if(stats_) {
+         if(handler) {
+            handler_ = &typeid(*handler);
+         }
+         start_ = now();
+      }
+   }
+   loop_stats_probe(loop_stats * stats, loop_stat_t stat)
+         : stats_(stats), stat_(stat), handler_(0), start_(stats ? now() : 0) {
+   }
+   ~loop_stats_probe() {
+      if(stats_) {
+         stats_->record(stat_, handler_, now() - start_);
+      }
+   }
+
+ private:
+   loop_stats * const stats_;
+   loop_stat_t const stat_;
+   std::type_info const * handler_;
+   seconds_t start_;
+   DA_SDK_DISALLOW_COPY_CTOR(loop_stats_probe);
+};
+
+/**
+ * Something that holds notifications back until the end of the current loop
+ * iteration, e.g. a manager that delivers changes to handlers in batches.
+ * See Impl::flush_is().
+ */
+class deferred_flush {
+ public:
+   virtual ~deferred_flush() {
+   }
+   /// Delivers what was held back.
+   virtual void flush() = 0;
+};
+
+/// How a manager delivers the changes of its table to a handler.
+enum delivery_t {
+   DELIVER_NOW,        // One at a time, as they happen.
+   DELIVER_BATCHED,    // In a notification_batch, once per loop iteration.
+   DELIVER_CONFLATED,  // In a conflated_batch, once per loop iteration.
+};
+
+/**
+ * The changes to a table that are held back for the handlers that take them
+ * in batches, see deferred_flush.  The changes are kept in order, as runs of
+ * sets and runs of deletes, so that an entry deleted and set again in the
+ * same iteration is seen as set in the end.
+ */
+template <typename Entry, typename Key>
+class notification_batch {
+ public:
+   bool empty() const {
+      return runs_.empty();
+   }
+
+   void set(Entry const & entry) {
+      run_of(true).count++;
+      sets_.push_back(entry);
+   }
+
+   void del(Key const & key) {
+      run_of(false).count++;
+      dels_.push_back(key);
+   }
+
+   /**
+    * Calls `on_sets' and `on_dels' with each run of sets and deletes, in
+    * order, as an array and a count.
+    */
+   template <typename OnSets, typename OnDels>
+   void deliver(OnSets on_sets, OnDels on_dels) const {
+      Entry const * sets = sets_.data();
+      Key const * dels = dels_.data();
+      for(auto run = runs_.begin(); run != runs_.end(); run++) {
+         if(run->set) {
+            on_sets(sets, run->count);
+            sets += run->count;
+         } else {
+            on_dels(dels, run->count);
+            dels += run->count;
+         }
+      }
+   }
+
+   void swap(notification_batch & other) {
+      sets_.swap(other.sets_);
+      dels_.swap(other.dels_);
+      runs_.swap(other.runs_);
+   }
+
+   /// Drops the changes, keeping the memory for the next batch.
+   void clear() {
+      sets_.clear();
+      dels_.clear();
+      runs_.clear();
+   }
+
+ private:
+   struct run {
+      bool set;
+      size_t count;
+   };
+
+   run & run_of(bool set) {
+      if(runs_.empty() || runs_.back().set != set) {
+         runs_.push_back(run{set, 0});
+      }
+      return runs_.back();
+   }
+
+   std::vector<Entry> sets_;
+   std::vector<Key> dels_;
+   std::vector<run> runs_;
+};
+
+/**
+ * Like notification_batch, but only keeps track of which keys changed, for
+ * the handlers that only care about the state a loop iteration leaves the
+ * table in.  The changes are looked up in the table when the batch is
+ * delivered: a key set several times is seen set once, with its entry in
+ * the table, and a key set then deleted is only seen deleted.  Counts how
+ * many changes were left out that way.
+ *
+ * The keys are indexed in an open addressed table that is kept from one
+ * iteration to the next and cleared by bumping a generation number, so
+ * recording a change doesn't allocate once the batch has grown to the size
+ * of the busiest iteration.
+ */
+template <typename Entry, typename Key>
+class conflated_batch {
+ public:
+   conflated_batch() : shift_(64), generation_(1), conflated_(0),
+                       delivered_conflated_(0) {
+   }
+
+   /// Returns true if no key changed since the last resolve().
+   bool empty() const {
+      return keys_.empty();
+   }
+
+   /// Returns how many changes were collapsed into later ones in the batch
+   /// being delivered.
+   size_t conflated() const {
+      return delivered_conflated_;
+   }
+
+   /// Records that `key' was set or deleted.
+   void changed(Key const & key) {
+      if((keys_.size() + 1) * 2 > slots_.size()) {
+         grow();
+      }
+      slot & s = find(key);
+      if(s.generation == generation_) {
+         conflated_++;
+         return;
+      }
+      s.generation = generation_;
+      s.pos = keys_.size();
+      keys_.push_back(key);
+   }
+
+   /**
+    * Makes the keys changed so far the batch to deliver, with `find'
+    * returning a pointer to the entry of a key in the table, or null if it
+    * was deleted.  The keys changed from then on go to the next batch.
+    */
+   template <typename Find>
+   void resolve(Find find) {
+      sets_.clear();
+      dels_.clear();
+      for(auto key = keys_.begin(); key != keys_.end(); key++) {
+         Entry const * entry = find(*key);
+         if(entry) {
+            sets_.push_back(*entry);
+         } else {
+            dels_.push_back(*key);
+         }
+      }
+      keys_.clear();
+      delivered_conflated_ = conflated_;
+      conflated_ = 0;
+      if(++generation_ == 0) {
+         for(auto s = slots_.begin(); s != slots_.end(); s++) {
+            s->generation = 0;
+         }
+         generation_ = 1;
+      }
+   }
+
+   /// Calls `on_sets' with the keys left set, and `on_dels' with the others.
+   template <typename OnSets, typename OnDels>
+   void deliver(OnSets on_sets, OnDels on_dels) const {
+      if(!sets_.empty()) {
+         on_sets(sets_.data(), sets_.size());
+      }
+      if(!dels_.empty()) {
+         on_dels(dels_.data(), dels_.size());
+      }
+   }
+
+   /// Drops the batch once delivered, keeping the memory for the next one.
+   void delivered() {
+      sets_.clear();
+      dels_.clear();
+   }
+
+ private:
+   // A key changed in the current generation is at `pos' in `keys_'.
+   struct slot {
+      uint32_t generation;
+      uint32_t pos;
+   };
+
+   // The slot of `key', or the free slot where it goes.
+   slot & find(Key const & key) {
+      size_t mask = slots_.size() - 1;
+      // Fibonacci hashing: the keys' own hashes may have weak low bits.
+      uint64_t h = uint64_t(handler_key_hash<Key>()(key)) * 0x9e3779b97f4a7c15ULL;
+      for(size_t i = size_t(h >> shift_);; i = (i + 1) & mask) {
+         slot & s = slots_[i];
+         if(s.generation != generation_ || keys_[s.pos] == key) {
+            return s;
+         }
+      }
+   }
+
+   void grow() {
+      std::vector<slot> slots(slots_.empty() ? 16 : slots_.size() * 2,
+                              slot{0, 0});
+      slots_.swap(slots);
+      shift_ = 64;
+      for(size_t size = slots_.size(); size > 1; size >>= 1) {
+         shift_--;
+      }
+      for(uint32_t pos = 0; pos < keys_.size(); pos++) {
+         slot & s = find(keys_[pos]);
+         s.generation = generation_;
+         s.pos = pos;
+      }
+   }
+
+   std::vector<slot> slots_;
+   unsigned shift_;
+   uint32_t generation_;
+   // The keys changed since the last resolve(), in the order they changed.
+   std::vector<Key> keys_;
+   size_t conflated_;
+   // The batch being delivered.
+   std::vector<Entry> sets_;
+   std::vector<Key> dels_;
+   size_t delivered_conflated_;
+};
+
+/**
+ * How the handlers of a manager asked to get the changes, kept by the
+ * manager rather than the handlers, along with how many of the handlers
+ * watching all the keys get them each way.  The manager can then tell from
+ * the counts whether to hold a change back, and whether anyone gets it now,
+ * without looking at every handler.
+ *
+ * A handler that asks for another delivery while changes are held back
+ * keeps the one it had until they are delivered, so that it neither misses
+ * the changes held back for it nor gets twice those it already got.
+ */
+template <typename Handler>
+class handler_deliveries {
+ public:
+   handler_deliveries() : watching_(0), batched_(0), conflated_(0) {
+   }
+
+   /// Number of handlers watching all the keys.
+   size_t watching() const {
+      return watching_;
+   }
+   /// Number of those that get the changes one at a time.
+   size_t now() const {
+      return watching_ - batched_ - conflated_;
+   }
+   size_t batched() const {
+      return batched_;
+   }
+   size_t conflated() const {
+      return conflated_;
+   }
+
+   /// How the handler gets the changes.  Always DELIVER_NOW for the
+   /// handlers that don't watch all the keys.
+   delivery_t delivery(Handler const * handler) const {
+      if (batched_ == 0 && conflated_ == 0) {
+         return DELIVER_NOW;
+      }
+      auto it = modes_.find(handler);
+      if (it == modes_.end() || !it->second.watching) {
+         return DELIVER_NOW;
+      }
+      return it->second.current;
+   }
+
+   bool batches(Handler const * handler) const {
+      auto it = modes_.find(handler);
+      return it != modes_.end() && it->second.batches;
+   }
+   bool conflation(Handler const * handler) const {
+      auto it = modes_.find(handler);
+      return it != modes_.end() && it->second.conflation;
+   }
+   /// Returns how many changes conflation spared the handler.
+   uint64_t changes_conflated(Handler const * handler) const {
+      auto it = modes_.find(handler);
+      return it == modes_.end() ? 0 : it->second.changes_conflated;
+   }
+   /// Counts the changes conflation spared the handler in a batch.
+   void changes_conflated_add(Handler const * handler, uint64_t count) {
+      modes_[handler].changes_conflated += count;
+   }
+
+   /// Sets what the handler asks for.  Takes effect right away, unless
+   /// changes are `held_back', in which case apply() does it.
+   void batches_is(Handler const * handler, bool batches, bool held_back) {
+      mode & m = modes_[handler];
+      m.batches = batches;
+      update(handler, m, held_back);
+   }
+   void conflation_is(Handler const * handler, bool conflation,
+                      bool held_back) {
+      mode & m = modes_[handler];
+      m.conflation = conflation;
+      update(handler, m, held_back);
+   }
+
+   /// Switches the handlers that asked while changes were held back, once
+   /// those were delivered.
+   void apply() {
+      for (auto handler = changing_.begin(); handler != changing_.end();
+           ++handler) {
+         auto it = modes_.find(*handler);
+         if (it != modes_.end()) {
+            switch_to(it->second, requested(it->second));
+         }
+      }
+      changing_.clear();
+   }
+
+   /// The handler starts watching all the keys.
+   void watch(Handler const * handler) {
+      mode & m = modes_[handler];
+      if (!m.watching) {
+         m.watching = true;
+         watching_++;
+         count(m.current, 1);
+      }
+   }
+   /// The handler stops watching all the keys, which forgets what it asked
+   /// for and the changes it was spared.
+   void unwatch(Handler const * handler) {
+      auto it = modes_.find(handler);
+      if (it == modes_.end()) {
+         return;
+      }
+      if (it->second.watching) {
+         watching_--;
+         count(it->second.current, -1);
+      }
+      modes_.erase(it);
+   }
+
+ private:
+   struct mode {
+      mode() : watching(false), batches(false), conflation(false),
+               current(DELIVER_NOW), changes_conflated(0) {
+      }
+      bool watching;
+      // What the handler asked for.
+      bool batches;
+      bool conflation;
+      // How it gets the changes until apply(), when it asked for a change.
+      delivery_t current;
+      uint64_t changes_conflated;
+   };
+
+   static delivery_t requested(mode const & m) {
+      if (m.conflation) {
+         return DELIVER_CONFLATED;
+      }
+      return m.batches ? DELIVER_BATCHED : DELIVER_NOW;
+   }
+
+   void update(Handler const * handler, mode & m, bool held_back) {
+      if (requested(m) == m.current) {
+         return;
+      }
+      if (held_back && m.watching) {
+         changing_.push_back(handler);
+      } else {
+         switch_to(m, requested(m));
+      }
+   }
+
+   void switch_to(mode & m, delivery_t how) {
+      if (m.watching) {
+         count(m.current, -1);
+         count(how, 1);
+      }
+      m.current = how;
+   }
+
+   void count(delivery_t how, int n) {
+      if (how == DELIVER_BATCHED) {
+         batched_ += n;
+      } else if (how == DELIVER_CONFLATED) {
+         conflated_ += n;
+      }
+   }
+
+   std::unordered_map<Handler const *, mode> modes_;
+   // The handlers whose request waits for apply().
+   std::vector<Handler const *> changing_;
+   size_t watching_;
+   size_t batched_;
+   size_t conflated_;
+};
+
 /**
  * Provides a basic implementation for various DA SDK primitives.
  * Keeps track of the state of the stubbed out SDK so we can behave
@@ -167,10 +941,55 @@ class sdk;
  * This implementation provides no guarantee on ordering of events,
  * meaning notifications don't get delivered to handlers in the same
  * order as with the real SDK.
+ *
+ * The global `impl' is the main loop, a.k.a. shard 0.  Additional shards
+ * (see event_loop::shards_is()) are other instances of this class, each
+ * owned by the main loop and running on its own thread, with its own FDs
+ * and timers.
  */
 class Impl {
  public:
-   Impl() {
+   Impl();
+   ~Impl();
+
+   /// Returns the shard run by the calling thread (the main loop by default).
+   static Impl & current();
+   /// Returns our shard number, 0 being the main loop.
+   uint32_t shard_id() const {
+      return shard_id_;
+   }
+   /// Starts shards until there are `count' in total.  Main loop only.
+   void shards_is(uint32_t count);
+   /// Returns the number of shards, including the main loop.
+   uint32_t shards() const {
+      std::vector<Impl *> const * shards = shards_.load(std::memory_order_acquire);
+      return shards ? uint32_t(shards->size()) + 1 : 1;
+   }
+   /// Returns the given shard, 0 being the main loop.  Any thread.
+   Impl * shard(uint32_t shard_id);
+   /**
+    * Queues `callback' to run on this shard's thread during its next loop
+    * iteration, and wakes the loop up.  Can be called from any thread.
+    */
+   void post(std::function<void()> const & callback);
+   /**
+    * Hands our FDs and timers over to an external event loop.  From then on
+    * the external loop delivers events through external_fd_event() and
+    * external_timeout().  Main loop only.
+    */
+   void external_loop_is(event_loop_handler * loop);
+   /// Called by the external loop when one of our FDs is ready.
+   void external_fd_event(int fd, uint8_t events);
+   /// Called by the external loop when the deadline we gave it has passed.
+   void external_timeout();
+   /// Returns the external loop, if any.
+   event_loop_handler * external_loop() const {
+      return external_loop_;
+   }
+
+   /// Returns the lock behind sdk_scoped_lock.
+   std::recursive_mutex & sdk_mutex() {
+      return sdk_mutex_;
    }
 
    void register_sdk(sdk * sdk) {
@@ -180,12 +999,18 @@ class Impl {
    void register_fd_handler(fd_handler * handler) {
       fd_handlers_[handler] = fd_handler_sm();
    }
-   void unregister_fd_handler(fd_handler * handler) {
-      fd_handlers_.erase(handler);
-   }
+   void unregister_fd_handler(fd_handler * handler);
    fd_handler_sm * get_fd_sm(fd_handler * handler) {
       return &fd_handlers_.at(handler);
    }
+   /// Changes the interest of a handler in a FD and updates the poller.
+   void watch_fd(fd_handler * handler, int fd, bool want,
+                 fd_handler_sm::interest_t interest);
+   /// Makes a fd_waiter wait for the given interest on a FD.
+   void arm_fd_waiter(fd_waiter * waiter, int fd,
+                      fd_handler_sm::interest_t interest);
+   /// Stops a fd_waiter from waiting, and updates the poller.
+   void disarm_fd_waiter(fd_waiter * waiter);
 
    void register_timeout_handler(timeout_handler * handler) {
       // We should do this, but our version of GCC is too old and doesn't have
@@ -194,13 +1019,54 @@ class Impl {
       timeout_to_timer_[handler] = timer(handler);
    }
    void unregister_timeout_handler(timeout_handler * handler) {
-      timeout_to_timer_.erase(handler);
+      auto it = timeout_to_timer_.find(handler);
+      if (it != timeout_to_timer_.end()) {
+         timers_.remove(&it->second);
+         timeout_to_timer_.erase(it);
+      }
    }
    void timeout_is(timeout_handler * handler, seconds_t timeout);
 
+   /// Creates a timer calling `callback', see timeout_mgr::timer_periodic().
+   timer_handle_t timer_start(seconds_t deadline, seconds_t interval,
+                              timer_callback_t const & callback);
+   /// Cancels a timer created by timer_start(), in O(1).
+   void timer_cancel(timer_handle_t const & handle);
+   /// Returns true if the timer created by timer_start() is still scheduled.
+   bool timer_pending(timer_handle_t const & handle) const;
+
+   /**
+    * Has `flusher' flushed at the end of the current loop iteration.  If
+    * we're not in one, the loop is woken up to run one.  Main loop only.
+    */
+   void flush_is(deferred_flush * flusher);
+   /// Forgets about a flusher that goes away.
+   void flush_del(deferred_flush * flusher);
+
+   /// Turns the loop instrumentation on or off, see event_loop.
+   void stats_enabled_is(bool enabled);
+   /// Returns the loop instrumentation if it's on, null otherwise.
+   loop_stats * stats() const {
+      return stats_enabled_ ? stats_ : 0;
+   }
+   /// Returns the histogram of a measurement, empty if it was never on.
+   loop_histogram_t stat(loop_stat_t stat) const;
+   /// Returns the histograms of each class of handler, by class name.
+   std::map<std::string, loop_histogram_t> handler_stats() const;
+   /// Publishes our histograms as agent status every `interval' seconds.
+   void stats_status_interval_is(seconds_t interval);
+
    // Stop the loop after the current iteration
    void stop_loop();
 
+   /**
+    * Returns the time at which the current loop iteration started if we're
+    * in our loop, or now() otherwise.  See loop_now().
+    */
+   seconds_t loop_time() const {
+      return loop_depth_ ? loop_time_ : now();
+   }
+
    /// Sets the name of this agent.
    void agent_name_is(const char * agent_name);
    /**
@@ -211,11 +1077,75 @@ class Impl {
    void main_loop(seconds_t duration = -1);
  private:
    void do_initialize();
+   /// Fires all the timers whose deadline is at or before `current'.
+   void run_timers(seconds_t current);
+   friend class callback_timer;
+   /// Runs the callback of a callback_timer whose deadline has passed.
+   void fire_callback_timer(callback_timer * timer);
+   /// Returns a callback_timer to the free list and invalidates its handles.
+   void release_callback_timer(callback_timer * timer);
+   /// Returns the callback_timer a handle refers to, or 0 if it's stale.
+   callback_timer * lookup_callback_timer(timer_handle_t const & handle) const;
+   /**
+    * Returns the poller, creating it on first use.  epoll is used unless the
+    * DA_SDK_POLLER environment variable is set to "select".
+    */
+   poller * get_poller();
+   /// Returns the union of the interests of all the handlers watching a FD.
+   uint8_t fd_interest(int fd) const;
+   /// Recomputes the aggregated interest in a FD and pushes it to the poller.
+   void update_fd_interest(int fd);
+   /// Tells the external loop about our next deadline, if it changed.
+   void sync_external_timeout();
+   /// Takes a fd_waiter out of the list of waiters of its FD.
+   void unlink_fd_waiter(fd_waiter * waiter);
+   /// Invokes the callbacks of the handlers and waiters of a ready FD.
+   void dispatch_fd_event(fd_event const & event);
+   /// Creates an additional shard.
+   explicit Impl(uint32_t shard_id);
+   /// Entry point of the thread running a shard.
+   static void run_shard(Impl * shard);
+   /// Runs the callbacks posted to us from other threads.
+   void run_posted();
+   /// Flushes what was held back during the current loop iteration.
+   void run_flushes();
+   /// Makes the loop wake up, unless a wake up is already pending.
+   void wakeup();
+   /// Counts us as being in our loop for as long as it's in scope.
+   class loop_scope {
+    public:
+      explicit loop_scope(Impl * impl) : impl_(impl) {
+         impl_->loop_depth_++;
+      }
+      ~loop_scope() {
+         impl_->loop_depth_--;
+      }
+    private:
+      Impl * const impl_;
+   };
+   /// Publishes our histograms through the agent_mgr's status.
+   void publish_stats();
+
+   // Shard run by the current thread, null for the main loop.
+   static thread_local Impl * current_;
+
+   uint32_t shard_id_;
 
    // Whether or not we're done initializing.
    bool initialized_;
    // Whether the loop should be running
    bool running_;
+   // How many times we've entered our loop (main_loop() or one of the
+   // external_*() entry points), and the time the loop last woke up at.
+   int loop_depth_;
+   seconds_t loop_time_;
+   // The FDs the poller found ready, kept across main_loop() calls so that
+   // agents calling event_loop::run() in their own loop don't allocate.
+   std::vector<fd_event> ready_;
+   // Whether we're running the handlers of a loop iteration, and the
+   // deferred_flushes to run at the end of it.
+   bool in_iteration_;
+   std::vector<deferred_flush *> flushes_;
 
    sdk * sdk_;
 
@@ -225,16 +1155,70 @@ class Impl {
    // Maps a FD handler to the set of FDs it's interested in.
    std::map<fd_handler *, fd_handler_sm> fd_handlers_;
 
+   // Maps a FD to the set of handlers interested in it.
+   std::map<int, std::set<fd_handler *> > fd_watchers_;
+
+   // Indexed by FD, the first of the fd_waiters waiting on it, if any.
+   std::vector<fd_waiter *> fd_waiters_;
+   // Sequence number for the next fd_waiter that gets armed.
+   uint64_t fd_waiter_seq_;
+
+   // Waits on the FDs in `fd_watchers_'.
+   poller * poller_;
+
    // Maps a user-created timeout_handler to an outstanding timer.
    std::map<timeout_handler *, timer> timeout_to_timer_;
 
+   // External loop we're integrated in, if any.
+   event_loop_handler * external_loop_;
+   // Deadline the external loop currently has for us, `never' if none.
+   seconds_t external_deadline_;
+
+   // Slab of timers created through the timeout_mgr, indexed by the slot
+   // of their timer_handle_t.  A deque so that pointers remain stable.
+   std::deque<callback_timer> callback_timers_;
+   // Slots of `callback_timers_' that can be reused.
+   std::vector<uint32_t> free_callback_timers_;
+   // Number of cancelled callback_timers still sitting in `timers_'.
+   size_t cancelled_timers_;
+
    std::string agent_name;
 
+   // Loop instrumentation, allocated when first turned on, and whether it's
+   // currently on.
+   loop_stats * stats_;
+   bool stats_enabled_;
+   // Timer publishing the instrumentation as agent status.
+   timer_handle_t stats_status_timer_;
+
+   // eventfd that other threads poke when they post a callback to us.
+   int wakeup_fd_;
+   // Whether `wakeup_fd_' has been poked and we haven't drained `posted_'
+   // since.  Saves producers a system call when the loop is already awake.
+   std::atomic<bool> wakeup_pending_;
+   // Callbacks posted from other threads, in order.
+   post_queue posted_;
+
+   // Lock grabbed by sdk_scoped_lock, held by the main loop except while
+   // it waits for events.  Only used by the main loop.
+   std::recursive_mutex sdk_mutex_;
+
+   // Additional shards (shard N is at index N-1), or null if there are none.
+   // post() looks shards up from any thread, so a published table is never
+   // modified: shards_is() publishes a longer copy instead.  The tables are
+   // only freed along with us, in `shard_tables_'.
+   std::atomic<std::vector<Impl *> const *> shards_;
+   // Tables ever published in `shards_', and the shards' threads.  Only used
+   // by the main loop.
+   std::vector<std::vector<Impl *> *> shard_tables_;
+   std::vector<std::thread> shard_threads_;
+
    DA_SDK_DISALLOW_COPY_CTOR(Impl);
 };
 
-// Like the real SDK, this implementation is not thread safe and only one
-// instance of it can be used at a time.
+// Like the real SDK, this implementation is not thread safe: each instance
+// must only be used from the thread running its loop.  Additional instances
+// only exist as shards of this one.
 extern Impl impl;
 
 }
@@ -3,6 +3,7 @@
 
 #include "DA/intf.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -55,8 +56,7 @@ class intf_mgr_impl : public intf_mgr {
    }
    
    intf_iter_t intf_iter() const {
-      intf_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return intf_iter_impl::iter();
    }
 
    bool exists(intf_id_t) const {
@@ -2,47 +2,240 @@
 // Arista Networks, Inc. Confidential and Proprietary.
 
 #include "DA/intf.h"
+#include <string.h>
+
+#include <deque>
+#include <mutex>
+#include <vector>
 
 namespace DA {
 
-intf_id_t::intf_id_t() {
-   
+// The layout of intf_id_t::intfId_, described in DA/types/intf.h.
+static int const TYPE_SHIFT = 56;
+static uint64_t const INTERNED = uint64_t(1) << 55;
+static uint64_t const INTERNED_SUBINTF = uint64_t(1) << 54;
+static int const NUMBER_BITS = 12;
+static int const NUMBER_SHIFT = 16;
+static int const MAX_NUMBERS = 3;
+static uint32_t const MAX_NUMBER = (1 << NUMBER_BITS) - 2;
+static uint32_t const MAX_SUBINTF = 0xfffe;
+
+// The names of the types whose interfaces are parsed into their ids,
+// indexed by type.  Other types are always interned.
+static struct {
+   char const * name;
+   size_t len;
+} const intf_prefixes[] = {
+   { "", 0 },               // INTF_TYPE_NULL
+   { "", 0 },               // INTF_TYPE_OTHER
+   { "Ethernet", 8 },       // INTF_TYPE_ETH
+   { "Vlan", 4 },           // INTF_TYPE_VLAN
+   { "Management", 10 },    // INTF_TYPE_MANAGEMENT
+   { "Loopback", 8 },       // INTF_TYPE_LOOPBACK
+   { "Port-Channel", 12 },  // INTF_TYPE_LAG
+   { "Null", 4 },           // INTF_TYPE_NULL0
+   { "Cpu", 3 },            // INTF_TYPE_CPU
+   { "Vxlan", 5 },          // INTF_TYPE_VXLAN
+};
+static int const NUM_INTF_PREFIXES = sizeof(intf_prefixes) / sizeof(*intf_prefixes);
+
+static inline bool is_digit(char c) {
+   return static_cast<unsigned char>(c - '0') < 10;
 }
 
-intf_id_t::intf_id_t(char const * name) :
-      intfId_() {
-   
+// Parses a decimal number without leading zeros, of at most `max', and
+// advances `p' past it.
+static bool parse_number(char const *& p, char const * end, uint32_t max,
+                         uint32_t * result) {
+   if (p == end || !is_digit(*p) || (*p == '0' && p + 1 != end && is_digit(p[1]))) {
+      return false;
+   }
+   uint32_t value = 0;
+   while (p != end && is_digit(*p)) {
+      value = value * 10 + (*p++ - '0');
+      if (value > max) {
+         return false;
+      }
+   }
+   *result = value;
+   return true;
 }
 
-intf_id_t::intf_id_t(std::string const & name) :
-      intfId_() {
-   
+// Parses what follows the type's name, e.g. `3/1.100' of `Ethernet3/1.100',
+// into the low bits of an id.
+static bool parse_intf_numbers(char const * p, char const * end,
+                               uint64_t * result) {
+   uint64_t id = 0;
+   uint32_t value;
+   int shift = NUMBER_SHIFT + (MAX_NUMBERS - 1) * NUMBER_BITS;
+   if (p != end && *p != '.') {
+      for (;;) {
+         if (shift < NUMBER_SHIFT || !parse_number(p, end, MAX_NUMBER, &value)) {
+            return false;
+         }
+         id |= uint64_t(value + 1) << shift;
+         shift -= NUMBER_BITS;
+         if (p == end || *p != '/') {
+            break;
+         }
+         ++p;
+      }
+   }
+   if (p != end) {
+      if (*p++ != '.' || !parse_number(p, end, MAX_SUBINTF, &value) || p != end) {
+         return false;
+      }
+      id |= value + 1;
+   }
+   *result = id;
+   return true;
 }
 
-bool
-intf_id_t::is_null0() const {
-   return false;
+namespace {
+
+/**
+ * The names that can't be parsed into an id, which are given an index in
+ * this table the first time they're seen.  Looking a name up hashes it
+ * into an open addressed index, so that names seen before are found
+ * without allocating.
+ */
+class intf_name_table {
+ public:
+   static intf_name_table & instance() {
+      // Not a global, since static intf_id_t's may be initialized first.
+      static intf_name_table table;
+      return table;
+   }
+
+   intf_name_table() : slots_(64, 0) {
+   }
+
+   uint32_t intern(char const * name, size_t len) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      size_t mask = slots_.size() - 1;
+      for (size_t i = hash(name, len) & mask; ; i = (i + 1) & mask) {
+         uint32_t slot = slots_[i];
+         if (!slot) {
+            // Slots hold the index plus one, so that 0 is an empty slot.
+            uint32_t index = names_.size();
+            names_.push_back(std::string(name, len));
+            slots_[i] = index + 1;
+            if (2 * names_.size() > slots_.size()) {
+               grow();
+            }
+            return index;
+         }
+         std::string const & other = names_[slot - 1];
+         if (other.size() == len && !memcmp(other.data(), name, len)) {
+            return slot - 1;
+         }
+      }
+   }
+
+   char * write(uint32_t index, char * first, char * last) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      chars_writer out(first, last);
+      out << names_[index];
+      return out.end();
+   }
+
+ private:
+   static size_t hash(char const * name, size_t len) {
+      uint8_t * bytes = reinterpret_cast<uint8_t *>(const_cast<char *>(name));
+      return hash_mix::final_mix(hash_mix::mix(bytes, len, 0));
+   }
+
+   void grow() {
+      std::vector<uint32_t> slots(2 * slots_.size(), 0);
+      size_t mask = slots.size() - 1;
+      for (uint32_t index = 0; index < names_.size(); ++index) {
+         std::string const & name = names_[index];
+         size_t i = hash(name.data(), name.size()) & mask;
+         while (slots[i]) {
+            i = (i + 1) & mask;
+         }
+         slots[i] = index + 1;
+      }
+      slots_.swap(slots);
+   }
+
+   std::mutex mutex_;
+   // A deque, so that growing it doesn't move the names around.
+   std::deque<std::string> names_;
+   std::vector<uint32_t> slots_;
+};
+
 }
 
-bool
-intf_id_t::is_subintf() const {
-   return false;
+static uint64_t parse_intf_name(char const * name, size_t len) {
+   if (!len) {
+      return 0;
+   }
+   int type = INTF_TYPE_OTHER;
+   for (int t = INTF_TYPE_ETH; t < NUM_INTF_PREFIXES; ++t) {
+      size_t prefix_len = intf_prefixes[t].len;
+      if (len >= prefix_len && !memcmp(name, intf_prefixes[t].name, prefix_len)) {
+         if (t == INTF_TYPE_NULL0 && (len != 5 || name[4] != '0')) {
+            // Null0 is the only null interface.
+            break;
+         }
+         uint64_t numbers;
+         if (parse_intf_numbers(name + prefix_len, name + len, &numbers)) {
+            return (uint64_t(t) << TYPE_SHIFT) | numbers;
+         }
+         type = t;
+         break;
+      }
+   }
+   uint64_t id = (uint64_t(type) << TYPE_SHIFT) | INTERNED |
+                 intf_name_table::instance().intern(name, len);
+   if (memchr(name, '.', len)) {
+      id |= INTERNED_SUBINTF;
+   }
+   return id;
 }
 
-intf_type_t
-intf_id_t::intf_type() const {
-   return INTF_TYPE_NULL;
+intf_id_t::intf_id_t(char const * name) :
+      intfId_(parse_intf_name(name, strlen(name))) {
 }
 
-std::string
-intf_id_t::to_string() const {
-   return NULL;
+intf_id_t::intf_id_t(std::string const & name) :
+      intfId_(parse_intf_name(name.data(), name.size())) {
 }
 
-bool
-intf_id_t::operator!() const {
-   return false;
+char *
+intf_id_t::to_chars(char * first, char * last) const {
+   if (intfId_ & INTERNED) {
+      return intf_name_table::instance().write(uint32_t(intfId_), first, last);
+   }
+   chars_writer out(first, last);
+   int type = intfId_ >> TYPE_SHIFT;
+   if (type < NUM_INTF_PREFIXES) {
+      out.write(intf_prefixes[type].name, intf_prefixes[type].len);
+   }
+   char separator = 0;
+   for (int shift = NUMBER_SHIFT + (MAX_NUMBERS - 1) * NUMBER_BITS;
+        shift >= NUMBER_SHIFT; shift -= NUMBER_BITS) {
+      uint32_t number = (intfId_ >> shift) & ((1 << NUMBER_BITS) - 1);
+      if (!number) {
+         break;
+      }
+      if (separator) {
+         out << separator;
+      }
+      out.write_decimal(number - 1);
+      separator = '/';
+   }
+   if (uint32_t subintf = intfId_ & 0xffff) {
+      out << '.';
+      out.write_decimal(subintf - 1);
+   }
+   return out.end();
 }
 
+std::string
+intf_id_t::to_string() const {
+   return chars_writer::to_string(*this);
+}
 
 }
@@ -3,11 +3,20 @@
 
 #include "DA/ip_route.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
 class ip_route_mgr_impl : public ip_route_mgr {
  public:
+   using ip_route_mgr::exists;
+   using ip_route_mgr::ip_route;
+   using ip_route_mgr::ip_route_del;
+   using ip_route_mgr::ip_route_set;
+   using ip_route_mgr::ip_route_via_del;
+   using ip_route_mgr::ip_route_via_iter;
+   using ip_route_mgr::ip_route_via_set;
+
    ip_route_mgr_impl() {
    }
 
@@ -28,19 +37,16 @@ class ip_route_mgr_impl : public ip_route_mgr {
    }
 
    ip_route_iter_t ip_route_iter() const {
-      ip_route_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return ip_route_iter_impl::iter();
    }
 
    ip_route_via_iter_t ip_route_via_iter(ip_route_key_t const & key) const {
-      ip_route_via_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return ip_route_via_iter_impl::iter();
    }
 
    ip_route_via_iter_t ip_route_via_iter(ip_route_key_t const &,
                                          std::string vrfName) const {
-      ip_route_via_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return ip_route_via_iter_impl::iter();
    }
 
    bool exists(ip_route_key_t const &, std::string vrfName) const {
@@ -111,8 +117,100 @@ class ip_route_mgr_impl : public ip_route_mgr {
       // TODO: No op impl.
    }
 
+ protected:
+   // The VRF name is ignored, so no string is made of it either.
+   ip_route_via_iter_t ip_route_via_iter_in_vrf(ip_route_key_t const &,
+                                                char const * vrfName) const {
+      return ip_route_via_iter_impl::iter();
+   }
+
+   bool exists_in_vrf(ip_route_key_t const &, char const * vrfName) const {
+      return false;  // TODO: No op impl.
+   }
+
+   bool exists_in_vrf(ip_route_via_t const &, char const * vrfName) const {
+      return false;  // TODO: No op impl.
+   }
+
+   ip_route_t ip_route_in_vrf(ip_route_key_t const &, char const * vrfName) {
+      // TODO: No op impl.
+      return ip_route_t();
+   }
+
+   void ip_route_set_in_vrf(ip_route_t const &, char const * vrfName) {
+      // TODO: No op impl.
+   }
+
+   void ip_route_del_in_vrf(ip_route_key_t const &, char const * vrfName) {
+      // TODO: No op impl.
+   }
+
+   void ip_route_via_set_in_vrf(ip_route_via_t const &, char const * vrfName) {
+      // TODO: No op impl.
+   }
+
+   void ip_route_via_del_in_vrf(ip_route_via_t const &, char const * vrfName) {
+      // TODO: No op impl.
+   }
 };
 
+void
+ip_route_mgr::ip_route_set_moved(ip_route_t & route) {
+   ip_route_set(route);
+}
+
+void
+ip_route_mgr::ip_route_via_set_moved(ip_route_via_t & via) {
+   ip_route_via_set(via);
+}
+
+ip_route_via_iter_t
+ip_route_mgr::ip_route_via_iter_in_vrf(ip_route_key_t const & key,
+                                       char const * vrfName) const {
+   return ip_route_via_iter(key, std::string(vrfName));
+}
+
+bool
+ip_route_mgr::exists_in_vrf(ip_route_key_t const & key,
+                            char const * vrfName) const {
+   return exists(key, std::string(vrfName));
+}
+
+bool
+ip_route_mgr::exists_in_vrf(ip_route_via_t const & via,
+                            char const * vrfName) const {
+   return exists(via, std::string(vrfName));
+}
+
+ip_route_t
+ip_route_mgr::ip_route_in_vrf(ip_route_key_t const & key, char const * vrfName) {
+   return ip_route(key, std::string(vrfName));
+}
+
+void
+ip_route_mgr::ip_route_set_in_vrf(ip_route_t const & route,
+                                  char const * vrfName) {
+   ip_route_set(route, std::string(vrfName));
+}
+
+void
+ip_route_mgr::ip_route_del_in_vrf(ip_route_key_t const & key,
+                                  char const * vrfName) {
+   ip_route_del(key, std::string(vrfName));
+}
+
+void
+ip_route_mgr::ip_route_via_set_in_vrf(ip_route_via_t const & via,
+                                      char const * vrfName) {
+   ip_route_via_set(via, std::string(vrfName));
+}
+
+void
+ip_route_mgr::ip_route_via_del_in_vrf(ip_route_via_t const & via,
+                                      char const * vrfName) {
+   ip_route_via_del(via, std::string(vrfName));
+}
+
 DEFINE_STUB_MGR_CTOR(ip_route_mgr)
 
 }  // end namespace DA
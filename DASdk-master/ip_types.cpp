@@ -49,18 +49,360 @@ ip_addr_t::operator<(ip_addr_t const & other) const {
 
 
 
+static inline bool is_digit(char c) {
+   return static_cast<unsigned char>(c - '0') < 10;
+}
+
+// Maps each character to its value as a hex digit, or to -1.
+struct hex_digit_table {
+   constexpr hex_digit_table() : value() {
+      for (int c = 0; c < 256; ++c) {
+         value[c] = c >= '0' && c <= '9' ? c - '0' :
+                    c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                    c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+      }
+   }
+   int8_t value[256];
+};
+
+static constexpr hex_digit_table hex_digits;
+
+static inline int hex_digit(char c) {
+   return hex_digits.value[static_cast<unsigned char>(c)];
+}
+
+// Parses a dotted-quad IPv4 address spanning all of [p, end).  Like
+// inet_pton(), rejects octets with leading zeros.
+static bool parse_ipv4(char const * p, char const * end, uint8_t * bytes) {
+   for (int octet = 0; ; ++octet) {
+      if (p == end || !is_digit(*p)) {
+         return false;
+      }
+      unsigned value = *p++ - '0';
+      if (value == 0 && p != end && is_digit(*p)) {
+         return false;
+      }
+      while (p != end && is_digit(*p)) {
+         value = value * 10 + (*p++ - '0');
+         if (value > 255) {
+            return false;
+         }
+      }
+      bytes[octet] = value;
+      if (octet == 3) {
+         return p == end;
+      }
+      if (p == end || *p != '.') {
+         return false;
+      }
+      ++p;
+   }
+}
+
+// Parses an IPv6 address spanning all of [p, end), in any of the forms of
+// RFC 4291 section 2.2, the same ones inet_pton() accepts.
+static bool parse_ipv6(char const * p, char const * end, uint8_t * bytes) {
+   uint8_t tmp[16] = {};
+   int len = 0;  // Bytes parsed so far.
+   int gap = -1;  // Where the `::' is, if any.
+   if (p != end && *p == ':') {
+      // Only valid as the start of a leading `::', whose second colon is
+      // handled below.
+      if (++p == end || *p != ':') {
+         return false;
+      }
+   }
+   char const * group = p;
+   unsigned value = 0;
+   int digits = 0;
+   while (p != end) {
+      char c = *p++;
+      int digit = hex_digit(c);
+      if (digit >= 0) {
+         if (++digits > 4) {
+            return false;
+         }
+         value = value << 4 | digit;
+      } else if (c == ':') {
+         group = p;
+         if (!digits) {
+            if (gap >= 0) {
+               return false;
+            }
+            gap = len;
+            continue;
+         }
+         if (p == end || len + 2 > 16) {
+            return false;
+         }
+         tmp[len++] = value >> 8;
+         tmp[len++] = value;
+         value = 0;
+         digits = 0;
+      } else if (c == '.' && len + 4 <= 16) {
+         // An IPv4 address in the last 32 bits, e.g. ::ffff:192.0.2.1.
+         if (!parse_ipv4(group, end, tmp + len)) {
+            return false;
+         }
+         len += 4;
+         digits = 0;
+         break;
+      } else {
+         return false;
+      }
+   }
+   if (digits) {
+      if (len + 2 > 16) {
+         return false;
+      }
+      tmp[len++] = value >> 8;
+      tmp[len++] = value;
+   }
+   if (gap >= 0) {
+      if (len == 16) {
+         return false;
+      }
+      // Move what follows the `::' to the end, the gap is already zeroed.
+      int tail = len - gap;
+      memmove(tmp + 16 - tail, tmp + gap, tail);
+      memset(tmp + gap, 0, 16 - tail - gap);
+   } else if (len != 16) {
+      return false;
+   }
+   memcpy(bytes, tmp, 16);
+   return true;
+}
+
+bool
+parse_ip_addr(char const * addr, size_t len, ip_addr_t * result) {
+   char const * end = addr + len;
+   uint8_t bytes[16];
+   // IPv4 addresses have no colon, while IPv6 ones have one within their
+   // first 5 characters, after at most 4 hex digits.
+   bool ipv6 = false;
+   for (size_t i = 0; i < len && i < 5; ++i) {
+      ipv6 |= addr[i] == ':';
+   }
+   if (ipv6) {
+      if (!parse_ipv6(addr, end, bytes)) {
+         return false;
+      }
+      result->af_ = AF_IPV6;
+      memcpy(result->addr_.bytes, bytes, 16);
+   } else {
+      if (!parse_ipv4(addr, end, bytes)) {
+         return false;
+      }
+      result->af_ = AF_IPV4;
+      memset(&result->addr_, 0, sizeof(result->addr_));
+      memcpy(result->addr_.bytes, bytes, 4);
+   }
+   return true;
+}
+
 bool
 parse_ip_addr(char const * addr, ip_addr_t * result) {
-   return true;  // TODO: No op impl.
+   return parse_ip_addr(addr, strlen(addr), result);
 }
 
+// Splits a prefix of `len' characters at its slash, which is returned, and
+// parses the prefix length that follows it.
+static char const * parse_prefix_length(char const * addr, size_t len,
+                                        unsigned * prefix_length) {
+   // The prefix length has at most 3 digits, so look for the slash from
+   // the end.
+   char const * slash = 0;
+   for (size_t i = 1; i <= len && i <= 4; ++i) {
+      if (addr[len - i] == '/') {
+         slash = addr + len - i;
+         break;
+      }
+   }
+   if (!slash) {
+      return 0;
+   }
+   // The prefix length, without leading zeros.
+   char const * p = slash + 1;
+   char const * end = addr + len;
+   if (p == end || !is_digit(*p) || (*p == '0' && end - p > 1)) {
+      return 0;
+   }
+   unsigned value = 0;
+   for (; p != end; ++p) {
+      if (!is_digit(*p)) {
+         return 0;
+      }
+      value = value * 10 + (*p - '0');
+   }
+   *prefix_length = value;
+   return slash;
+}
 
+bool
+parse_ip_prefix(char const * addr, size_t len, ip_prefix_t * result) {
+   unsigned prefix_length;
+   char const * slash = parse_prefix_length(addr, len, &prefix_length);
+   ip_addr_t network;
+   if (!slash || !parse_ip_addr(addr, slash - addr, &network)) {
+      return false;
+   }
+   int bytes = network.af() == AF_IPV4 ? 4 : 16;
+   if (prefix_length > unsigned(bytes * 8)) {
+      return false;
+   }
+   // The host part of the address must be zero.
+   uint8_t const * addr_bytes = network.addr();
+   for (int i = prefix_length / 8; i < bytes; ++i) {
+      int host_bits = i == int(prefix_length / 8) ? 8 - prefix_length % 8 : 8;
+      if (addr_bytes[i] & ((1 << host_bits) - 1)) {
+         return false;
+      }
+   }
+   result->addr_ = network;
+   result->prefix_length_ = prefix_length;
+   return true;
+}
 
 bool
 parse_ip_prefix(char const * addr, ip_prefix_t * result) {
-   return true;  // TODO: No op impl.
+   return parse_ip_prefix(addr, strlen(addr), result);
 }
 
+bool
+parse_ip4_addr(char const * addr, size_t len, ip4_addr_t * result) {
+   uint8_t bytes[4];
+   if (!parse_ipv4(addr, addr + len, bytes)) {
+      return false;
+   }
+   memcpy(&result->addr_, bytes, sizeof(bytes));
+   return true;
+}
+
+bool
+parse_ip4_prefix(char const * addr, size_t len, ip4_prefix_t * result) {
+   unsigned prefix_length;
+   char const * slash = parse_prefix_length(addr, len, &prefix_length);
+   uint8_t bytes[4];
+   if (!slash || prefix_length > 32 || !parse_ipv4(addr, slash, bytes)) {
+      return false;
+   }
+   uint32_t network = uint32_t(bytes[0]) << 24 | bytes[1] << 16 |
+                      bytes[2] << 8 | bytes[3];
+   if (prefix_length < 32 && (network & (0xFFFFFFFF >> prefix_length))) {
+      return false;
+   }
+   memcpy(result->addr_, bytes, sizeof(bytes));
+   result->prefix_length_ = prefix_length;
+   return true;
+}
+
+// Parses one prefix per line into `result', for parse_ip_prefixes() and
+// parse_ip4_prefixes().
+template <typename Prefix>
+static size_t parse_prefix_lines(char const * buf, size_t len, Prefix * result,
+                                 size_t max_results, size_t * consumed,
+                                 bool (*parse)(char const *, size_t, Prefix *)) {
+   char const * p = buf;
+   char const * end = buf + len;
+   size_t count = 0;
+   while (count < max_results && p != end) {
+      // memchr() scans for the end of line many bytes at a time.
+      char const * eol = static_cast<char const *>(memchr(p, '\n', end - p));
+      char const * next = eol ? eol + 1 : end;
+      char const * line_end = eol ? eol : end;
+      if (line_end != p && line_end[-1] == '\r') {
+         --line_end;
+      }
+      if (line_end != p) {
+         if (!parse(p, line_end - p, &result[count])) {
+            break;
+         }
+         ++count;
+      }
+      p = next;
+   }
+   if (consumed) {
+      *consumed = p - buf;
+   }
+   return count;
+}
+
+size_t
+parse_ip_prefixes(char const * buf, size_t len, ip_prefix_t * result,
+                  size_t max_results, size_t * consumed) {
+   return parse_prefix_lines(buf, len, result, max_results, consumed,
+                             &parse_ip_prefix);
+}
+
+size_t
+parse_ip4_prefixes(char const * buf, size_t len, ip4_prefix_t * result,
+                   size_t max_results, size_t * consumed) {
+   return parse_prefix_lines(buf, len, result, max_results, consumed,
+                             &parse_ip4_prefix);
+}
+
+
+
+
+char *
+ip_addr_t::to_chars(char * first, char * last) const {
+   chars_writer out(first, last);
+   if (af_ == AF_IPV4) {
+      out << addr_.bytes[0] << '.' << addr_.bytes[1] << '.'
+          << addr_.bytes[2] << '.' << addr_.bytes[3];
+   } else if (af_ == AF_IPV6) {
+      // The same text as inet_ntop(): lower case, the longest run of at
+      // least two zero groups (the first one on ties) compressed to `::',
+      // and IPv4-compatible and mapped addresses ending in dotted-quad.
+      unsigned groups[8];
+      for (int i = 0; i < 8; ++i) {
+         groups[i] = addr_.bytes[2 * i] << 8 | addr_.bytes[2 * i + 1];
+      }
+      int best = -1, best_len = 0;
+      for (int i = 0; i < 8;) {
+         if (groups[i]) {
+            ++i;
+            continue;
+         }
+         int j = i;
+         while (j < 8 && !groups[j]) {
+            ++j;
+         }
+         if (j - i > best_len) {
+            best = i;
+            best_len = j - i;
+         }
+         i = j;
+      }
+      if (best_len < 2) {
+         best = -1;
+      }
+      for (int i = 0; i < 8; ++i) {
+         if (best >= 0 && i >= best && i < best + best_len) {
+            if (i == best) {
+               out << ':';
+            }
+            continue;
+         }
+         if (i) {
+            out << ':';
+         }
+         if (i == 6 && best == 0 &&
+             (best_len == 6 || (best_len == 5 && groups[5] == 0xffff))) {
+            out << addr_.bytes[12] << '.' << addr_.bytes[13] << '.'
+                << addr_.bytes[14] << '.' << addr_.bytes[15];
+            break;
+         }
+         out.write_hex(groups[i]);
+      }
+      if (best >= 0 && best + best_len == 8) {
+         out << ':';
+      }
+   } else {
+      out << "Unknown IP address type.";
+   }
+   return out.end();
+}
 
 
 
@@ -1,52 +1,38 @@
 // Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
 // Arista Networks, Inc. Confidential and Proprietary.
 
-#include "DA/acl.h"
-#include "DA/agent.h"
-#include "DA/bfd.h"
-#include "DA/class_map.h"
-#include "DA/decap_group.h"
-#include "DA/directflow.h"
-#include "DA/eth_intf.h"
-#include "DA/eth_lag_intf.h"
-#include "DA/eth_phy_intf.h"
-#include "DA/fib.h"
-#include "DA/hardware_table.h"
-#include "DA/intf.h"
-#include "DA/ip_route.h"
-#include "DA/iterator.h"
-#include "DA/mac_table.h"
-#include "DA/mpls_route.h"
-#include "DA/mpls_vrf_label.h"
-#include "DA/neighbor_table.h"
-#include "DA/nexthop_group.h"
-#include "DA/policy_map.h"
-#include "DA/subintf.h"
-#include "DA/vrf.h"
-#include "DA/lldp.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
+template <typename T, typename Impl>
+inline iter_base<T, Impl>::iter_base()
+   : impl(0) {
+}
+
 template <typename T, typename Impl>
 inline iter_base<T, Impl>::iter_base(Impl * const impl)
    : impl(impl) {
 }
 
+// The copy shares the snapshot, so copying is O(1) however big the table.
 template <typename T, typename Impl>
 inline iter_base<T, Impl>::iter_base(iter_base<T, Impl> const & other)
-   : impl(0) {
+   : impl(other.impl ? new Impl(*other.impl) : 0) {
 }
 
 template <typename T, typename Impl>
 inline iter_base<T, Impl>::~iter_base() {
+   delete impl;
 }
 
 template <typename T, typename Impl>
 inline iter_base<T, Impl>&
 iter_base<T, Impl>::operator=(const iter_base<T, Impl> & other) {
    if (this != &other) {
+      Impl * copy = other.impl ? new Impl(*other.impl) : 0;
       delete impl;
-      impl = new Impl(*other.impl);
+      impl = copy;
    }
    return *this;
 }
@@ -54,91 +40,96 @@ iter_base<T, Impl>::operator=(const iter_base<T, Impl> & other) {
 template <typename T, typename Impl>
 inline iter_base<T, Impl>&
 iter_base<T, Impl>::operator++() {
+   if (impl) {
+      impl->next();
+   }
    return *this;
 }
 
 template <typename T, typename Impl>
 inline bool
 iter_base<T, Impl>::operator==(const iter_base<T, Impl> & rhs) const {
-   return impl == rhs.impl;
+   if (!impl || !rhs.impl) {
+      return !*this && !rhs;
+   }
+   return *impl == *rhs.impl;
 }
 
 template <typename T, typename Impl>
 inline T
 iter_base<T, Impl>::operator*() const {
-   return T();
+   return *this ? impl->value() : T();
 }
 
 template <typename T, typename Impl>
 inline T const *
 iter_base<T, Impl>::operator->() const {
-   return 0;
+   return *this ? &impl->value() : 0;
 }
 
 template <typename T, typename Impl>
 inline T *
 iter_base<T, Impl>::operator->() {
-   return 0;
+   return *this ? &impl->value() : 0;
+}
+
+template <typename T, typename Impl>
+inline size_t
+iter_base<T, Impl>::next_batch(T * buf, size_t len) {
+   return impl ? impl->next_batch(buf, len) : 0;
 }
 
 template <typename T, typename Impl>
 inline iter_base<T, Impl>::operator bool() const {
-   return false;
+   return impl && !impl->done();
 }
 
 
 /**
- * Helper macro to define iterator classes that wrap our internal iterators.
+ * Helper macro to instantiate the iterator classes, whose impl classes are
+ * defined in iterator_impl.h.
  * @param SdkIter Tke name of the SDK iterator (e.g. foo_iter_t).
  * @param IterClassImpl The name of the SDK wrapper class (e.g. foo_iter_impl).
- * TODO: Right now in the stubs the impl class is empty because iter_base does
- * not delegate anything to it yet.  We need to make iter_base delegate calls
- * to the impl class, and provide a stub implementation.
- * NOTE: The impl class needs to be marked with DA_SDK_PUBLIC because as of
- * GCC 4.6, if a template parameter has hidden visibility, it contaminates the
- * template class, even if that class was marked as having default visibility.
  */
-#define INSTANTIATE_ITERATOR(SdkIter, IterClassImpl)    \
-  struct DA_SDK_PUBLIC IterClassImpl {                 \
-     virtual ~IterClassImpl() DA_SDK_PRIVATE;          \
-  };                                                    \
-  IterClassImpl::~IterClassImpl() {}                    \
-  template class iter_base<SdkIter, IterClassImpl>
-
-INSTANTIATE_ITERATOR(acl_key_t, acl_iter_impl);
-INSTANTIATE_ITERATOR(acl_rule_eth_entry_t, acl_rule_eth_iter_impl);
-INSTANTIATE_ITERATOR(acl_rule_ip_entry_t, acl_rule_ip_iter_impl);
-INSTANTIATE_ITERATOR(std::string, agent_option_iter_impl);
-INSTANTIATE_ITERATOR(std::string, agent_status_iter_impl);
-INSTANTIATE_ITERATOR(bfd_session_key_t, bfd_session_iter_impl);
-INSTANTIATE_ITERATOR(class_map_key_t, class_map_iter_impl);
-INSTANTIATE_ITERATOR(decap_group_t, decap_group_iter_impl);
-INSTANTIATE_ITERATOR(fib_fec_t, fib_fec_iter_impl);
-INSTANTIATE_ITERATOR(fib_route_t, fib_route_iter_impl);
-INSTANTIATE_ITERATOR(flow_entry_t, flow_entry_iter_impl);
-INSTANTIATE_ITERATOR(hardware_table_key_t, hardware_table_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, intf_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, eth_intf_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, eth_lag_intf_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, eth_lag_intf_member_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, eth_phy_intf_iter_impl);
-INSTANTIATE_ITERATOR(ip_route_t, ip_route_iter_impl);
-INSTANTIATE_ITERATOR(ip_route_via_t, ip_route_via_iter_impl);
-INSTANTIATE_ITERATOR(mac_key_t, mac_table_iter_impl);
-INSTANTIATE_ITERATOR(mac_key_t, mac_table_status_iter_impl);
-INSTANTIATE_ITERATOR(mpls_route_t, mpls_route_iter_impl);
-INSTANTIATE_ITERATOR(mpls_route_key_t, mpls_route_status_iter_impl);
-INSTANTIATE_ITERATOR(mpls_route_via_t, mpls_route_via_iter_impl);
-INSTANTIATE_ITERATOR(mpls_route_via_t, mpls_route_via_status_iter_impl);
-INSTANTIATE_ITERATOR(mpls_vrf_label_t, mpls_vrf_label_iter_impl);
-INSTANTIATE_ITERATOR(neighbor_key_t, neighbor_table_iter_impl);
-INSTANTIATE_ITERATOR(neighbor_key_t, neighbor_table_status_iter_impl);
-INSTANTIATE_ITERATOR(nexthop_group_t, nexthop_group_iter_impl);
-INSTANTIATE_ITERATOR(policy_map_key_t, policy_map_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, subintf_iter_impl);
-INSTANTIATE_ITERATOR(std::string, vrf_iter_impl);
-INSTANTIATE_ITERATOR(lldp_remote_system_t, lldp_remote_system_iter_impl);
-INSTANTIATE_ITERATOR(intf_id_t, lldp_intf_iter_impl);
-INSTANTIATE_ITERATOR(lldp_neighbor_t, lldp_neighbor_iter_impl);
+#define INSTANTIATE_ITERATOR(SdkIter, IterClassImpl)                 \
+  template class iter_base<SdkIter::value_type, IterClassImpl>;       \
+  SdkIter::SdkIter(IterClassImpl * const impl) : iter_base(impl) {    \
+  }
+
+INSTANTIATE_ITERATOR(acl_iter_t, acl_iter_impl)
+INSTANTIATE_ITERATOR(acl_rule_eth_iter_t, acl_rule_eth_iter_impl)
+INSTANTIATE_ITERATOR(acl_rule_ip_iter_t, acl_rule_ip_iter_impl)
+INSTANTIATE_ITERATOR(agent_option_iter_t, agent_option_iter_impl)
+INSTANTIATE_ITERATOR(agent_status_iter_t, agent_status_iter_impl)
+INSTANTIATE_ITERATOR(bfd_session_iter_t, bfd_session_iter_impl)
+INSTANTIATE_ITERATOR(class_map_iter_t, class_map_iter_impl)
+INSTANTIATE_ITERATOR(decap_group_iter_t, decap_group_iter_impl)
+INSTANTIATE_ITERATOR(fib_fec_iter_t, fib_fec_iter_impl)
+INSTANTIATE_ITERATOR(fib_route_iter_t, fib_route_iter_impl)
+INSTANTIATE_ITERATOR(flow_entry_iter_t, flow_entry_iter_impl)
+INSTANTIATE_ITERATOR(hardware_table_iter_t, hardware_table_iter_impl)
+INSTANTIATE_ITERATOR(intf_iter_t, intf_iter_impl)
+INSTANTIATE_ITERATOR(eth_intf_iter_t, eth_intf_iter_impl)
+INSTANTIATE_ITERATOR(eth_lag_intf_iter_t, eth_lag_intf_iter_impl)
+INSTANTIATE_ITERATOR(eth_lag_intf_member_iter_t, eth_lag_intf_member_iter_impl)
+INSTANTIATE_ITERATOR(eth_phy_intf_iter_t, eth_phy_intf_iter_impl)
+INSTANTIATE_ITERATOR(ip_route_iter_t, ip_route_iter_impl)
+INSTANTIATE_ITERATOR(ip_route_via_iter_t, ip_route_via_iter_impl)
+INSTANTIATE_ITERATOR(mac_table_iter_t, mac_table_iter_impl)
+INSTANTIATE_ITERATOR(mac_table_status_iter_t, mac_table_status_iter_impl)
+INSTANTIATE_ITERATOR(mpls_route_iter_t, mpls_route_iter_impl)
+INSTANTIATE_ITERATOR(mpls_route_status_iter_t, mpls_route_status_iter_impl)
+INSTANTIATE_ITERATOR(mpls_route_via_iter_t, mpls_route_via_iter_impl)
+INSTANTIATE_ITERATOR(mpls_route_via_status_iter_t, mpls_route_via_status_iter_impl)
+INSTANTIATE_ITERATOR(mpls_vrf_label_iter_t, mpls_vrf_label_iter_impl)
+INSTANTIATE_ITERATOR(neighbor_table_iter_t, neighbor_table_iter_impl)
+INSTANTIATE_ITERATOR(neighbor_table_status_iter_t, neighbor_table_status_iter_impl)
+INSTANTIATE_ITERATOR(nexthop_group_iter_t, nexthop_group_iter_impl)
+INSTANTIATE_ITERATOR(policy_map_iter_t, policy_map_iter_impl)
+INSTANTIATE_ITERATOR(subintf_iter_t, subintf_iter_impl)
+INSTANTIATE_ITERATOR(vrf_iter_t, vrf_iter_impl)
+INSTANTIATE_ITERATOR(lldp_remote_system_iter_t, lldp_remote_system_iter_impl)
+INSTANTIATE_ITERATOR(lldp_intf_iter_t, lldp_intf_iter_impl)
+INSTANTIATE_ITERATOR(lldp_neighbor_iter_t, lldp_neighbor_iter_impl)
 
 }
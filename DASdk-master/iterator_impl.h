@@ -0,0 +1,392 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#ifndef DA_STUBS_ITERATOR_IMPL_H
+#define DA_STUBS_ITERATOR_IMPL_H
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DA/acl.h"
+#include "DA/agent.h"
+#include "DA/bfd.h"
+#include "DA/class_map.h"
+#include "DA/decap_group.h"
+#include "DA/directflow.h"
+#include "DA/eth_intf.h"
+#include "DA/eth_lag_intf.h"
+#include "DA/eth_phy_intf.h"
+#include "DA/fib.h"
+#include "DA/hardware_table.h"
+#include "DA/intf.h"
+#include "DA/ip_route.h"
+#include "DA/iterator.h"
+#include "DA/lldp.h"
+#include "DA/mac_table.h"
+#include "DA/mpls_route.h"
+#include "DA/mpls_vrf_label.h"
+#include "DA/neighbor_table.h"
+#include "DA/nexthop_group.h"
+#include "DA/policy_map.h"
+#include "DA/subintf.h"
+#include "DA/vrf.h"
+
+namespace DA {
+
+/**
+ * The rows of a table, which iterators walk over snapshots of.
+ *
+ * A snapshot shares the rows with the table, so taking one is O(1).  The
+ * first change to the table while a snapshot is alive copies the rows,
+ * and the snapshot keeps the old ones, so an iterator sees the table as it
+ * was when it was created, whatever handlers do to the table meanwhile.
+ */
+template <typename Row>
+class snapshot_rows {
+ public:
+   typedef std::vector<Row> rows_t;
+   typedef std::shared_ptr<rows_t const> snapshot_t;
+
+   snapshot_rows() : rows_(std::make_shared<rows_t>()) {
+   }
+
+   snapshot_t snapshot() const {
+      return rows_;
+   }
+
+   size_t size() const {
+      return rows_->size();
+   }
+
+ protected:
+   rows_t const & rows() const {
+      return *rows_;
+   }
+
+   // The rows to change, which are copied first if a snapshot shares them.
+   rows_t & writable_rows() {
+      if (rows_.use_count() != 1) {
+         rows_ = std::make_shared<rows_t>(*rows_);
+      } else {
+         // use_count() is a relaxed load: order the reads of snapshots
+         // released on other threads, such as partitioned iterators', before
+         // the writes to the rows.
+         std::atomic_thread_fence(std::memory_order_acquire);
+      }
+      return *rows_;
+   }
+
+ private:
+   std::shared_ptr<rows_t> rows_;
+};
+
+/// Hashes the SDK's types with their hash() method.
+struct sdk_hash {
+   template <typename T>
+   size_t operator()(T const & value) const {
+      return value.hash();
+   }
+};
+
+/**
+ * A table of values by key, with a hash index of where each key's row is.
+ * Deleting a row moves the last one into its place, so the rows are in no
+ * particular order.
+ */
+template <typename Key, typename Value>
+class snapshot_table : public snapshot_rows<std::pair<Key, Value> > {
+ public:
+   Value const * find(Key const & key) const {
+      auto it = index_.find(key);
+      return it == index_.end() ? 0 : &this->rows()[it->second].second;
+   }
+
+   /// The value of `key' to change in place, or null.
+   Value * find_writable(Key const & key) {
+      auto it = index_.find(key);
+      return it == index_.end() ? 0 : &this->writable_rows()[it->second].second;
+   }
+
+   /// Adds or replaces the value of `key', and returns true if it was added.
+   template <typename V>
+   bool set(Key const & key, V && value) {
+      // Looked up first, as inserting allocates a node even if it's there.
+      auto it = index_.find(key);
+      auto & rows = this->writable_rows();
+      if (it != index_.end()) {
+         rows[it->second].second = std::forward<V>(value);
+         return false;
+      }
+      index_.insert(std::make_pair(key, rows.size()));
+      rows.emplace_back(key, std::forward<V>(value));
+      return true;
+   }
+
+   /// Deletes the row of `key', and returns true if there was one.
+   bool del(Key const & key) {
+      auto it = index_.find(key);
+      if (it == index_.end()) {
+         return false;
+      }
+      size_t pos = it->second;
+      index_.erase(it);
+      auto & rows = this->writable_rows();
+      if (pos != rows.size() - 1) {
+         rows[pos] = std::move(rows.back());
+         index_[rows[pos].first] = pos;
+      }
+      rows.pop_back();
+      return true;
+   }
+
+ private:
+   std::unordered_map<Key, size_t, sdk_hash> index_;
+};
+
+/**
+ * A table whose rows are kept in key order, for small tables that are
+ * iterated in order, such as the rules of an ACL.
+ */
+template <typename Key, typename Value>
+class sorted_snapshot_table : public snapshot_rows<std::pair<Key, Value> > {
+ public:
+   Value const * find(Key const & key) const {
+      auto it = lower_bound(this->rows(), key);
+      return it != this->rows().end() && it->first == key ? &it->second : 0;
+   }
+
+   /// Adds or replaces the value of `key', and returns true if it was added.
+   template <typename V>
+   bool set(Key const & key, V && value) {
+      auto & rows = this->writable_rows();
+      auto it = lower_bound(rows, key);
+      if (it != rows.end() && it->first == key) {
+         it->second = std::forward<V>(value);
+         return false;
+      }
+      rows.emplace(it, key, std::forward<V>(value));
+      return true;
+   }
+
+   /// Deletes the row of `key', and returns true if there was one.
+   bool del(Key const & key) {
+      if (!find(key)) {
+         return false;
+      }
+      auto & rows = this->writable_rows();
+      rows.erase(lower_bound(rows, key));
+      return true;
+   }
+
+ private:
+   template <typename Rows>
+   static auto lower_bound(Rows & rows, Key const & key) -> decltype(rows.begin()) {
+      return std::lower_bound(
+         rows.begin(), rows.end(), key,
+         [](std::pair<Key, Value> const & row, Key const & k) {
+            return row.first < k;
+         });
+   }
+};
+
+/// The value of the rows of a table that only holds keys.
+struct no_value {
+};
+
+/**
+ * The state of an iterator over a snapshot of a table's rows, which yields
+ * each row's key, its value, or the row itself, as the iterator's type T
+ * is.  The current one is copied out of the snapshot, so that the
+ * iterator's non-const operator->() can't change what other iterators see.
+ */
+template <typename T, typename Key, typename Value>
+class table_iter {
+ public:
+   typedef std::pair<Key, Value> row_t;
+   typedef typename snapshot_rows<row_t>::snapshot_t snapshot_t;
+
+   /// Iterates over `rows', or over nothing if there are none.
+   explicit table_iter(snapshot_t const & rows)
+         : rows_(rows), pos_(0), end_(rows ? rows->size() : 0), value_() {
+      load();
+   }
+
+   /// Iterates over the rows of `rows' from `begin' up to `end'.
+   table_iter(snapshot_t const & rows, size_t begin, size_t end)
+         : rows_(rows), pos_(begin), end_(end), value_() {
+      load();
+   }
+
+   bool done() const {
+      return !rows_ || pos_ == end_;
+   }
+
+   void next() {
+      if (!done()) {
+         ++pos_;
+         load();
+      }
+   }
+
+   T & value() {
+      return value_;
+   }
+
+   // Copies the rows after the current one straight from the snapshot,
+   // and only loads the row the iterator stops at into value_.
+   size_t next_batch(T * buf, size_t len) {
+      if (done() || !len) {
+         return 0;
+      }
+      size_t n = std::min(len, end_ - pos_);
+      row_t const * row = rows_->data() + pos_;
+      buf[0] = std::move(value_);
+      for (size_t i = 1; i < n; ++i) {
+         buf[i] = part(row[i], static_cast<T const *>(0));
+      }
+      pos_ += n;
+      load();
+      return n;
+   }
+
+   bool operator==(table_iter const & other) const {
+      return done() ? other.done() : rows_ == other.rows_ && pos_ == other.pos_;
+   }
+
+ private:
+   static Key const & part(row_t const & row, Key const *) {
+      return row.first;
+   }
+   static Value const & part(row_t const & row, Value const *) {
+      return row.second;
+   }
+   static row_t const & part(row_t const & row, row_t const *) {
+      return row;
+   }
+
+   void load() {
+      if (!done()) {
+         value_ = part((*rows_)[pos_], static_cast<T const *>(0));
+      }
+   }
+
+   snapshot_t rows_;
+   size_t pos_;
+   size_t end_;
+   T value_;
+};
+
+/**
+ * Defines the implementation of an SDK iterator, over the rows of a table
+ * of Key and Value.  iter() makes an SDK iterator over a snapshot of the
+ * table, or, for managers that have no table, one that is done from the
+ * start.  iters() splits a snapshot into up to `count' SDK iterators over
+ * disjoint ranges of its rows, of about the same size.
+ *
+ * NOTE: The impl class needs to be marked with DA_SDK_PUBLIC because as of
+ * GCC 4.6, if a template parameter has hidden visibility, it contaminates the
+ * template class, even if that class was marked as having default visibility.
+ */
+#define DEFINE_ITER_IMPL(SdkIter, IterClassImpl, Key, Value)              \
+   class DA_SDK_PUBLIC IterClassImpl                                     \
+         : public table_iter<SdkIter::value_type, Key, Value> {         \
+    public:                                                              \
+      typedef table_iter<SdkIter::value_type, Key, Value> table_iter_t; \
+      static SdkIter iter(table_iter_t::snapshot_t const & rows =        \
+                             table_iter_t::snapshot_t()) {              \
+         return SdkIter(new IterClassImpl(rows));                        \
+      }                                                                  \
+      static std::vector<SdkIter> iters(                                 \
+            table_iter_t::snapshot_t const & rows, size_t count) {       \
+         size_t size = rows->size();                                     \
+         count = std::max<size_t>(1, std::min(count, size));             \
+         std::vector<SdkIter> result;                                    \
+         result.reserve(count);                                          \
+         for (size_t i = 0; i < count; ++i) {                            \
+            result.push_back(SdkIter(new IterClassImpl(                  \
+               rows, size * i / count, size * (i + 1) / count)));        \
+         }                                                               \
+         return result;                                                  \
+      }                                                                  \
+                                                                         \
+    private:                                                             \
+      explicit IterClassImpl(table_iter_t::snapshot_t const & rows)      \
+            : table_iter_t(rows) {                                       \
+      }                                                                  \
+      IterClassImpl(table_iter_t::snapshot_t const & rows,               \
+                    size_t begin, size_t end)                            \
+            : table_iter_t(rows, begin, end) {                           \
+      }                                                                  \
+   }
+
+DEFINE_ITER_IMPL(acl_iter_t, acl_iter_impl, acl_key_t, no_value);
+DEFINE_ITER_IMPL(acl_rule_eth_iter_t, acl_rule_eth_iter_impl,
+                 uint32_t, acl_rule_eth_t);
+DEFINE_ITER_IMPL(acl_rule_ip_iter_t, acl_rule_ip_iter_impl,
+                 uint32_t, acl_rule_ip_t);
+DEFINE_ITER_IMPL(agent_option_iter_t, agent_option_iter_impl,
+                 std::string, no_value);
+DEFINE_ITER_IMPL(agent_status_iter_t, agent_status_iter_impl,
+                 std::string, no_value);
+DEFINE_ITER_IMPL(bfd_session_iter_t, bfd_session_iter_impl,
+                 bfd_session_key_t, no_value);
+DEFINE_ITER_IMPL(class_map_iter_t, class_map_iter_impl,
+                 class_map_key_t, no_value);
+DEFINE_ITER_IMPL(decap_group_iter_t, decap_group_iter_impl,
+                 decap_group_t, no_value);
+DEFINE_ITER_IMPL(fib_fec_iter_t, fib_fec_iter_impl, fib_fec_key_t, fib_fec_t);
+DEFINE_ITER_IMPL(fib_route_iter_t, fib_route_iter_impl,
+                 fib_route_key_t, fib_route_t);
+DEFINE_ITER_IMPL(flow_entry_iter_t, flow_entry_iter_impl,
+                 flow_entry_t, no_value);
+DEFINE_ITER_IMPL(hardware_table_iter_t, hardware_table_iter_impl,
+                 hardware_table_key_t, no_value);
+DEFINE_ITER_IMPL(intf_iter_t, intf_iter_impl, intf_id_t, no_value);
+DEFINE_ITER_IMPL(eth_intf_iter_t, eth_intf_iter_impl, intf_id_t, no_value);
+DEFINE_ITER_IMPL(eth_lag_intf_iter_t, eth_lag_intf_iter_impl,
+                 intf_id_t, no_value);
+DEFINE_ITER_IMPL(eth_lag_intf_member_iter_t, eth_lag_intf_member_iter_impl,
+                 intf_id_t, no_value);
+DEFINE_ITER_IMPL(eth_phy_intf_iter_t, eth_phy_intf_iter_impl,
+                 intf_id_t, no_value);
+DEFINE_ITER_IMPL(ip_route_iter_t, ip_route_iter_impl, ip_route_t, no_value);
+DEFINE_ITER_IMPL(ip_route_via_iter_t, ip_route_via_iter_impl,
+                 ip_route_via_t, no_value);
+DEFINE_ITER_IMPL(mac_table_iter_t, mac_table_iter_impl, mac_key_t, mac_entry_t);
+DEFINE_ITER_IMPL(mac_table_status_iter_t, mac_table_status_iter_impl,
+                 mac_key_t, mac_entry_t);
+DEFINE_ITER_IMPL(mpls_route_iter_t, mpls_route_iter_impl,
+                 mpls_route_t, no_value);
+DEFINE_ITER_IMPL(mpls_route_status_iter_t, mpls_route_status_iter_impl,
+                 mpls_route_key_t, no_value);
+DEFINE_ITER_IMPL(mpls_route_via_iter_t, mpls_route_via_iter_impl,
+                 mpls_route_via_t, no_value);
+DEFINE_ITER_IMPL(mpls_route_via_status_iter_t, mpls_route_via_status_iter_impl,
+                 mpls_route_via_t, no_value);
+DEFINE_ITER_IMPL(mpls_vrf_label_iter_t, mpls_vrf_label_iter_impl,
+                 mpls_vrf_label_t, no_value);
+DEFINE_ITER_IMPL(neighbor_table_iter_t, neighbor_table_iter_impl,
+                 neighbor_key_t, neighbor_entry_t);
+DEFINE_ITER_IMPL(neighbor_table_status_iter_t, neighbor_table_status_iter_impl,
+                 neighbor_key_t, neighbor_entry_t);
+DEFINE_ITER_IMPL(nexthop_group_iter_t, nexthop_group_iter_impl,
+                 nexthop_group_t, no_value);
+DEFINE_ITER_IMPL(policy_map_iter_t, policy_map_iter_impl,
+                 policy_map_key_t, no_value);
+DEFINE_ITER_IMPL(subintf_iter_t, subintf_iter_impl, intf_id_t, no_value);
+DEFINE_ITER_IMPL(vrf_iter_t, vrf_iter_impl, std::string, no_value);
+DEFINE_ITER_IMPL(lldp_remote_system_iter_t, lldp_remote_system_iter_impl,
+                 lldp_remote_system_t, no_value);
+DEFINE_ITER_IMPL(lldp_intf_iter_t, lldp_intf_iter_impl, intf_id_t, no_value);
+DEFINE_ITER_IMPL(lldp_neighbor_iter_t, lldp_neighbor_iter_impl,
+                 lldp_neighbor_t, no_value);
+
+}
+
+#endif // DA_STUBS_ITERATOR_IMPL_H
@@ -3,6 +3,7 @@
 
 #include "DA/lldp.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -16,20 +17,16 @@ class lldp_mgr_impl : public lldp_mgr {
    }
 
    lldp_remote_system_iter_t lldp_remote_system_iter(intf_id_t intf) const {
-      lldp_remote_system_iter_t * nop = 0;
-      return *nop;
+      return lldp_remote_system_iter_impl::iter();
    }
    lldp_intf_iter_t lldp_intf_iter() const {
-      lldp_intf_iter_t * nop = 0;
-      return *nop;
+      return lldp_intf_iter_impl::iter();
    }
    lldp_neighbor_iter_t lldp_neighbor_iter() const {
-      lldp_neighbor_iter_t * nop = 0;
-      return *nop;
+      return lldp_neighbor_iter_impl::iter();
    }
    lldp_neighbor_iter_t lldp_neighbor_iter(intf_id_t intf) const {
-      lldp_neighbor_iter_t * nop = 0;
-      return *nop;
+      return lldp_neighbor_iter_impl::iter();
    }
 
    void enabled_is(bool enabled) { return; }
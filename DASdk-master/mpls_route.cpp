@@ -3,11 +3,14 @@
 
 #include "DA/mpls_route.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
 class mpls_route_mgr_impl : public mpls_route_mgr {
  public:
+   using mpls_route_mgr::mpls_route_via_set;
+
    mpls_route_mgr_impl() {
    }
 
@@ -20,13 +23,11 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
    }
 
    mpls_route_iter_t mpls_route_iter() const {
-      mpls_route_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return mpls_route_iter_impl::iter();
    }
 
    mpls_route_status_iter_t mpls_route_status_iter() const {
-      mpls_route_status_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return mpls_route_status_iter_impl::iter();
    }
 
    bool exists(mpls_route_key_t const & route_key) const {
@@ -54,20 +55,17 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
    }
 
    mpls_route_via_iter_t mpls_route_via_iter(mpls_route_key_t const & key) const {
-      mpls_route_via_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return mpls_route_via_iter_impl::iter();
    }
 
    mpls_route_via_status_iter_t mpls_route_via_status_iter(
          mpls_label_t const label) const {
-      mpls_route_via_status_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return mpls_route_via_status_iter_impl::iter();
    }
 
    mpls_route_via_status_iter_t
    mpls_route_via_status_iter(mpls_fec_id_t) const {
-      mpls_route_via_status_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return mpls_route_via_status_iter_impl::iter();
    }
 
    mpls_fec_id_t
@@ -81,6 +79,11 @@ class mpls_route_mgr_impl : public mpls_route_mgr {
    }
 };
 
+void
+mpls_route_mgr::mpls_route_via_set_moved(mpls_route_via_t & via) {
+   mpls_route_via_set(via);
+}
+
 DEFINE_STUB_MGR_CTOR(mpls_route_mgr)
 
 mpls_route_handler::mpls_route_handler(mpls_route_mgr *mgr) : base_handler(mgr) {
@@ -4,6 +4,7 @@
 #include "DA/mpls_vrf_label.h"
 #include "DA/panic.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -21,8 +22,7 @@ class mpls_vrf_label_mgr_impl : public mpls_vrf_label_mgr {
     }
 
     mpls_vrf_label_iter_t mpls_vrf_label_iter() const {
-       mpls_vrf_label_iter_t * nop = 0;
-       return *nop;  // TODO: No op impl.
+       return mpls_vrf_label_iter_impl::iter();
     }
 
    mpls_vrf_label_t mpls_vrf_label(mpls_label_t const & label) const {
@@ -3,52 +3,270 @@
 
 #include "DA/neighbor_table.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
-class neighbor_table_mgr_impl : public neighbor_table_mgr {
+class neighbor_table_mgr_impl : public neighbor_table_mgr,
+                                public deferred_flush {
  public:
-   neighbor_table_mgr_impl() {
+   neighbor_table_mgr_impl() : notifying_(0) {
+   }
+
+   ~neighbor_table_mgr_impl() {
+      impl.flush_del(this);
    }
 
    neighbor_table_iter_t neighbor_table_iter() const {
-      neighbor_table_iter_t * nop = 0;
-      return *nop;
+      return neighbor_table_iter_impl::iter(entries_.snapshot());
+   }
+
+   std::vector<neighbor_table_iter_t> neighbor_table_iters(size_t count) const {
+      return neighbor_table_iter_impl::iters(entries_.snapshot(), count);
    }
 
    neighbor_table_status_iter_t neighbor_table_status_iter() const {
-      neighbor_table_status_iter_t * nop = 0;
-      return *nop;
+      // There is no resolution in the stubs: the status is the configuration.
+      return neighbor_table_status_iter_impl::iter(entries_.snapshot());
    }
 
    virtual neighbor_entry_t neighbor_entry_status(neighbor_key_t const & key) const {
-      return neighbor_entry_t();
+      return neighbor_entry(key);
    }
 
-   virtual void neighbor_entry_set(neighbor_entry_t const & entry) {}
-   virtual void neighbor_entry_del(neighbor_key_t const & key) {}
+   virtual void neighbor_entry_set(neighbor_entry_t const & entry) {
+      entries_.set(entry.neighbor_key(), entry);
+      notify_set(entry);
+   }
+
+   virtual void neighbor_entry_del(neighbor_key_t const & key) {
+      if (!entries_.del(key)) {
+         return;
+      }
+      if (deliveries_.batched() || deliveries_.conflated()) {
+         flush_pending();
+      }
+      if (deliveries_.batched()) {
+         pending_entries_.del(key);
+      }
+      if (deliveries_.conflated()) {
+         conflated_entries_.changed(key);
+      }
+      notifying_++;
+      handler_foreach(key, [&](handler_t * handler) {
+         if (deliveries_.delivery(handler) == DELIVER_NOW) {
+            loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
+            handler->on_neighbor_entry_del(key);
+         }
+      });
+      notifying_--;
+      apply_deliveries();
+   }
 
    virtual neighbor_entry_t neighbor_entry(
                                neighbor_key_t const & key) const {
-      return neighbor_entry_t();
+      neighbor_entry_t const * entry = entries_.find(key);
+      return entry ? *entry : neighbor_entry_t();
+   }
+
+   // Delivers the changes of the loop iteration to the handlers that take
+   // them in batches, or conflated.  Changes they make go to the next batch.
+   void flush() {
+      delivering_entries_.swap(pending_entries_);
+      conflated_entries_.resolve([this](neighbor_key_t const & key) {
+         return entries_.find(key);
+      });
+      notifying_++;
+      handler_foreach([&](handler_t * handler) {
+         auto on_sets = [handler](neighbor_entry_t const * batch, size_t count) {
+            handler->on_neighbor_entry_set_batch(batch, count);
+         };
+         auto on_dels = [handler](neighbor_key_t const * batch, size_t count) {
+            handler->on_neighbor_entry_del_batch(batch, count);
+         };
+         delivery_t how = deliveries_.delivery(handler);
+         if (how == DELIVER_NOW) {
+            return;
+         }
+         loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
+         if (how == DELIVER_CONFLATED) {
+            deliveries_.changes_conflated_add(handler,
+                                              conflated_entries_.conflated());
+            conflated_entries_.deliver(on_sets, on_dels);
+         } else {
+            delivering_entries_.deliver(on_sets, on_dels);
+         }
+      });
+      notifying_--;
+      delivering_entries_.clear();
+      conflated_entries_.delivered();
+      apply_deliveries();
+   }
+
+ private:
+   typedef neighbor_table_handler handler_t;
+
+   // Only the handlers watching all the entries get them in batches.
+   using neighbor_table_mgr::add_handler;
+   using neighbor_table_mgr::remove_handler;
+
+   void add_handler(handler_t * handler) {
+      deliveries_.watch(handler);
+      neighbor_table_mgr::add_handler(handler);
    }
 
+   void remove_handler(handler_t * handler) {
+      deliveries_.unwatch(handler);
+      neighbor_table_mgr::remove_handler(handler);
+   }
+
+   void neighbor_entry_batches_is(handler_t * handler, bool batches) {
+      deliveries_.batches_is(handler, batches, held_back());
+   }
+
+   bool neighbor_entry_batches(handler_t const * handler) const {
+      return deliveries_.batches(handler);
+   }
+
+   void neighbor_entry_conflation_is(handler_t * handler, bool conflation) {
+      deliveries_.conflation_is(handler, conflation, held_back());
+   }
+
+   bool neighbor_entry_conflation(handler_t const * handler) const {
+      return deliveries_.conflation(handler);
+   }
+
+   uint64_t neighbor_entry_changes_conflated(handler_t const * handler) const {
+      return deliveries_.changes_conflated(handler);
+   }
+
+   // Holds the change back for the handlers that batch or conflate it
+   // before the others run, so that a handler changing how it gets the
+   // changes from there waits for the batches to be delivered.
+   void notify_set(neighbor_entry_t const & entry) {
+      if (deliveries_.batched() || deliveries_.conflated()) {
+         flush_pending();
+      }
+      if (deliveries_.batched()) {
+         pending_entries_.set(entry);
+      }
+      if (deliveries_.conflated()) {
+         conflated_entries_.changed(entry.neighbor_key());
+      }
+      notifying_++;
+      handler_foreach(entry.neighbor_key(), [&](handler_t * handler) {
+         if (deliveries_.delivery(handler) == DELIVER_NOW) {
+            loop_stats_probe probe(impl.stats(), LOOP_STAT_MGR_HANDLER, handler);
+            handler->on_neighbor_entry_set(entry);
+         }
+      });
+      notifying_--;
+      apply_deliveries();
+   }
+
+   // Has the pending batches flushed, when the first change goes into them.
+   void flush_pending() {
+      if (pending_entries_.empty() && conflated_entries_.empty()) {
+         impl.flush_is(this);
+      }
+   }
+
+   // Switches the handlers that asked to while changes were held back, once
+   // those are delivered.
+   void apply_deliveries() {
+      if (!held_back()) {
+         deliveries_.apply();
+      }
+   }
+
+   // Returns true if changes are held back for some handlers, or being
+   // delivered to them.
+   bool held_back() const {
+      return notifying_ || !pending_entries_.empty() ||
+             !conflated_entries_.empty();
+   }
+
+   snapshot_table<neighbor_key_t, neighbor_entry_t> entries_;
+   notification_batch<neighbor_entry_t, neighbor_key_t> pending_entries_;
+   // The batch being delivered, while the handlers add to the pending one.
+   notification_batch<neighbor_entry_t, neighbor_key_t> delivering_entries_;
+   // The entries changed, for the handlers that conflate them.
+   conflated_batch<neighbor_entry_t, neighbor_key_t> conflated_entries_;
+   // How each handler gets the changes.
+   handler_deliveries<handler_t> deliveries_;
+   // How many notifications of the handlers are running, nested.
+   unsigned notifying_;
 
 };
 
+std::vector<neighbor_table_iter_t>
+neighbor_table_mgr::neighbor_table_iters(size_t count) const {
+   return std::vector<neighbor_table_iter_t>(1, neighbor_table_iter());
+}
+
+void
+neighbor_table_mgr::neighbor_entry_batches_is(
+      neighbor_table_handler * handler, bool batches) {
+}
+
+bool
+neighbor_table_mgr::neighbor_entry_batches(
+      neighbor_table_handler const * handler) const {
+   return false;
+}
+
+void
+neighbor_table_mgr::neighbor_entry_conflation_is(
+      neighbor_table_handler * handler, bool conflation) {
+}
+
+bool
+neighbor_table_mgr::neighbor_entry_conflation(
+      neighbor_table_handler const * handler) const {
+   return false;
+}
+
+uint64_t
+neighbor_table_mgr::neighbor_entry_changes_conflated(
+      neighbor_table_handler const * handler) const {
+   return 0;
+}
+
 DEFINE_STUB_MGR_CTOR(neighbor_table_mgr)
 
 neighbor_table_handler::neighbor_table_handler(neighbor_table_mgr *mgr) :
                               base_handler(mgr) {
 }
 void neighbor_table_handler::watch_all_neighbor_entries(bool interest) {
+   if (interest) {
+      mgr_->add_handler(this);
+   } else {
+      mgr_->remove_handler(this);
+   }
 }
 void neighbor_table_handler::watch_neighbor_entry(neighbor_key_t const & key,
                                                    bool interest) {
+   if (interest) {
+      mgr_->add_handler(key, this);
+   } else {
+      mgr_->remove_handler(key, this);
+   }
 }
 void neighbor_table_handler::on_neighbor_entry_del(neighbor_key_t const & key) {
 }
 void neighbor_table_handler::on_neighbor_entry_set(neighbor_entry_t const & entry) {
 }
+void neighbor_table_handler::on_neighbor_entry_set_batch(
+      neighbor_entry_t const * entries, size_t count) {
+   for (size_t i = 0; i < count; ++i) {
+      on_neighbor_entry_set(entries[i]);
+   }
+}
+void neighbor_table_handler::on_neighbor_entry_del_batch(
+      neighbor_key_t const * keys, size_t count) {
+   for (size_t i = 0; i < count; ++i) {
+      on_neighbor_entry_del(keys[i]);
+   }
+}
 
 } // end DA namespace
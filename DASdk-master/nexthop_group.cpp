@@ -3,11 +3,14 @@
 
 #include "DA/nexthop_group.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
 class nexthop_group_mgr_impl : public nexthop_group_mgr {
  public:
+   using nexthop_group_mgr::nexthop_group_set;
+
    nexthop_group_mgr_impl() {
    }
 
@@ -20,8 +23,7 @@ class nexthop_group_mgr_impl : public nexthop_group_mgr {
    }
 
    nexthop_group_iter_t nexthop_group_iter() const {
-      nexthop_group_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return nexthop_group_iter_impl::iter();
    }
 
    nexthop_group_t nexthop_group(std::string const & nexthop_group_name) const {
@@ -50,6 +52,11 @@ class nexthop_group_mgr_impl : public nexthop_group_mgr {
    }
 };
 
+void
+nexthop_group_mgr::nexthop_group_set_moved(nexthop_group_t & group) {
+   nexthop_group_set(group);
+}
+
 DEFINE_STUB_MGR_CTOR(nexthop_group_mgr);
 
 nexthop_group_handler::nexthop_group_handler(nexthop_group_mgr * mgr) :
@@ -4,6 +4,7 @@
 #include "DA/class_map.h"
 #include "DA/exception.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace std {
 
@@ -58,6 +59,8 @@ policy_map_handler::on_policy_map_config_set(policy_map_key_t const & name) {
 
 class policy_map_mgr_impl : public policy_map_mgr {
  public:
+   using policy_map_mgr::policy_map_is;
+
    policy_map_mgr_impl() {
    }
 
@@ -82,8 +85,7 @@ class policy_map_mgr_impl : public policy_map_mgr {
    }
 
    policy_map_iter_t policy_map_iter(policy_feature_t) const {
-      policy_map_iter_t * nop = 0;
-      return *nop;
+      return policy_map_iter_impl::iter();
    }
 
    void policy_map_apply(policy_map_key_t const &, intf_id_t,
@@ -94,6 +96,11 @@ class policy_map_mgr_impl : public policy_map_mgr {
    }
 };
 
+void
+policy_map_mgr::policy_map_is_moved(policy_map_t & policy_map) {
+   policy_map_is(policy_map);
+}
+
 DEFINE_STUB_MGR_CTOR(policy_map_mgr)
 
 }
@@ -11,8 +11,9 @@ static std::string const RULE_CONFIG_ERROR_ = \
    "Policy maps have either one MPLS match rule or a collection of other rules";
 
 
-void
-policy_map_t::rules_is(std::map<uint32_t, policy_map_rule_t> const & rules) {
+// Panics if the rules mix the MPLS rule with others.
+static void
+check_rules(std::map<uint32_t, policy_map_rule_t> const & rules) {
    uint32_t mpls_ = 0;
    uint32_t non_mpls_ = 0;
    for(auto it = rules.cbegin(); it != rules.cend(); ++it) {
@@ -25,8 +26,18 @@ policy_map_t::rules_is(std::map<uint32_t, policy_map_rule_t> const & rules) {
    if ((non_mpls_ > 0 && mpls_ > 0) || mpls_ > 1) {
       panic(configuration_error(RULE_CONFIG_ERROR_));
    }
+}
+
+void
+policy_map_t::rules_is(std::map<uint32_t, policy_map_rule_t> const & rules) {
+   check_rules(rules);
    rules_ = rules;
-   
+}
+
+void
+policy_map_t::rules_is(std::map<uint32_t, policy_map_rule_t> && rules) {
+   check_rules(rules);
+   rules_ = std::move(rules);
 }
 
 void
@@ -0,0 +1,212 @@
+// Copyright (c) 2014 Arista Networks, Inc.  All rights reserved.
+// Arista Networks, Inc. Confidential and Proprietary.
+
+#include "DA/route_table.h"
+#include <endian.h>
+#include <string.h>
+
+#include <algorithm>
+
+namespace DA {
+
+namespace {
+
+/**
+ * A prefix as integers that compare in prefix_less() order, which are
+ * compared a word at a time rather than with memcmp(), and sorted a byte
+ * at a time.  `index' is where the prefix is in the array being sorted.
+ */
+struct prefix_key {
+   uint64_t hi;  // The first 8 bytes of the network address.
+   uint64_t lo;  // The last 8 bytes, zero for IPv4.
+   uint8_t af;
+   uint8_t length;
+   uint32_t index;
+};
+
+// The bytes of a key, from the least significant one: the prefix length,
+// then `lo', `hi' and the address family.
+static int const KEY_BYTES = 18;
+
+inline uint8_t key_byte(prefix_key const & key, int byte) {
+   if (byte == 0) {
+      return key.length;
+   } else if (byte <= 8) {
+      return key.lo >> (8 * (byte - 1));
+   } else if (byte <= 16) {
+      return key.hi >> (8 * (byte - 9));
+   }
+   return key.af;
+}
+
+inline prefix_key make_key(ip_prefix_t const & prefix, uint32_t index) {
+   prefix_key key;
+   // The address as stored, host bits included, which operator== compares
+   // too: 10.0.0.1/24 and 10.0.0.0/24 must get different keys, or
+   // diff_routes() would take one for the other.  It must not be masked.
+   ip_addr_t addr = prefix.network();
+   if (addr.af() == AF_IPV6) {
+      uint64_t words[2];
+      memcpy(words, addr.addr(), sizeof(words));
+      key.hi = be64toh(words[0]);
+      key.lo = be64toh(words[1]);
+   } else {
+      // Only the first 4 bytes of an IPv4 address are set.
+      key.hi = addr.af() == AF_IPV4 ?
+         uint64_t(ntohl(addr.addr_v4())) << 32 : 0;
+      key.lo = 0;
+   }
+   key.af = addr.af();
+   key.length = prefix.prefix_length();
+   key.index = index;
+   return key;
+}
+
+inline int compare_keys(prefix_key const & a, prefix_key const & b) {
+   if (a.af != b.af) {
+      return a.af < b.af ? -1 : 1;
+   } else if (a.hi != b.hi) {
+      return a.hi < b.hi ? -1 : 1;
+   } else if (a.lo != b.lo) {
+      return a.lo < b.lo ? -1 : 1;
+   } else if (a.length != b.length) {
+      return a.length < b.length ? -1 : 1;
+   }
+   return 0;
+}
+
+inline bool key_less(prefix_key const & a, prefix_key const & b) {
+   return compare_keys(a, b) < 0;
+}
+
+inline ip_prefix_t prefix_of(ip_prefix_t const & prefix) {
+   return prefix;
+}
+
+inline ip_prefix_t prefix_of(fib_route_t const & route) {
+   return route.route_key().prefix();
+}
+
+}
+
+// Below this many elements, comparing the keys beats counting their bytes.
+static size_t const RADIX_SORT_MIN = 256;
+
+// Sorts the keys with one counting pass per byte, least significant first,
+// skipping the bytes that are the same in all the keys.
+static void radix_sort(std::vector<prefix_key> & keys) {
+   size_t n = keys.size();
+   std::vector<size_t> counts(KEY_BYTES * 256, 0);
+   for (prefix_key const & key : keys) {
+      ++counts[key.length];
+      for (int shift = 0; shift < 64; shift += 8) {
+         ++counts[(1 + shift / 8) * 256 + uint8_t(key.lo >> shift)];
+         ++counts[(9 + shift / 8) * 256 + uint8_t(key.hi >> shift)];
+      }
+      ++counts[17 * 256 + key.af];
+   }
+   std::vector<prefix_key> sorted(n);
+   for (int byte = 0; byte < KEY_BYTES; ++byte) {
+      size_t * count = &counts[byte * 256];
+      if (count[key_byte(keys[0], byte)] == n) {
+         continue;
+      }
+      size_t offset = 0;
+      for (int digit = 0; digit < 256; ++digit) {
+         size_t c = count[digit];
+         count[digit] = offset;
+         offset += c;
+      }
+      for (prefix_key const & key : keys) {
+         sorted[count[key_byte(key, byte)]++] = key;
+      }
+      keys.swap(sorted);
+   }
+}
+
+template <typename T>
+static void sort_by_prefix(T * first, T * last) {
+   size_t n = last - first;
+   if (n < 2) {
+      return;
+   }
+   std::vector<prefix_key> keys;
+   keys.reserve(n);
+   for (size_t i = 0; i < n; ++i) {
+      keys.push_back(make_key(prefix_of(first[i]), i));
+   }
+   // Tables that are kept sorted, and resorted after a few changes, are
+   // left alone.
+   if (std::is_sorted(keys.begin(), keys.end(), key_less)) {
+      return;
+   }
+   if (n < RADIX_SORT_MIN) {
+      std::stable_sort(keys.begin(), keys.end(), key_less);
+   } else {
+      radix_sort(keys);
+   }
+   std::vector<T> sorted;
+   sorted.reserve(n);
+   for (prefix_key const & key : keys) {
+      sorted.push_back(std::move(first[key.index]));
+   }
+   std::move(sorted.begin(), sorted.end(), first);
+}
+
+bool
+prefix_less(ip_prefix_t const & a, ip_prefix_t const & b) {
+   return key_less(make_key(a, 0), make_key(b, 0));
+}
+
+void
+sort_prefixes(ip_prefix_t * first, ip_prefix_t * last) {
+   sort_by_prefix(first, last);
+}
+
+void
+sort_routes(fib_route_t * first, fib_route_t * last) {
+   sort_by_prefix(first, last);
+}
+
+void
+diff_routes(fib_route_t const * current, size_t current_len,
+            fib_route_t const * desired, size_t desired_len,
+            std::vector<fib_route_t> * added,
+            std::vector<fib_route_t> * updated,
+            std::vector<fib_route_key_t> * deleted) {
+   size_t i = 0, j = 0;
+   prefix_key current_key = {}, desired_key = {};
+   if (current_len) {
+      current_key = make_key(prefix_of(current[0]), 0);
+   }
+   if (desired_len) {
+      desired_key = make_key(prefix_of(desired[0]), 0);
+   }
+   while (i < current_len || j < desired_len) {
+      int cmp = i == current_len ? 1 :
+                j == desired_len ? -1 : compare_keys(current_key, desired_key);
+      if (cmp < 0) {
+         if (deleted) {
+            deleted->push_back(current[i].route_key());
+         }
+      } else if (cmp > 0) {
+         if (added) {
+            added->push_back(desired[j]);
+         }
+      } else if (updated) {
+         // Compare every field, so that fields added to fib_route_t later
+         // are picked up too.
+         if (current[i] != desired[j]) {
+            updated->push_back(desired[j]);
+         }
+      }
+      if (cmp <= 0 && ++i < current_len) {
+         current_key = make_key(prefix_of(current[i]), 0);
+      }
+      if (cmp >= 0 && ++j < desired_len) {
+         desired_key = make_key(prefix_of(desired[j]), 0);
+      }
+   }
+}
+
+}
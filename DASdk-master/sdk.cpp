@@ -15,10 +15,12 @@
 
 namespace DA {
 
-sdk_scoped_lock::sdk_scoped_lock() {
+sdk_scoped_lock::sdk_scoped_lock() : lock(&impl.sdk_mutex()) {
+   static_cast<std::recursive_mutex *>(lock)->lock();
 }
 
 sdk_scoped_lock::~sdk_scoped_lock() {
+   static_cast<std::recursive_mutex *>(lock)->unlock();
 }
 
 #include "GetAgentProcessName.cpp"
@@ -159,8 +161,12 @@ void sdk::init_event_loop() {
    }
 }
 
+fib_mgr * new_fib_mgr();
+
 void sdk::init_fib_mgr(mgr_mode_type_t mode) {
-   // TODO: No op impl.
+   if(!fib_mgr_) {
+      fib_mgr_ = new_fib_mgr();
+   }
 }
 
 void sdk::init_mount_mgr() {
@@ -5,6 +5,7 @@
 #include <cassert>
 #include "DA/subintf.h"
 #include "impl.h"
+#include "iterator_impl.h"
 
 namespace DA {
 
@@ -14,8 +15,7 @@ class subintf_mgr_impl : public subintf_mgr {
    }
 
    subintf_iter_t subintf_iter() const {
-      subintf_iter_t * nop = 0;
-      return *nop;  // TODO: No op impl.
+      return subintf_iter_impl::iter();
    }
 
    bool exists(intf_id_t) const {
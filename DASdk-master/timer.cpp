@@ -3,9 +3,17 @@
 
 #include <time.h>
 
+#include <atomic>
 #include <cstdio>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>  // for __get_cpuid()
+#include <x86intrin.h>  // for __rdtsc()
+#define DA_HAVE_TSC 1
+#endif
+
 #include "DA/base_mgr.h"
+#include "DA/exception.h"
 #include "DA/panic.h"
 #include "DA/timer.h"
 #include "impl.h"
@@ -14,7 +22,7 @@ namespace DA {
 
 //static seconds_t const TIME_BASE = 1000000.0;
 
-seconds_t now() {
+static seconds_t monotonic_now() {
    struct timespec t;
    int ret = clock_gettime(CLOCK_MONOTONIC, &t);
    if(ret == -1) {
@@ -23,18 +31,141 @@ seconds_t now() {
    return t.tv_sec + 0.000000001 * t.tv_nsec;// + TIME_BASE;
 }
 
+static std::atomic<clock_source_t> current_clock_source(CLOCK_SOURCE_MONOTONIC);
+
+#ifdef DA_HAVE_TSC
+
+// Seconds per TSC tick, measured by clock_source_is().
+static seconds_t tsc_period;
+// Number of ticks after which a thread re-synchronizes with the system clock.
+static uint64_t tsc_resync_ticks;
+
+/**
+ * Per thread TSC state: the last point where we synchronized the TSC with
+ * the system clock, from which we extrapolate.  Synchronizing every so often
+ * bounds the drift due to the error on `tsc_period' to well under a
+ * microsecond, at the cost of one clock_gettime() per thread every 100ms.
+ */
+struct tsc_anchor {
+   uint64_t ticks;
+   seconds_t time;
+   // Last value returned, so time never goes backwards after a resync.
+   seconds_t last;
+};
+static thread_local tsc_anchor anchor = { 0, 0, 0 };
+
+static seconds_t tsc_now() {
+   uint64_t ticks = __rdtsc();
+   if(ticks - anchor.ticks >= tsc_resync_ticks) {
+      anchor.time = monotonic_now();
+      anchor.ticks = __rdtsc();
+      ticks = anchor.ticks;
+   }
+   seconds_t t = anchor.time + (ticks - anchor.ticks) * tsc_period;
+   if(t < anchor.last) {
+      t = anchor.last;
+   }
+   anchor.last = t;
+   return t;
+}
+
+// Returns true if the TSC ticks at a constant rate, even across sleep states.
+static bool tsc_invariant() {
+   unsigned int eax, ebx, ecx, edx;
+   if(!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+      return false;
+   }
+   return edx & (1 << 8);
+}
+
+// Measures how long a TSC tick is against CLOCK_MONOTONIC.
+static void tsc_calibrate() {
+   seconds_t start = monotonic_now();
+   uint64_t start_ticks = __rdtsc();
+   seconds_t end;
+   do {
+      end = monotonic_now();
+   } while(end - start < 0.02);
+   uint64_t end_ticks = __rdtsc();
+   tsc_period = (end - start) / (end_ticks - start_ticks);
+   tsc_resync_ticks = uint64_t(0.1 / tsc_period);
+}
+
+#endif // DA_HAVE_TSC
+
+seconds_t now() {
+#ifdef DA_HAVE_TSC
+   if(current_clock_source.load(std::memory_order_relaxed) == CLOCK_SOURCE_TSC) {
+      return tsc_now();
+   }
+#endif
+   return monotonic_now();
+}
+
+seconds_t loop_now() {
+   return Impl::current().loop_time();
+}
+
+void clock_source_is(clock_source_t source) {
+   if(source == CLOCK_SOURCE_TSC) {
+#ifdef DA_HAVE_TSC
+      if(!tsc_invariant()) {
+         panic(unsupported_error("This CPU doesn't have an invariant TSC"));
+      }
+      if(current_clock_source.load() != CLOCK_SOURCE_TSC) {
+         tsc_calibrate();
+      }
+#else
+      panic(unsupported_error("The TSC clock is only supported on x86"));
+#endif
+   } else if(source != CLOCK_SOURCE_MONOTONIC) {
+      panic(invalid_argument_error("source", "unknown clock source"));
+   }
+   current_clock_source.store(source);
+}
+
+clock_source_t clock_source() {
+   return current_clock_source.load();
+}
+
 timeout_handler::timeout_handler(timeout_mgr * mgr) : 
-      base_handler<timeout_mgr, timeout_handler>(mgr) {
-   impl.register_timeout_handler(this);
+      base_handler<timeout_mgr, timeout_handler>(mgr),
+      timer_(new timer_internal(&Impl::current())) {
+   timer_->impl()->register_timeout_handler(this);
 }
 
 timeout_handler::~timeout_handler() {
-   impl.unregister_timeout_handler(this);
+   timer_->impl()->unregister_timeout_handler(this);
+   delete timer_;
 }
 
 void
 timeout_handler::timeout_time_is(seconds_t timeout) {
-   impl.timeout_is(this, timeout);
+   timer_->impl()->timeout_is(this, timeout);
+}
+
+timer_handle_t
+timeout_mgr::timer_once(seconds_t deadline, timer_callback_t const & callback) {
+   return Impl::current().timer_start(deadline, 0, callback);
+}
+
+timer_handle_t
+timeout_mgr::timer_periodic(seconds_t first_deadline, seconds_t interval,
+                            timer_callback_t const & callback) {
+   if (interval <= 0) {
+      panic(invalid_argument_error("interval", "must be greater than 0"));
+   }
+   return Impl::current().timer_start(first_deadline, interval, callback);
+}
+
+void
+timeout_mgr::timer_del(timer_handle_t const & handle) {
+   Impl::current().timer_cancel(handle);
+}
+
+bool
+timeout_mgr::timer_exists(timer_handle_t const & handle) const {
+   return Impl::current().timer_pending(handle);
 }
 
 class timeout_mgr_impl: public timeout_mgr {
@@ -3,6 +3,7 @@
 
 #include <DA/vrf.h>
 #include <impl.h>
+#include <iterator_impl.h>
 
 namespace DA {
 
@@ -13,8 +14,7 @@ class vrf_mgr_impl : public vrf_mgr {
    }
 
    vrf_iter_t vrf_iter() const {
-      vrf_iter_t * nop = 0;
-      return *nop;
+      return vrf_iter_impl::iter();
    }
 
    bool exists(std::string const & vrf_name) const {